@@ -0,0 +1,5 @@
+#include "bench.h"
+
+namespace Bench {
+volatile size_t sink = 0;
+}  // namespace Bench
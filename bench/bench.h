@@ -0,0 +1,185 @@
+/**
+ * @file bench.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Замер времени и выделений памяти для микробенчмарков
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Выделения считает подмененный operator new из game/allochook.cpp, как в
+ * headless, поэтому allocs/op здесь значит то же, что allocs/tick там.
+ * allochook.cpp и memory.cpp собираются в каждую программу замеров.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "memory.h"
+
+namespace Bench {
+
+/**
+ * @brief сюда складываем результаты операций, чтобы компилятор их не выкинул
+ *
+ */
+extern volatile size_t sink;
+
+/**
+ * @brief Параметры замера в виде JSON объекта
+ *
+ */
+class Params {
+  /**
+   * @brief поля через запятую
+   *
+   */
+  std::string fields;
+
+ public:
+  /**
+   * @brief Добавляет числовой параметр
+   *
+   * @param name имя
+   * @param value значение
+   * @return Params&
+   */
+  Params &add(const char *name, double value) {
+    std::ostringstream ss;
+    ss << value;
+    return field(name, ss.str());
+  }
+  /**
+   * @brief Добавляет строковый параметр
+   *
+   * @param name имя
+   * @param value значение
+   * @return Params&
+   */
+  Params &add(const char *name, const char *value) {
+    return field(name, std::string("\"") + value + "\"");
+  }
+  /**
+   * @brief JSON объект
+   *
+   * @return std::string
+   */
+  std::string json() const { return "{" + fields + "}"; }
+
+ private:
+  Params &field(const char *name, const std::string &value) {
+    if (!fields.empty()) fields += ", ";
+    fields += std::string("\"") + name + "\": " + value;
+    return *this;
+  }
+};
+
+/**
+ * @brief Набор замеров, результаты пишутся в JSON
+ *
+ */
+class Suite {
+  /**
+   * @brief имя набора
+   *
+   */
+  std::string name;
+  /**
+   * @brief замеряем только операции с этой подстрокой в имени
+   *
+   */
+  std::string filter;
+  /**
+   * @brief минимальное время замера одного случая в сек.
+   *
+   */
+  double minTime;
+  /**
+   * @brief результаты в виде JSON объектов
+   *
+   */
+  std::vector<std::string> results;
+
+ public:
+  /**
+   * @brief Construct a new Suite object
+   *
+   * @param name имя набора
+   * @param filter подстрока имени операций, пустая - все
+   * @param minTime минимальное время замера одного случая в сек.
+   */
+  Suite(const std::string &name, const std::string &filter = "",
+        double minTime = .2)
+      : name(name), filter(filter), minTime(minTime) {}
+  /**
+   * @brief Замеряет операцию
+   *
+   * Число повторов удваивается, пока замер не займет minTime.
+   *
+   * @tparam F size_t()
+   * @param op имя операции
+   * @param params параметры входных данных
+   * @param f операция, возвращает что-нибудь зависящее от результата
+   * @param bytes сколько байт обрабатывает операция, если задано выводится
+   * еще и MB/s
+   */
+  template <typename F>
+  void run(const std::string &op, const Params &params, F f,
+           size_t bytes = 0) {
+    if (op.find(filter) == std::string::npos) return;
+    using clock = std::chrono::steady_clock;
+    sink += f();  // прогрев
+    size_t iterations = 1, allocs = 0;
+    double elapsed = 0.;
+    for (;;) {
+      auto a = Memory::counters().allocations;
+      auto start = clock::now();
+      for (size_t i = 0; i < iterations; i++) sink += f();
+      elapsed = std::chrono::duration<double>(clock::now() - start).count();
+      allocs = size_t(Memory::counters().allocations - a);
+      if (elapsed >= minTime) break;
+      iterations *= 2;
+    }
+    auto ns = elapsed * 1e9 / double(iterations);
+    auto perOp = double(allocs) / double(iterations);
+    std::ostringstream ss;
+    ss << "{\"name\": \"" << op << "\", \"params\": " << params.json()
+       << ", \"iterations\": " << iterations << ", \"ns_per_op\": " << ns
+       << ", \"allocs_per_op\": " << perOp;
+    std::cout << op << " " << params.json() << ": " << ns << " ns/op, "
+              << perOp << " allocs/op";
+    if (bytes) {
+      auto mbs = double(bytes) / (ns * 1e-9) / 1e6;
+      ss << ", \"mb_per_s\": " << mbs;
+      std::cout << ", " << mbs << " MB/s";
+    }
+    ss << "}";
+    results.push_back(ss.str());
+    std::cout << std::endl;
+  }
+  /**
+   * @brief Записывает результаты в файл
+   *
+   * @param file имя файла
+   * @return true записали
+   * @return false ошибка
+   */
+  bool write(const char *file) const {
+    std::ofstream ofs(file);
+    ofs << "{\n  \"suite\": \"" << name << "\",\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++)
+      ofs << (i ? ",\n    " : "\n    ") << results[i];
+    ofs << "\n  ]\n}\n";
+    if (!ofs) {
+      std::cout << "Error writing file: " << file << std::endl;
+      return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace Bench
@@ -0,0 +1,50 @@
+#include <random>
+
+#include "bench.h"
+#include "utils.h"
+
+namespace {
+
+// Текст конфига как у levelgen: многоугольники по 3-12 точек с 2 знаками
+std::string level(size_t polygons) {
+  std::mt19937 rnd(1);
+  std::uniform_int_distribution<int> sides(3, 12);
+  std::uniform_real_distribution<GLfloat> coord(-100.f, 100.f);
+  std::string cfg;
+  char str[64];
+  for (size_t i = 0; i < polygons; i++) {
+    cfg += "[";
+    for (int k = 0, n = sides(rnd); k < n; k++) {
+      auto x = coord(rnd);
+      std::snprintf(str, sizeof(str), "%s(%.2f, %.2f)", k ? "," : "", x,
+                    coord(rnd));
+      cfg += str;
+    }
+    cfg += "]\n";
+  }
+  return cfg;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::cout << "config_bench - parseConfig throughput" << std::endl;
+
+  if (argc > 3) {
+    std::cout << "Usage: config_bench [out.json] [filter]" << std::endl;
+    return 1;
+  }
+  auto out = argc > 1 ? argv[1] : "config_bench.json";
+  Bench::Suite suite("config", argc > 2 ? argv[2] : "");
+
+  for (auto polygons : {100, 10000, 100000}) {
+    auto cfg = level(polygons);
+    suite.run("parseConfig",
+              Bench::Params()
+                  .add("polygons", polygons)
+                  .add("bytes", double(cfg.size())),
+              [&] { return parseConfig(cfg).size(); }, cfg.size());
+  }
+
+  return suite.write(out) ? 0 : 1;
+}
@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <random>
+
+#include "bench.h"
+#include "geometry.h"
+
+namespace {
+
+constexpr size_t queries = 64;
+
+// Правильный многоугольник или звезда (невыпуклый) радиуса r с центром в 0
+std::vector<Point> polygon(size_t n, bool convex, GLfloat r = .5f) {
+  std::vector<Point> pts;
+  for (size_t i = 0; i < n; i++) {
+    auto phi = 2.f * PI * GLfloat(i) / GLfloat(n);
+    auto rr = convex || i % 2 == 0 ? r : r * .5f;
+    pts.push_back(Point{rr * std::cos(phi), rr * std::sin(phi)});
+  }
+  return pts;
+}
+
+// Точка на расстоянии [r0, r1] от центра
+Point around(std::mt19937 &rnd, GLfloat r0, GLfloat r1) {
+  std::uniform_real_distribution<GLfloat> phi(0.f, 2.f * PI), r(r0, r1);
+  auto a = phi(rnd), l = r(rnd);
+  return Point{l * std::cos(a), l * std::sin(a)};
+}
+
+// Первые hit * queries случаев попадают, остальные нет, порядок перемешан
+std::vector<bool> hits(std::mt19937 &rnd, double hit) {
+  std::vector<bool> v(queries);
+  for (size_t i = 0; i < queries; i++) v[i] = i < size_t(hit * queries + .5);
+  std::shuffle(v.begin(), v.end(), rnd);
+  return v;
+}
+
+const Point away{3.f, 0.f};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::cout << "geometry_bench - geometry.h microbenchmarks" << std::endl;
+
+  if (argc > 3) {
+    std::cout << "Usage: geometry_bench [out.json] [filter]" << std::endl;
+    return 1;
+  }
+  auto out = argc > 1 ? argv[1] : "geometry_bench.json";
+  Bench::Suite suite("geometry", argc > 2 ? argv[2] : "");
+
+  const size_t sizes[] = {4, 16, 64, 256};
+  const double ratios[] = {0., .5, 1.};
+  const char *shape[] = {"concave", "convex"};
+
+  for (auto n : sizes) {
+    for (int convex = 0; convex < 2; convex++) {
+      auto poly = polygon(n, convex);
+      auto params = Bench::Params().add("n", n).add("shape", shape[convex]);
+      suite.run("triangulate2d", params, [&] {
+        std::vector<Triangle> t;
+        g::triangulate2d(poly, t);
+        return t.size();
+      });
+      for (auto hit : ratios) {
+        std::mt19937 rnd(1);
+        std::vector<Point> pts;
+        std::vector<std::array<Point, 2>> segs;
+        for (auto h : hits(rnd, hit)) {
+          // Точки внутри вписанного круга или снаружи описанного
+          pts.push_back(h ? around(rnd, 0.f, .2f) : around(rnd, .6f, 1.f));
+          // Отрезок из центра наружу пересекает ребро, снаружи - нет
+          auto end = around(rnd, 1.f, 1.f);
+          segs.push_back(h ? std::array<Point, 2>{Point{0.f, 0.f}, end}
+                           : std::array<Point, 2>{away, away + end});
+        }
+        auto hitParams = params;
+        hitParams.add("hit", hit);
+        size_t i = 0;
+        suite.run("ptInPoligon", hitParams, [&] {
+          return size_t(g::ptInPoligon(poly, pts[i++ % queries]));
+        });
+        suite.run("intersect(polygon,segment)", hitParams, [&] {
+          auto &s = segs[i++ % queries];
+          return g::intersect(poly, s[0], s[1]).size();
+        });
+      }
+    }
+  }
+
+  for (auto hit : ratios) {
+    std::mt19937 rnd(2);
+    std::vector<std::array<Point, 4>> segs;
+    std::vector<Triangle> tris;
+    for (auto h : hits(rnd, hit)) {
+      // Отрезки и треугольники вокруг центра пересекаются, сдвинутые - нет
+      auto a = around(rnd, .1f, .5f), b = around(rnd, .1f, .5f);
+      auto shift = h ? Point{0.f, 0.f} : away;
+      segs.push_back({a, Point{0.f, 0.f} - a, shift + b, shift - b});
+      auto c = around(rnd, .1f, .5f);
+      tris.push_back(Triangle{shift + a, shift + b, shift + c});
+    }
+    const Triangle tri{Point{-.5f, -.3f}, Point{.5f, -.3f}, Point{0.f, .5f}};
+    auto params = Bench::Params().add("hit", hit);
+    size_t i = 0;
+    suite.run("intersect(segment,segment)", params, [&] {
+      auto &s = segs[i++ % queries];
+      Point p;
+      return size_t(g::intersect(s[0], s[1], s[2], s[3], &p));
+    });
+    suite.run("intersect(triangle,segment)", params, [&] {
+      auto &s = segs[i++ % queries];
+      return size_t(g::intersect(tri, s[2], s[3]));
+    });
+    suite.run("intersect(triangle,triangle)", params, [&] {
+      return size_t(g::intersect(tri, tris[i++ % queries]));
+    });
+  }
+
+  // Чем ближе отрезок к смотрящему, тем больше углов поля захватывает тень
+  for (auto distance : {.1f, .5f}) {
+    std::mt19937 rnd(3);
+    std::vector<std::array<Point, 3>> cases;
+    for (size_t i = 0; i < queries; i++) {
+      auto P = around(rnd, 0.f, .3f), dir = around(rnd, distance, distance);
+      auto side = g::rot(dir, g::angle(dir) + PI * .5f);
+      auto half = g::vec(side, .1f);
+      cases.push_back({P, P + dir - half, P + dir + half});
+    }
+    size_t i = 0;
+    auto params = Bench::Params().add("distance", distance);
+    suite.run("invisiblePoligon", params, [&] {
+      auto &c = cases[i++ % queries];
+      std::vector<Point> pts;
+      g::invisiblePoligon(c[0], c[1], c[2], pts);
+      return pts.size();
+    });
+  }
+
+  {
+    std::mt19937 rnd(4);
+    std::vector<std::array<Point, 3>> cases;
+    for (size_t i = 0; i < queries; i++)
+      cases.push_back({around(rnd, .5f, 1.f), around(rnd, .5f, 1.f),
+                       around(rnd, .01f, .1f)});
+    size_t i = 0;
+    suite.run("reflect", Bench::Params(), [&] {
+      auto &c = cases[i++ % queries];
+      auto v = g::reflect(c[0], c[1], c[2]);
+      return size_t(v[0] > v[1]);
+    });
+  }
+
+  for (auto radius : {.01f, .1f, .5f}) {
+    Circle c{Point{.1f, .2f}, radius};
+    suite.run("points(Circle)", Bench::Params().add("radius", radius),
+              [&] { return g::points(c).size(); });
+  }
+
+  return suite.write(out) ? 0 : 1;
+}
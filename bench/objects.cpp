@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <random>
+
+#include "bench.h"
+#include "objects.h"
+
+namespace {
+
+constexpr size_t queries = 64;
+
+// Выпуклые многоугольники по ячейкам сетки, всего не меньше vertices вершин
+std::vector<std::vector<Point>> level(size_t vertices, std::mt19937 &rnd) {
+  std::uniform_int_distribution<size_t> sides(4, 8);
+  std::uniform_real_distribution<GLfloat> turn(0.f, 2.f * PI);
+  auto cells = size_t(std::ceil(std::sqrt(vertices / 6.)));
+  auto cell = gameSize * 2.f / GLfloat(cells);
+  std::vector<std::vector<Point>> cfg;
+  size_t total = 0;
+  for (size_t i = 0; i < cells * cells && total < vertices; i++) {
+    Point c{-gameSize + cell * (GLfloat(i % cells) + .5f),
+            -gameSize + cell * (GLfloat(i / cells) + .5f)};
+    auto n = sides(rnd);
+    auto phi = turn(rnd);
+    std::vector<Point> pts;
+    for (size_t k = 0; k < n; k++) {
+      auto a = phi + 2.f * PI * GLfloat(k) / GLfloat(n);
+      pts.push_back(c + Point{std::cos(a), std::sin(a)} * (cell * .35f));
+    }
+    total += n;
+    cfg.push_back(pts);
+  }
+  return cfg;
+}
+
+Point random(std::mt19937 &rnd) {
+  std::uniform_real_distribution<GLfloat> d(-gameSize, gameSize);
+  auto x = d(rnd);
+  return Point{x, d(rnd)};
+}
+
+// Байт на загрузку в буферы отрисовщика
+size_t upload(const Objects &objects) {
+  size_t vertices = 0, indexes = 0;
+  for (size_t i = 0; i < objects.size(); i++) {
+    vertices += objects.getPoints(i).size();
+    indexes += objects.getIndexes(i).size() * 3;
+  }
+  auto vertex = objects.getFormat() == VertexFormat::Short ? sizeof(ShortPoint)
+                                                           : sizeof(Point);
+  return vertices * vertex + indexes * (vertices <= 0xffff ? 2 : 4);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::cout << "objects_bench - Objects storage and queries" << std::endl;
+
+  if (argc > 3) {
+    std::cout << "Usage: objects_bench [out.json] [filter]" << std::endl;
+    return 1;
+  }
+  auto out = argc > 1 ? argv[1] : "objects_bench.json";
+  Bench::Suite suite("objects", argc > 2 ? argv[2] : "");
+
+  const std::pair<VertexFormat, const char *> formats[] = {
+      {VertexFormat::Float, "float"}, {VertexFormat::Short, "short"}};
+
+  for (auto vertices : {10000, 1000000}) {
+    std::mt19937 rnd(1);
+    auto cfg = level(vertices, rnd);
+    std::vector<Point> pts;
+    std::vector<std::array<Point, 2>> segs;
+    std::vector<std::vector<Point>> rects;
+    for (size_t i = 0; i < queries; i++) {
+      auto p = random(rnd);
+      pts.push_back(p);
+      segs.push_back({p, p + Point{.05f, .03f}});
+      rects.push_back(g::points(Rect{p, Size{.02f, .02f}}));
+    }
+    for (auto const &f : formats) {
+      // Запросам нужны объекты, даже если замер set отфильтрован
+      Objects objects(figureColor, f.first);
+      objects.set(cfg);
+      auto params = Bench::Params().add("vertices", vertices).add("format",
+                                                                  f.second);
+      suite.run("set", params, [&] {
+        objects.set(cfg);
+        return objects.size();
+      });
+      params.add("bytes", double(objects.getBytes()))
+          .add("upload", double(upload(objects)));
+      size_t i = 0;
+      suite.run("inside", params, [&] {
+        return size_t(!!objects.inside(pts[i++ % queries]));
+      });
+      suite.run("intersect(segment)", params, [&] {
+        auto &s = segs[i++ % queries];
+        return size_t(!!objects.intersect(s[0], s[1]));
+      });
+      suite.run("intersect(polygon)", params, [&] {
+        return size_t(!!objects.intersect(rects[i++ % queries]));
+      });
+    }
+  }
+
+  return suite.write(out) ? 0 : 1;
+}
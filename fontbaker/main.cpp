@@ -0,0 +1,128 @@
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_MODULE_H
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "atlas.h"
+#include "glyphs.h"
+
+struct Bitmap {
+  Glyphs::Glyph glyph;
+  std::vector<unsigned char> pixels;
+};
+
+int main(int argc, char **argv) {
+  std::cout << "fontbaker - rasterize font glyphs into atlas" << std::endl;
+
+  if (argc != 8) {
+    std::cout << "Usage: fontbaker in.ttf out.glyphs out.atlas bitmap|sdf size "
+                 "spread width"
+              << std::endl;
+    return 1;
+  }
+
+  auto sdf = std::string(argv[4]) == "sdf";
+  auto size = std::stoi(argv[5]);
+  FT_Int spread = std::stoi(argv[6]);
+  unsigned width = std::stoi(argv[7]);
+
+  FT_Library ft;
+  if (FT_Init_FreeType(&ft)) {
+    std::cout << "Error init FreeType" << std::endl;
+    return 1;
+  }
+  if (sdf && FT_Property_Set(ft, "sdf", "spread", &spread)) {
+    std::cout << "Error FreeType has no sdf module" << std::endl;
+    return 1;
+  }
+  FT_Face face;
+  if (FT_New_Face(ft, argv[1], 0, &face)) {
+    std::cout << "Error reading font: " << argv[1] << std::endl;
+    return 1;
+  }
+  FT_Set_Pixel_Sizes(face, 0, size);
+
+  // Печатные символы ASCII, остальные игра растеризует сама при надобности
+  std::vector<Bitmap> bitmaps;
+  for (FT_ULong c = 0x20; c < 0x7F; c++) {
+    if (!FT_Get_Char_Index(face, c)) continue;
+    if (FT_Load_Char(face, c, FT_LOAD_DEFAULT)) continue;
+    auto slot = face->glyph;
+    // Символы без контура (пробел) не рисуются, нужно только смещение
+    if (slot->format == FT_GLYPH_FORMAT_OUTLINE && slot->outline.n_points &&
+        FT_Render_Glyph(slot, sdf ? FT_RENDER_MODE_SDF : FT_RENDER_MODE_NORMAL))
+      continue;
+    Bitmap b{};
+    b.glyph.code = uint32_t(c);
+    b.glyph.advance = int16_t((slot->advance.x + 32) >> 6);
+    if (slot->format == FT_GLYPH_FORMAT_BITMAP && slot->bitmap.buffer) {
+      auto &bmp = slot->bitmap;
+      b.glyph.width = uint16_t(bmp.width);
+      b.glyph.height = uint16_t(bmp.rows);
+      b.glyph.left = int16_t(slot->bitmap_left);
+      b.glyph.top = int16_t(slot->bitmap_top);
+      for (unsigned row = 0; row < bmp.rows; row++) {
+        auto line = bmp.buffer + row * bmp.pitch;
+        b.pixels.insert(b.pixels.end(), line, line + bmp.width);
+      }
+    }
+    bitmaps.push_back(std::move(b));
+  }
+  FT_Done_Face(face);
+  FT_Done_FreeType(ft);
+
+  // Упакуем в полосу заданной ширины и обрежем по занятой высоте
+  Atlas packer(width, 0xFFFF);
+  unsigned height = 0;
+  for (auto &b : bitmaps) {
+    if (!b.glyph.width || !b.glyph.height) continue;
+    Atlas::Pos pos;
+    if (!packer.insert(b.glyph.width, b.glyph.height, pos)) {
+      std::cout << "Error glyph does not fit: " << b.glyph.code << std::endl;
+      return 1;
+    }
+    b.glyph.x = uint16_t(pos[0]);
+    b.glyph.y = uint16_t(pos[1]);
+    height = std::max(height, pos[1] + b.glyph.height + 1);
+  }
+  std::vector<unsigned char> pixels(width * height, 0);
+  for (auto const &b : bitmaps) {
+    for (unsigned row = 0; row < b.glyph.height; row++) {
+      std::memcpy(&pixels[(b.glyph.y + row) * width + b.glyph.x],
+                  &b.pixels[row * b.glyph.width], b.glyph.width);
+    }
+  }
+
+  Glyphs::Header header{Glyphs::magic,
+                        Glyphs::version,
+                        sdf ? Glyphs::Sdf : Glyphs::Bitmap,
+                        uint32_t(size),
+                        sdf ? spread : 0,
+                        width,
+                        height,
+                        uint32_t(bitmaps.size())};
+  std::ofstream fsg(argv[2], std::ios::out | std::ios::binary);
+  fsg.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  for (auto const &b : bitmaps)
+    fsg.write(reinterpret_cast<const char *>(&b.glyph), sizeof(b.glyph));
+  if (!fsg) {
+    std::cout << "Error writing file: " << argv[2] << std::endl;
+    return 1;
+  }
+  std::cout << "Written file: " << argv[2] << std::endl;
+
+  std::ofstream fsa(argv[3], std::ios::out | std::ios::binary);
+  fsa.write(reinterpret_cast<const char *>(pixels.data()), pixels.size());
+  if (!fsa) {
+    std::cout << "Error writing file: " << argv[3] << std::endl;
+    return 1;
+  }
+  std::cout << "Written file: " << argv[3] << " " << width << "x" << height
+            << std::endl;
+  return 0;
+}
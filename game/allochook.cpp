@@ -0,0 +1,23 @@
+/**
+ * @file allochook.cpp
+ * @author Alex Light (dev@3107.ru)
+ * @brief Подмена глобального operator new для подсчета выделений
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Остальные формы new и delete по стандарту вызывают эти.
+ */
+#include <cstdlib>
+#include <new>
+
+#include "memory.h"
+
+void *operator new(std::size_t size) {
+  Memory::add(size);
+  if (auto p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
@@ -0,0 +1,143 @@
+/**
+ * @file arena.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Память для временных данных шага игры
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Арена: память выдается сдвигом указателя и освобождается вся сразу
+ *
+ * Если блока не хватило, недостающее берется из кучи отдельными кусками, а
+ * при сбросе блок увеличивается, так что в установившемся режиме арена не
+ * обращается к куче.
+ */
+class Arena {
+  /**
+   * @brief основной блок
+   *
+   */
+  std::unique_ptr<unsigned char[]> block;
+  /**
+   * @brief размер основного блока
+   *
+   */
+  size_t capacity;
+  /**
+   * @brief занято в основном блоке
+   *
+   */
+  size_t used = 0;
+  /**
+   * @brief куски из кучи, когда основной блок кончился
+   *
+   */
+  std::vector<std::unique_ptr<unsigned char[]>> extra;
+  /**
+   * @brief размер кусков из кучи
+   *
+   */
+  size_t extraBytes = 0;
+
+ public:
+  /**
+   * @brief Construct a new Arena object
+   *
+   * @param capacity начальный размер блока
+   */
+  explicit Arena(size_t capacity)
+      : block(new unsigned char[capacity]), capacity(capacity) {}
+  /**
+   * @brief Выделяет память
+   *
+   * @param bytes размер
+   * @param align выравнивание, не больше выравнивания new
+   * @return void* память
+   */
+  void *allocate(size_t bytes, size_t align) {
+    auto pos = (used + align - 1) & ~(align - 1);
+    if (pos + bytes <= capacity) {
+      used = pos + bytes;
+      return block.get() + pos;
+    }
+    extra.emplace_back(new unsigned char[bytes]);
+    extraBytes += bytes;
+    return extra.back().get();
+  }
+  /**
+   * @brief Освобождает всю выделенную память
+   *
+   */
+  void reset() {
+    if (!extra.empty()) {
+      capacity = (capacity + extraBytes) * 2;
+      block.reset(new unsigned char[capacity]);
+      extra.clear();
+      extraBytes = 0;
+    }
+    used = 0;
+  }
+  /**
+   * @brief Сколько выделено с последнего сброса
+   *
+   * @return size_t байт
+   */
+  size_t size() const { return used + extraBytes; }
+};
+
+/**
+ * @brief Распределитель для контейнеров std из арены
+ *
+ * Освобождение ничего не делает, память вернется при сбросе арены.
+ *
+ * @tparam T тип элементов
+ */
+template <typename T>
+struct ArenaAllocator {
+  using value_type = T;
+  /**
+   * @brief арена
+   *
+   */
+  Arena *arena;
+  /**
+   * @brief Construct a new Arena Allocator object
+   *
+   * @param a арена
+   */
+  ArenaAllocator(Arena &a) : arena(&a) {}
+  /**
+   * @brief Construct a new Arena Allocator object для другого типа
+   *
+   * @param other распределитель
+   */
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.arena) {}
+  T *allocate(size_t n) {
+    return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *, size_t) {}
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+  return a.arena == b.arena;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) {
+  return a.arena != b.arena;
+}
+
+/**
+ * @brief вектор в арене
+ *
+ */
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
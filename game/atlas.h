@@ -0,0 +1,203 @@
+/**
+ * @file atlas.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Упаковка прямоугольников в текстурный атлас
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+/**
+ * @brief Упаковщик прямоугольников по полкам (shelf packing)
+ *
+ * Прямоугольники укладываются слева направо в горизонтальные полки,
+ * новая полка открывается под последней когда в существующие не влезаем.
+ * Когда место кончилось, можно освободить давно не использовавшуюся полку
+ * целиком (LRU).
+ */
+class Atlas {
+  /**
+   * @brief полка атласа
+   *
+   */
+  struct Shelf {
+    /**
+     * @brief верхняя граница полки
+     *
+     */
+    unsigned y;
+    /**
+     * @brief высота полки
+     *
+     */
+    unsigned height;
+    /**
+     * @brief занятая ширина полки
+     *
+     */
+    unsigned x;
+    /**
+     * @brief метка последнего использования
+     *
+     */
+    unsigned stamp;
+    /**
+     * @brief полку нельзя освобождать
+     *
+     */
+    bool pinned;
+  };
+  /**
+   * @brief размер атласа
+   *
+   */
+  std::array<unsigned, 2> size;
+  /**
+   * @brief отступ между прямоугольниками, чтобы соседи не попадали в
+   * фильтрацию текстуры
+   *
+   */
+  unsigned padding;
+  /**
+   * @brief кратность высоты полок, чтобы освобожденную полку могли занять
+   * прямоугольники другой высоты
+   *
+   */
+  unsigned granularity;
+  /**
+   * @brief полки
+   *
+   */
+  std::vector<Shelf> shelves;
+
+ public:
+  /**
+   * @brief позиция прямоугольника в атласе
+   *
+   */
+  using Pos = std::array<unsigned, 2>;
+  /**
+   * @brief Construct a new Atlas object
+   *
+   * @param width ширина атласа
+   * @param height высота атласа
+   * @param padding отступ между прямоугольниками
+   * @param granularity кратность высоты полок
+   */
+  Atlas(unsigned width, unsigned height, unsigned padding = 1,
+        unsigned granularity = 1)
+      : size{width, height}, padding(padding), granularity(granularity) {}
+  /**
+   * @brief размер атласа
+   *
+   * @return const std::array<unsigned, 2>&
+   */
+  const std::array<unsigned, 2> &dimensions() const { return size; }
+  /**
+   * @brief Размещает прямоугольник в атласе
+   *
+   * @param w ширина
+   * @param h высота
+   * @param pos сюда помещаем позицию левого верхнего угла
+   * @param shelf сюда помещаем индекс полки
+   * @param stamp метка использования
+   * @return true разместили
+   * @return false места нет
+   */
+  bool insert(unsigned w, unsigned h, Pos &pos, int &shelf,
+              unsigned stamp = 0) {
+    auto pw = w + padding, ph = h + padding;
+    if (pw > size[0]) return false;
+    // Выберем полку с наименьшим пустым местом по высоте
+    Shelf *best = nullptr;
+    for (auto &s : shelves) {
+      if (s.height >= ph && s.x + pw <= size[0] &&
+          (!best || s.height < best->height))
+        best = &s;
+    }
+    if (!best) {
+      auto y = shelves.empty() ? 0 : shelves.back().y + shelves.back().height;
+      if (y + ph > size[1]) return false;
+      ph = std::min((ph + granularity - 1) / granularity * granularity,
+                    size[1] - y);
+      shelves.push_back(Shelf{y, ph, 0, stamp, false});
+      best = &shelves.back();
+    }
+    pos = Pos{best->x, best->y};
+    shelf = int(best - shelves.data());
+    best->x += pw;
+    best->stamp = stamp;
+    return true;
+  }
+  /**
+   * @brief Размещает прямоугольник в атласе
+   *
+   * @param w ширина
+   * @param h высота
+   * @param pos сюда помещаем позицию левого верхнего угла
+   * @return true разместили
+   * @return false места нет
+   */
+  bool insert(unsigned w, unsigned h, Pos &pos) {
+    int shelf;
+    return insert(w, h, pos, shelf);
+  }
+  /**
+   * @brief Занимает под уже заполненную область полосу во всю ширину атласа,
+   * которую нельзя освобождать
+   *
+   * @param h высота полосы
+   * @return int индекс полки или -1 если не влезает
+   */
+  int reserve(unsigned h) {
+    auto y = shelves.empty() ? 0 : shelves.back().y + shelves.back().height;
+    if (y + h > size[1]) return -1;
+    shelves.push_back(Shelf{y, h, size[0], 0, true});
+    return int(shelves.size() - 1);
+  }
+  /**
+   * @brief Отмечает использование полки
+   *
+   * @param shelf индекс полки
+   * @param stamp метка использования
+   */
+  void touch(int shelf, unsigned stamp) { shelves[shelf].stamp = stamp; }
+  /**
+   * @brief Освобождает давно не использовавшуюся полку, в которую влезет
+   * прямоугольник высотой h
+   *
+   * @param h высота
+   * @param stamp текущая метка, полки с ней освобождать нельзя
+   * @return int индекс освобожденной полки или -1
+   */
+  int evict(unsigned h, unsigned stamp) {
+    int lru = -1;
+    for (size_t i = 0; i < shelves.size(); i++) {
+      auto &s = shelves[i];
+      if (!s.pinned && s.height >= h + padding && s.stamp != stamp &&
+          (lru < 0 || s.stamp < shelves[lru].stamp))
+        lru = int(i);
+    }
+    if (lru >= 0) shelves[lru].x = 0;
+    return lru;
+  }
+  /**
+   * @brief Прямоугольник полки
+   *
+   * @param shelf индекс полки
+   * @return std::array<unsigned, 4> x, y, ширина, высота
+   */
+  std::array<unsigned, 4> rect(int shelf) const {
+    auto &s = shelves[shelf];
+    return {0, s.y, size[0], std::min(s.height, size[1] - s.y)};
+  }
+  /**
+   * @brief Освобождает весь атлас
+   *
+   */
+  void clear() { shelves.clear(); }
+};
@@ -8,19 +8,21 @@
 #pragma once
 
 #include <GL/glew.h>
-#include <GLFW/glfw3.h>
-#include <ft2build.h>
-#include FT_FREETYPE_H
 
 #include <array>
+#include <cctype>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <memory>
 #include <random>
-#include <regex>
 #include <set>
 #include <sstream>
 #include <vector>
@@ -66,6 +68,16 @@ using Segment = std::array<Point, 2>;
  * 
  */
 using Triangle = std::array<Point, 3>;
+/**
+ * @brief треугольник как номера точек полигона
+ *
+ */
+using TriangleIndexes = std::array<uint32_t, 3>;
+/**
+ * @brief сжатая точка: координаты в долях gameSize, от -32767 до 32767
+ *
+ */
+using ShortPoint = std::array<int16_t, AXES>;
 /**
  * @brief Прямоугольник
  * 
@@ -114,11 +126,111 @@ constexpr GLfloat PI = 3.14159265358979323846f;
  * 
  */
 constexpr double processDelay = .02;
+/**
+ * @brief сколько шагов можно догнать за кадр, остальное время после долгой
+ * паузы пропускается
+ *
+ */
+constexpr unsigned maxTicksPerFrame = 5;
+/**
+ * @brief наименьшее время кадра в сек., если vsync не ограничивает частоту
+ *
+ */
+constexpr double frameDelay = 1. / 144.;
+/**
+ * @brief размер очереди событий окна, степень двойки
+ *
+ */
+constexpr size_t inputQueueSize = 1024;
+/**
+ * @brief начальный размер памяти для временных данных шага
+ * 
+ */
+constexpr size_t tickArenaBytes = 64 * 1024;
+/**
+ * @brief формат хранения вершин объектов
+ *
+ */
+enum class VertexFormat {
+  /**
+   * @brief Point, как есть
+   *
+   */
+  Float,
+  /**
+   * @brief ShortPoint, вдвое меньше памяти, точность gameSize / 32767
+   *
+   */
+  Short
+};
+/**
+ * @brief формат вершин препятствий уровня
+ *
+ */
+constexpr VertexFormat levelVertexFormat = VertexFormat::Float;
+/**
+ * @brief сторона куска мира, на куски делятся уровни больше поля
+ *
+ */
+constexpr GLfloat chunkSize = gameSize;
+/**
+ * @brief куски загружаются на таком расстоянии за краем вида и выгружаются
+ * на вдвое большем
+ *
+ */
+constexpr GLfloat streamDistance = chunkSize;
 /**
  * @brief размер символа текста при создании текстур
  * 
  */
-constexpr FT_UInt textBitmapSize = 64;
+constexpr unsigned textBitmapSize = 64;
+/**
+ * @brief режим растеризации символов текста
+ *
+ */
+enum class TextMode {
+  /**
+   * @brief символы растром размера textBitmapSize
+   *
+   */
+  Bitmap,
+  /**
+   * @brief символы полем расстояний (sdf) размера textSdfSize, четкие при
+   * любой высоте текста
+   *
+   */
+  Sdf
+};
+/**
+ * @brief режим растеризации текста по умолчанию
+ *
+ */
+constexpr TextMode textMode = TextMode::Sdf;
+/**
+ * @brief размер символа поля расстояний при создании текстур
+ *
+ */
+constexpr unsigned textSdfSize = 24;
+/**
+ * @brief размах поля расстояний в пикселях вокруг контура символа
+ *
+ */
+constexpr int textSdfSpread = 4;
+/**
+ * @brief сторона атласа символов
+ *
+ */
+constexpr unsigned textAtlasSize = 512;
+/**
+ * @brief кратность высоты полок атласа символов
+ *
+ */
+constexpr unsigned textAtlasShelf = 8;
+/**
+ * @brief лимит памяти кэша растров FreeType в байтах
+ *
+ */
+constexpr unsigned long textCacheBytes = 256 * 1024;
 /**
  * @brief цвет текста 
  * 
@@ -134,6 +246,21 @@ constexpr GLfloat scoreHeight = gameSize * .07f;
  * 
  */
 constexpr Point scorePosition = {gameSize * -.98f, gameSize * .93f};
+/**
+ * @brief цвет текста профилировщика
+ *
+ */
+constexpr Color profilerColor = {1.f, 1.f, .6f, 1.f};
+/**
+ * @brief высота строки профилировщика
+ *
+ */
+constexpr GLfloat profilerHeight = gameSize * .045f;
+/**
+ * @brief период обновления текста профилировщика в сек.
+ *
+ */
+constexpr double profilerDelay = .5;
 /**
  * @brief ускорение спрайта при появлении вектора движения
  * 
@@ -290,8 +417,9 @@ bool less(const T &a, const T &b) {
  * @return T 
  */
 template <class T>
-T operator-(const T &u, const T &v) {
-  return T{u[0] - v[0], u[1] - v[1]};
+std::array<T, AXES> operator-(const std::array<T, AXES> &u,
+                              const std::array<T, AXES> &v) {
+  return {u[0] - v[0], u[1] - v[1]};
 }
 /**
  * @brief оператор сложения векторов
@@ -301,8 +429,9 @@ T operator-(const T &u, const T &v) {
  * @return T 
  */
 template <class T>
-T operator+(const T &u, const T &v) {
-  return T{u[0] + v[0], u[1] + v[1]};
+std::array<T, AXES> operator+(const std::array<T, AXES> &u,
+                              const std::array<T, AXES> &v) {
+  return {u[0] + v[0], u[1] + v[1]};
 }
 /**
  * @brief Оператор умножения вектора на скаляр
@@ -312,8 +441,8 @@ T operator+(const T &u, const T &v) {
  * @return T 
  */
 template <class T>
-T operator*(const T &u, GLfloat m) {
-  return T{u[0] * m, u[1] * m};
+std::array<T, AXES> operator*(const std::array<T, AXES> &u, GLfloat m) {
+  return {u[0] * m, u[1] * m};
 }
 /**
  * @brief оператор умножения векторов
@@ -323,6 +452,7 @@ T operator*(const T &u, GLfloat m) {
  * @return T 
  */
 template <typename T>
-T operator*(const T &u, const T &v) {
+std::array<T, AXES> operator*(const std::array<T, AXES> &u,
+                              const std::array<T, AXES> &v) {
   return {u[0] * v[0], u[1] * v[1]};
 }
@@ -0,0 +1,548 @@
+namespace res {unsigned long font_atlas_len=55296; unsigned char font_atlas_data[]={0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0xf,0xf,0x7,0x0,0x6,0xf,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x5,0x6,0x5,0x1,0x3,0x6,0x6,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x6,0x6,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0xf,0xf,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0xb,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x2,0x2,0x2,0x2,0x2,0x2,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x6,0x6,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xe,0xe,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0xa,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0xb,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xf,0x12,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x23,0x2f,0x2f,0x23,0x12,0x22,0x2f,0x2f,0x24,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x19,0x22,0x25,0x26,0x25,0x21,0x22,0x25,0x26,0x24,0x20,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x13,0x18,0x19,0x14,0xb,0x0,0x0,0xf,0x17,0x1a,0x1b,0x1a,0x16,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x19,0x21,0x26,0x26,0x23,0x1d,0x12,0x4,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x23,0x2f,0x2f,0x23,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xe,0x17,0x1a,0x1a,0x15,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x15,0x1f,0x27,0x2b,0x25,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x14,0x1b,0x19,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1e,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x21,0x18,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x15,0x18,
+0x11,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x20,0x24,0x26,0x26,0x23,0x1c,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x19,0x1d,0x1e,0x1b,0x15,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xd,0x17,0x20,0x21,0x18,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x13,0x1a,0x1e,0x1e,0x1b,0x13,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x15,0x1d,0x20,0x1f,0x1b,0x14,0x9,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x15,0x1c,0x1e,0x1d,0x14,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x22,0x2d,0x2d,0x22,0x11,0x11,0x11,0x11,0xf,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x12,0x19,0x1e,0x20,0x19,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x11,0x16,0x12,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xf,0x1a,0x1d,0x1d,0x1b,0x14,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x1,0x10,0x18,0x1c,0x1e,0x1c,0x17,0xe,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x17,0x1a,0x14,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x17,0x1a,0x13,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x16,0x21,0x23,0x1a,0x9,0x0,0x0,0x0,0x0,0x0,0xa,0x1e,0x2a,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2b,0x2a,0x20,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x11,0x14,0xe,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x14,0x23,0x2e,0x32,0x29,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x19,0x2d,0x3e,0x4e,0x4e,0x3d,0x2c,0x3e,0x4d,0x4e,0x3e,0x24,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x1f,0x35,0x41,0x45,0x46,0x44,0x40,0x42,0x45,0x46,0x44,0x3e,0x2d,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x21,0x31,0x38,0x39,0x34,0x27,0x16,0x18,0x2c,0x37,0x3a,0x3b,0x3a,0x36,0x29,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x1a,0x2a,0x37,0x41,
+0x45,0x46,0x43,0x3c,0x2f,0x1f,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x17,0x2b,0x3e,0x4e,0x4e,0x3d,0x24,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x1e,0x2c,0x36,0x3a,0x3a,0x34,0x29,0x18,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x24,0x32,0x3d,0x46,0x4b,0x41,0x2b,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x1d,0x30,0x3b,0x38,0x28,0x11,0x0,0x0,0x0,0x0,0x0,0x10,0x29,0x3c,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x41,0x33,0x1d,0x2,0x0,0x0,
+0x0,0x0,0x0,0x11,0x25,0x34,0x38,0x2e,0x1c,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x2e,0x3e,0x44,0x46,0x45,0x42,0x39,0x25,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x15,0x29,0x38,0x3c,0x3e,0x3b,0x33,0x27,0x17,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x11,0x1f,0x2b,0x36,0x3f,0x41,0x33,0x1d,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x27,0x32,0x3a,0x3e,0x3e,0x3a,0x32,0x26,0x17,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x25,0x34,0x3c,0x40,0x3f,0x3a,
+0x32,0x26,0x16,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x19,0x28,0x33,0x3b,0x3e,0x3d,0x30,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x26,0x3c,0x4c,0x4c,0x3c,0x31,0x31,0x31,0x31,0x2e,0x21,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x11,0x1e,0x28,0x31,0x38,0x3e,0x40,0x36,0x21,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x1e,0x2f,0x36,0x30,0x20,0x11,0x11,0x11,0x11,0x11,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x1e,0x2c,0x39,0x3d,0x3d,0x3a,0x33,0x28,0x18,0x5,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x1c,0x2d,0x37,0x3c,0x3e,0x3c,0x36,0x2c,0x1f,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x25,0x35,0x3a,0x31,0x1f,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x26,0x36,0x3a,0x30,0x1d,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x1f,0x31,0x40,0x42,0x36,0x1f,0x5,0x0,0x0,0x0,0x3,0x1e,0x37,0x48,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4a,0x3b,0x23,0x7,0x0,0x0,0x0,0x0,0xa,0x20,0x30,0x34,0x2c,0x1c,0xb,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x1e,0x30,0x3f,0x4c,0x51,0x44,0x2c,0xf,0x0,0x0,0x0,0x0,0x2,0x1a,0x31,0x46,0x59,0x6a,0x6a,0x4f,0x45,0x59,0x6a,0x6b,0x50,0x33,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x2f,0x4c,0x60,0x65,0x66,0x64,0x5d,0x62,0x65,0x66,0x64,0x5a,0x41,0x24,0x5,0x0,0x0,0x0,0x0,0xd,0x24,0x3a,0x4d,0x58,0x59,0x52,0x43,0x2e,0x2b,0x45,0x56,0x5a,0x5b,0x5a,0x55,0x42,0x27,0xa,0x0,0x0,0x0,
+0x0,0x4,0x1c,0x33,0x46,0x55,0x60,0x65,0x66,0x62,0x5a,0x4b,0x39,0x22,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x19,0x2f,0x44,0x58,0x6a,0x6a,0x4f,0x33,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x1b,0x35,0x4a,0x55,0x5a,0x59,0x52,0x45,0x2f,0x13,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x25,0x3e,0x50,0x5c,0x65,0x6b,0x58,0x3a,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x20,0x36,0x4a,0x5b,0x55,0xc2,0x23,0x7,0x0,0x0,0x0,0x4,0x20,0x3c,0x56,0x62,0x62,0x62,0x62,0x62,0x62,
+0x62,0x5f,0x4a,0x2d,0xe,0x0,0x0,0x0,0x0,0x13,0x29,0x3e,0x51,0x57,0x49,0x36,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x25,0x42,0x5b,0x64,0x66,0x65,0x62,0x52,0x37,0x19,0x0,0x0,0x0,0x0,0x0,0x2,0x19,0x2e,0x42,0x55,0x5c,0x5e,0x5a,0x51,0x44,0x31,0x1b,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x1d,0x2d,0x3c,0x49,0x54,0x5e,0x5f,0x4a,0x2e,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x29,0x41,0x51,0x59,0x5e,0x5e,0x59,0x50,0x42,0x30,0x1b,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x9,
+0x24,0x3d,0x51,0x5c,0x60,0x5f,0x5a,0x50,0x42,0x30,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x23,0x35,0x45,0x52,0x5b,0x5e,0x5c,0x47,0x2b,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x22,0x3b,0x53,0x69,0x69,0x51,0x51,0x51,0x51,0x51,0x4d,0x3a,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x2e,0x3b,0x47,0x50,0x58,0x5d,0x60,0x4e,0x33,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1b,0x33,0x4b,0x56,0x4d,0x35,0x31,0x31,0x31,0x31,0x31,0x2a,0x19,0x2,0x0,0x0,0x0,0x0,0x0,0x12,0x27,0x3a,0x4a,0x56,
+0x5d,0x5d,0x5a,0x51,0x44,0x32,0x1c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x22,0x36,0x48,0x57,0x5c,0x5e,0x5c,0x55,0x4a,0x39,0x26,0xf,0x0,0x0,0x0,0x0,0x0,0x12,0x29,0x3f,0x52,0x5a,0x4c,0x38,0x22,0xc,0x0,0x0,0x0,0x0,0x0,0x14,0x2b,0x40,0x53,0x59,0x4a,0x36,0x21,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x17,0x29,0x3a,0x4c,0x5d,0x61,0x4c,0x30,0x11,0x0,0x0,0x0,0x10,0x2e,0x4a,0x65,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x6b,0x68,0x4e,0x30,0x11,0x0,0x0,0x0,0x5,0x1f,
+0x37,0x4d,0x54,0x48,0x37,0x27,0x16,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x22,0x37,0x4a,0x5c,0x6a,0x70,0x57,0x38,0x18,0x0,0x0,0x0,0x0,0x15,0x2f,0x47,0x5e,0x73,0x85,0x7a,0x5c,0x5d,0x72,0x84,0x7b,0x5d,0x3e,0x1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x56,0x76,0x84,0x85,0x83,0x6d,0x79,0x85,0x85,0x82,0x69,0x49,0x29,0x9,0x0,0x0,0x0,0x5,0x20,0x3a,0x51,0x67,0x77,0x78,0x6f,0x5c,0x44,0x3b,0x57,0x72,0x7a,0x7b,0x79,
+0x6f,0x50,0x30,0x11,0x0,0x0,0x0,0x0,0x16,0x31,0x4a,0x60,0x72,0x7e,0x84,0x85,0x7f,0x76,0x66,0x4f,0x36,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x2f,0x46,0x5c,0x71,0x84,0x7a,0x5d,0x3e,0x1f,0x0,0x0,0x0,0x0,0x0,0x13,0x27,0x32,0x45,0x62,0x74,0x7a,0x79,0x70,0x5b,0x3c,0x30,0x23,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x11,0x31,0x50,0x6b,0x7a,0x7d,0x7d,0x5d,0x3d,0x1d,0xd,0x9,0x0,0x0,0x0,0x0,0x0,0x6,0x1f,0x37,0x4e,0x63,0x77,0x6a,0x4f,0x32,0x14,0x0,0x0,0x0,0x11,0x2e,0x4c,
+0x68,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x72,0x52,0x32,0x12,0x0,0x0,0x0,0xe,0x27,0x40,0x56,0x6b,0x76,0x63,0x4d,0x36,0x1e,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x31,0x4e,0x6c,0x83,0x85,0x85,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x0,0x17,0x2f,0x47,0x5b,0x6f,0x7c,0x7e,0x7a,0x6e,0x5e,0x48,0x30,0x15,0x0,0x0,0x0,0x0,0x0,0x12,0x26,0x38,0x49,0x58,0x66,0x72,0x7c,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x20,0x3b,0x56,0x6e,0x78,0x7d,0x7e,0x78,0x6e,0x5d,0x49,0x31,0x15,
+0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x35,0x50,0x6a,0x7a,0x80,0x7e,0x79,0x6e,0x5c,0x46,0x2d,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x27,0x3c,0x4f,0x60,0x6f,0x79,0x7e,0x72,0x52,0x32,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x34,0x4f,0x68,0x80,0x76,0x71,0x71,0x71,0x71,0x71,0x67,0x4a,0x2b,0xb,0x0,0x0,0x0,0x0,0x0,0xf,0x2c,0x46,0x58,0x65,0x6f,0x77,0x7d,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x2e,0x47,0x60,0x76,0xa0,0x51,0x51,0x51,0x51,0x51,0x51,0x46,0x2f,0x14,0x0,0x0,0x0,
+0x0,0xf,0x29,0x40,0x54,0x66,0x74,0x7d,0x7d,0x78,0x6f,0x5e,0x49,0x30,0x15,0x0,0x0,0x0,0x0,0x0,0xa,0x23,0x3a,0x4f,0x63,0x74,0x7b,0x7e,0x7b,0x73,0x65,0x53,0x3c,0x23,0x9,0x0,0x0,0x0,0xd,0x27,0x40,0x56,0x6c,0x79,0x65,0x4f,0x39,0x21,0x8,0x0,0x0,0x0,0xf,0x29,0x42,0x59,0x6d,0x77,0x63,0x4e,0x37,0x1f,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x21,0x32,0x44,0x55,0x66,0x78,0x8b,0x55,0x35,0x15,0x0,0x0,0x0,0x1b,0x39,0x57,0x75,0x8b,0x8b,0x8b,0x8b,0x8b,0x8b,0x8b,0x8b,0x8b,0x8b,0x71,0xae,
+0x32,0x12,0x0,0x0,0x0,0x15,0x31,0x4c,0x64,0x74,0x63,0x53,0x42,0x31,0x21,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x20,0x39,0x4f,0x64,0x77,0x86,0x78,0x59,0x39,0x19,0x0,0x0,0x0,0x3,0x22,0x40,0x5c,0x74,0x8a,0x9f,0x7d,0x64,0x74,0x8a,0x9e,0x7d,0x64,0x44,0x25,0x5,0x0,0x0,0x0,0x0,0x9,0x1c,0x26,0x3d,0x5d,0x7c,0x9a,0x9d,0x80,0x62,0x7f,0x9e,0x99,0x7c,0x5e,0x40,0xdd,0x4,0x0,0x0,0x0,0x14,0x31,0x4d,0x67,0x7f,0x92,0x97,0x78,0x70,
+0x54,0x4b,0x66,0x82,0x99,0x9a,0x80,0x67,0x4c,0x2e,0xf,0x0,0x0,0x0,0x5,0x23,0x41,0x5d,0x77,0x8c,0x93,0x7f,0x7f,0x90,0x91,0x7c,0x62,0x46,0x28,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x22,0x40,0x5c,0x73,0x88,0x9d,0x7d,0x64,0x44,0x25,0x5,0x0,0x0,0x0,0xe,0x29,0x41,0x51,0x4f,0x65,0x83,0x99,0x98,0x7c,0x5c,0x52,0x4e,0x3b,0x22,0x7,0x0,0x0,0x0,0x0,0x0,0x14,0x25,0x2d,0x32,0x52,0x72,0x92,0x9d,0x7d,0x5d,0x3d,0x2d,0x2d,0x28,0x18,0x2,0x0,0x0,0x0,0x19,0x33,0x4c,0x64,0x7b,0x8f,0x79,0x5b,0x3c,
+0x1d,0x0,0x0,0x0,0x1c,0x3b,0x58,0x76,0x92,0xa2,0xa2,0xa2,0xa2,0xa2,0x88,0x6b,0x4c,0x2d,0xe,0x0,0x0,0x3,0x1f,0x3a,0x54,0x6d,0x7d,0x8e,0x7a,0x64,0x4b,0x32,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1f,0x3c,0x5a,0x78,0x95,0xa5,0x89,0x6e,0x52,0x35,0x18,0x0,0x0,0x0,0x0,0x10,0x2b,0x44,0x5c,0x74,0x79,0x9b,0x9d,0x97,0x77,0x75,0x5c,0x42,0x25,0x8,0x0,0x0,0x0,0x13,0x2a,0x3f,0x53,0x64,0x74,0x82,0x8f,0x93,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x2e,0x4b,0x67,0x7e,0x96,0x9c,
+0x9d,0x96,0x89,0x76,0x5d,0x41,0x25,0x7,0x0,0x0,0x0,0x0,0xa,0x28,0x45,0x61,0x7c,0x96,0x9f,0x9d,0x96,0x78,0x73,0x5a,0x3d,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x26,0x3e,0x54,0x69,0x7c,0x8b,0x97,0x90,0x71,0x51,0x31,0x11,0x0,0x0,0x0,0x0,0x0,0x8,0x25,0x43,0x60,0x7b,0x94,0x90,0x90,0x90,0x90,0x90,0x85,0x68,0x49,0x2a,0xb,0x0,0x0,0x0,0x0,0x1,0x1d,0x3a,0x57,0x73,0x82,0x8d,0x95,0x85,0x6b,0x4f,0x33,0x15,0x0,0x0,0x0,0x0,0x0,0x9,0x24,0x40,0x5a,0x74,0x7a,0x71,0x71,0x71,0x71,0x71,0x71,
+0x71,0x5b,0x3d,0x1d,0x0,0x0,0x0,0x5,0x21,0x3c,0x55,0x6d,0x80,0x90,0x9c,0x9c,0x97,0x8a,0x76,0x5c,0x40,0x22,0x4,0x0,0x0,0x0,0x1,0x1c,0x36,0x4f,0x67,0x7c,0x8e,0x9a,0x9d,0x9a,0x90,0x7f,0x69,0x50,0x35,0x19,0x0,0x0,0x2,0x1f,0x3a,0x54,0x6d,0x7d,0x91,0x7c,0x66,0x4e,0x35,0x1a,0x0,0x0,0x5,0x21,0x3c,0x56,0x6f,0x85,0x8f,0x7b,0x64,0x4c,0x32,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x19,0x2a,0x3c,0x4d,0x5f,0x70,0x80,0x92,0x72,0x53,0x33,0x13,0x0,0x0,0x4,0x23,0x42,0x61,0x7f,0x9d,0xa0,0xa0,0xa0,0xa0,
+0xa0,0xa0,0xa0,0xa0,0x86,0x68,0x4a,0x2b,0xc,0x0,0x0,0x5,0x23,0x40,0x5d,0x78,0x8e,0x7f,0x6e,0x5d,0x4d,0x3c,0x2b,0x1b,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x2c,0x4b,0x66,0x7c,0x90,0x97,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x5,0x25,0x45,0x64,0x7d,0xa1,0xa5,0x85,0x66,0x7e,0xa0,0xa5,0x85,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x3,0x1e,0x36,0x46,0x48,0x63,0x82,0xa1,0x92,0x75,0x67,0x86,0xa5,0x8f,0x71,0x53,0x3e,0x29,0xf,0x0,0x0,0x0,0x1f,0x3d,
+0x5b,0x78,0x92,0x6a,0xa2,0x9a,0x7d,0x5f,0x5a,0x76,0x91,0xa3,0x88,0x6f,0x54,0x3a,0x20,0x4,0x0,0x0,0x0,0xd,0x2c,0x4c,0x6a,0x87,0xa0,0x7f,0x67,0x64,0x7f,0x9c,0x8c,0x6f,0x50,0x30,0x10,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x25,0x45,0x64,0x7d,0xa0,0xa5,0x85,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x1d,0x3a,0x55,0x6e,0x6c,0x60,0x7f,0x9e,0x95,0x77,0x63,0x70,0x68,0x4e,0x32,0x15,0x0,0x0,0x0,0x0,0xe,0x29,0x41,0x4d,0x4d,0x52,0x72,0x92,0x9d,0x7d,0x5d,0x4d,0x4d,0x4d,0x45,0x2f,0x14,0x0,0x0,0x5,0x25,0x43,
+0x60,0x79,0x91,0xa0,0x7f,0x62,0x43,0x23,0x4,0x0,0x6,0x25,0x44,0x63,0x7e,0x9f,0xa5,0xa5,0xa5,0xa5,0x9b,0x7e,0x61,0x43,0x24,0x6,0x0,0x0,0xc,0x2b,0x4a,0x66,0x7f,0x99,0xa6,0x90,0x78,0x5f,0x42,0x23,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x2b,0x48,0x66,0x83,0xa0,0x97,0x7c,0x5f,0x43,0x27,0xa,0x0,0x0,0x0,0x2,0x20,0x3c,0x57,0x71,0x89,0xa0,0xa9,0xb1,0xb5,0xa1,0x87,0x6d,0x50,0x33,0x14,0x0,0x0,0x6,0x24,0x40,0x57,0x6c,0x7e,0x8f,0x9f,0xad,0x93,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x0,0x0,
+0x1c,0x3a,0x59,0x76,0x92,0xa2,0xa5,0xaf,0xb4,0xa2,0x87,0x6c,0x4e,0x2f,0x11,0x0,0x0,0x0,0x0,0x15,0x34,0x52,0x6f,0x8b,0xa7,0xa8,0xb0,0xb4,0x9f,0x83,0x67,0x47,0x28,0x8,0x0,0x0,0x0,0x0,0x0,0x6,0x20,0x3a,0x53,0x6b,0x7f,0x95,0xa7,0xab,0x8b,0x6c,0x4d,0x2e,0xe,0x0,0x0,0x0,0x0,0x0,0x10,0x2f,0x4e,0x6d,0x89,0xa6,0xb0,0xb0,0xb0,0xb0,0x95,0x7a,0x5c,0x3f,0x21,0x3,0x0,0x0,0x0,0x0,0xf,0x2c,0x48,0x65,0x81,0x9d,0xa7,0x8d,0x74,0x59,0x3e,0x23,0x8,0x0,0x0,0x0,0x0,0x0,0x18,0x34,0x50,0x6c,0x86,
+0x69,0x90,0x90,0x90,0x90,0x90,0x90,0x7d,0x5e,0x3e,0x1e,0x0,0x0,0x0,0x11,0x2f,0x4c,0x68,0x7e,0x99,0x8b,0x87,0x93,0xa6,0xa2,0x86,0x69,0x4b,0x2c,0xc,0x0,0x0,0x0,0xf,0x2c,0x48,0x63,0x7d,0x93,0x99,0x95,0x9b,0xa8,0xac,0x95,0x7c,0x60,0x43,0x25,0x6,0x0,0xb,0x2a,0x4a,0x67,0x7f,0x99,0xa9,0x92,0x7b,0x62,0x44,0x25,0x6,0x0,0xd,0x2d,0x4c,0x68,0x7e,0x9b,0xa7,0x90,0x79,0x5f,0x42,0x23,0x3,0x0,0x0,0x0,0x0,0x11,0x22,0x34,0x45,0x57,0x68,0x79,0x8a,0x9b,0x8b,0x6d,0x4e,0x2f,0xf,0x0,0x0,0x8,0x28,0x48,
+0x98,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x7a,0x5d,0x3f,0x21,0x3,0x0,0x0,0xe,0x2d,0x4c,0x6a,0x87,0xa3,0x99,0x88,0x79,0x68,0x57,0x47,0x36,0x25,0x15,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0xa9,0x96,0x76,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x1f,0x3e,0x5e,0x7d,0x9c,0xa2,0x7d,0x64,0x7d,0x9c,0xa2,0x7d,0x64,0x45,0x25,0x5,0x0,0x0,0x0,0x11,0x2e,0x4b,0x63,0x68,0x6a,0x88,0x68,0x88,0x6a,0x6e,0x8c,0x68,0x7c,0x68,0x68,0x56,
+0x3a,0x1b,0x0,0x0,0x5,0x25,0x45,0x64,0x7e,0x90,0x79,0x8c,0xa3,0x7d,0x64,0x6a,0x85,0xa1,0x91,0x78,0x5d,0x43,0x28,0xe,0x0,0x0,0x0,0x0,0x10,0x30,0x50,0x70,0x8f,0x9e,0x7f,0x61,0x59,0x78,0x97,0x92,0x73,0x53,0x33,0x24,0x24,0x1c,0xb,0x0,0x0,0x0,0x0,0x0,0x1f,0x3e,0x5e,0x7d,0x9c,0xa2,0x7d,0x64,0x45,0x25,0x5,0x0,0x0,0x9,0x28,0x46,0x65,0x7f,0x89,0x7d,0x7a,0x99,0x90,0x74,0x80,0x8c,0x79,0x5c,0x3e,0x20,0x0,0x0,0x0,0x0,0x1d,0x3a,0x56,0x6c,0x6d,0x6d,0x72,0x92,0x9d,0x7d,0x6d,0x6d,0x6d,0x6d,0x5c,
+0x3e,0x1f,0x0,0x0,0x6,0x26,0x46,0x65,0x7e,0xa1,0xa5,0x85,0x65,0x45,0x25,0x5,0x0,0xa,0x2a,0x4a,0x97,0x85,0x85,0x85,0x85,0x85,0x85,0x85,0x70,0x54,0x37,0x1a,0x0,0x0,0x0,0xd,0x2c,0x4c,0x69,0x7d,0x9b,0xaf,0x97,0x7e,0x63,0x44,0x25,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x36,0x54,0x72,0x8f,0xa5,0x89,0x6d,0x51,0x34,0x18,0x0,0x0,0x0,0x0,0xd,0x2c,0x4a,0x67,0x7d,0x9d,0x78,0x76,0x93,0xa5,0xb3,0x96,0x79,0x5b,0x3c,0x1d,0x0,0x0,0xc,0x2c,0x4c,0x6b,0x84,0x91,0x9c,0xa9,0xb3,0x93,0x73,0x53,0x33,
+0x13,0x0,0x0,0x0,0x0,0x0,0xfc,0x24,0x43,0x62,0x7f,0x86,0x83,0x86,0x6d,0xa8,0xb2,0x94,0x75,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5c,0x7a,0x8c,0x87,0x89,0x93,0xa8,0xaa,0x8a,0x6b,0x4b,0x2b,0xb,0x0,0x0,0x0,0x0,0x0,0x16,0x32,0x4d,0x67,0x7f,0x97,0x98,0x90,0xa9,0x89,0x6a,0x4a,0x2a,0xa,0x0,0x0,0x0,0x0,0x0,0x15,0x35,0x55,0x74,0x93,0x9d,0x94,0x94,0x94,0x94,0x84,0x6a,0x4e,0x32,0x15,0x0,0x0,0x0,0x0,0x1,0x1e,0x3a,0x57,0x73,0x8f,0xac,0x94,0x7c,0x61,0x47,0x2d,0x19,0x3,0x0,0x0,0x0,
+0x0,0x8,0x26,0x43,0x60,0x7c,0x97,0xb2,0xb0,0xb0,0xb0,0xb0,0xb0,0x97,0x79,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x1a,0x39,0x58,0x76,0x93,0x95,0x78,0x6a,0x7a,0x92,0xae,0x8e,0x6f,0x4f,0x2f,0xf,0x0,0x0,0x0,0x1c,0x39,0x57,0x73,0x8e,0x97,0x7b,0x76,0x7e,0x72,0xa5,0xa7,0x88,0x6b,0x4c,0x2c,0xc,0x0,0xb,0x2a,0x4a,0x67,0x7f,0x99,0xac,0x95,0x7d,0x63,0x45,0x26,0x6,0x0,0xd,0x2d,0x4c,0x69,0x7e,0x9a,0xac,0x94,0x7c,0x61,0x43,0x23,0x4,0x0,0x0,0x0,0x14,0x2b,0x3d,0x4f,0x60,0x71,0x82,0x93,0x9e,0x8d,0x7d,0x63,0x45,
+0x27,0x8,0x0,0x0,0x4,0x23,0x40,0x59,0x61,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x62,0x60,0x4a,0x2d,0xf,0x0,0x0,0x10,0x30,0x50,0x6f,0x82,0x93,0xa3,0xa4,0x93,0x82,0x73,0x62,0x51,0x41,0x2e,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0xae,0x95,0x75,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x1d,0x3d,0x5d,0x7c,0x9c,0x9a,0x7d,0x5e,0x7c,0x9b,0x9a,0x7d,0x5e,0x3f,0x20,0x0,0x0,0x0,0x0,0x1c,0x3a,0x58,0x76,0x87,0x87,0x87,0x87,0x7f,0x87,
+0x87,0x87,0x87,0x7b,0x87,0x7c,0x5d,0x3e,0x1e,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0x94,0x75,0x7f,0x9c,0x86,0x66,0x7a,0x95,0x9a,0x80,0x66,0x4b,0x31,0x16,0x0,0x0,0x0,0x0,0x0,0xf,0x2f,0x4e,0x6e,0x8c,0xa6,0x8a,0x71,0x61,0x7e,0x9b,0x8b,0x6e,0x4f,0x44,0x44,0x44,0x38,0x22,0x8,0x0,0x0,0x0,0x0,0x1d,0x3d,0x5d,0x7c,0x9c,0x9a,0x7d,0x5e,0x3f,0x20,0x0,0x0,0x0,0xf,0x2f,0x4f,0x6e,0x8c,0xa6,0x99,0x8c,0x97,0x90,0x90,0x9d,0xa2,0x7d,0x65,0x45,0x26,0x6,0x0,0x0,0xa,0x28,0x47,0x64,0x7f,0x8d,0x8d,0x8d,0x96,
+0x9f,0x8d,0x8d,0x8d,0x8d,0x7d,0x5f,0x40,0x20,0x0,0x0,0x0,0x1e,0x3d,0x5c,0x7c,0x9a,0xa2,0x82,0x63,0x44,0x24,0x4,0x0,0x7,0x26,0x44,0x5d,0x65,0x65,0x65,0x65,0x65,0x65,0x65,0x5d,0x44,0x28,0xc,0x0,0x0,0x0,0x5,0x22,0x3d,0x57,0x6f,0x84,0x97,0x7e,0x6b,0x51,0x37,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x25,0x42,0x60,0x7d,0x9b,0x98,0x7c,0x5f,0x42,0x26,0x9,0x0,0x0,0x0,0x0,0x16,0x35,0x54,0x72,0x8f,0x97,0x78,0x6c,0x79,0x8e,0xa7,0x9f,0x7f,0x62,0x42,0x23,0x3,0x0,0x9,0x28,0x45,0x5f,0x6a,0x74,
+0x7f,0x8e,0xa7,0x93,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x0,0x5,0x24,0x44,0x62,0x71,0x68,0x63,0x69,0x7c,0x97,0xb6,0x96,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x20,0x3f,0x5e,0x74,0x6d,0x68,0x6a,0x7c,0x98,0xa2,0x85,0x67,0x48,0x29,0x9,0x0,0x0,0x0,0x0,0x7,0x24,0x41,0x5e,0x79,0x93,0x93,0x7f,0x87,0xa7,0x89,0x6a,0x4a,0x2a,0xa,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x96,0x8f,0x74,0x74,0x74,0x74,0x71,0x58,0x3e,0x23,0x7,0x0,0x0,0x0,0x0,0xf,0x2c,0x49,0x65,0x81,0x9d,0x9b,0x84,0x69,0x60,
+0x57,0x47,0x30,0x18,0x0,0x0,0x0,0x0,0x13,0x32,0x50,0x6d,0x8a,0x9b,0x9b,0x9b,0x9b,0x9b,0x9b,0xa8,0x8c,0x6f,0x51,0x33,0x14,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x98,0x7c,0x64,0x68,0x86,0xa6,0x8a,0x6c,0x4d,0x2d,0xe,0x0,0x0,0x6,0x25,0x44,0x63,0x80,0x9d,0x8f,0x70,0x57,0x62,0x7a,0x95,0xae,0x8e,0x6e,0x4e,0x2e,0xf,0x0,0x2,0x1f,0x3b,0x54,0x6c,0x7f,0x94,0x7f,0x69,0x50,0x37,0x1c,0x0,0x0,0x5,0x22,0x3d,0x56,0x6e,0x7c,0x95,0x80,0x68,0x4f,0x35,0x1a,0x0,0x0,0x0,0x7,0x24,0x41,0x58,0x6a,0x7b,0x8b,
+0x9d,0x95,0x83,0x73,0x62,0x50,0x38,0x1c,0x0,0x0,0x0,0x0,0x18,0x36,0x54,0x71,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x8d,0x53,0x33,0x13,0x0,0x0,0xa,0x28,0x43,0x57,0x68,0x78,0x88,0x98,0xa8,0x9e,0x8d,0x7d,0x6d,0x5b,0x41,0x23,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xad,0x94,0x74,0x55,0x35,0x15,0x0,0x0,0x0,0x6,0x25,0x43,0x62,0x7f,0xa0,0x8d,0x71,0x62,0x80,0x9f,0x8d,0x71,0x54,0x36,0x18,0x0,0x0,0x0,0x5,0x25,0x43,0x63,
+0x80,0x9e,0x77,0x95,0x93,0x75,0xa4,0x7b,0x99,0x8f,0x71,0x91,0x74,0x55,0x36,0x17,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x89,0x9b,0x7e,0x77,0x95,0x7d,0x6f,0x89,0xa3,0x88,0x6f,0x54,0x4d,0x3f,0x2c,0x15,0x0,0x0,0x0,0x0,0x9,0x28,0x46,0x63,0x7f,0x98,0x9c,0x7b,0x76,0x8d,0x91,0x7b,0x64,0x64,0x64,0x64,0x63,0x4f,0x32,0x14,0x0,0x0,0x0,0x6,0x25,0x43,0x63,0x7f,0xa0,0x8d,0x71,0x54,0x36,0x18,0x0,0x0,0x0,0x11,0x31,0x51,0x71,0x8d,0x91,0x95,0x99,0xab,0xa5,0x98,0x94,0x90,0x87,0x68,0x48,0x28,0x8,0x0,0x0,0x11,0x31,
+0x50,0x6f,0x8c,0xa6,0xa6,0xa6,0xaa,0xb0,0xa6,0xa6,0xa6,0x93,0x75,0x57,0x38,0x19,0x0,0x0,0x0,0x19,0x39,0x59,0x79,0x98,0x9a,0x7c,0x5e,0x3f,0x20,0x0,0x0,0x0,0x18,0x30,0x41,0x45,0x45,0x45,0x45,0x45,0x45,0x45,0x41,0x30,0x17,0x0,0x0,0x0,0x0,0x0,0x10,0x2a,0x42,0x58,0x6c,0x7d,0x6b,0x55,0x3e,0x25,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x31,0x4f,0x6c,0x89,0xa6,0x8a,0x6e,0x51,0x35,0x18,0x0,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5b,0x7a,0x99,0x91,0x73,0x53,0x62,0x7d,0x99,0xa4,0x85,0x66,0x46,0x26,0x6,
+0x0,0x0,0x19,0x32,0x42,0x4b,0x56,0x63,0x7f,0x9d,0x93,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x35,0x4b,0x52,0x49,0x43,0x53,0x72,0x92,0xac,0x8f,0x71,0x53,0x33,0x14,0x0,0x0,0x0,0x0,0x17,0x33,0x4a,0x54,0x51,0x61,0x69,0x7e,0x99,0x8e,0x76,0x5c,0x3f,0x23,0x9,0x0,0x0,0x0,0x0,0x11,0x30,0x4e,0x6b,0x87,0x97,0x7e,0x68,0x87,0xa7,0x89,0x6a,0x4a,0x2a,0xf,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x97,0x8e,0x6f,0x6d,0x6a,0x63,0x56,0x45,0x2f,0x16,0x0,0x0,0x0,0x0,0x1,0x1e,0x3a,0x57,
+0x73,0x8f,0xa2,0x88,0x77,0x7e,0x7f,0x73,0x5d,0x45,0x2b,0xf,0x0,0x0,0x0,0x17,0x37,0x57,0x76,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x86,0x9a,0x7f,0x62,0x45,0x28,0xa,0x0,0x0,0x0,0x1e,0x3e,0x5d,0x7d,0x9b,0xa7,0x90,0x7d,0x71,0x8b,0x98,0x7f,0x62,0x45,0x26,0x7,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x89,0xa8,0x90,0x72,0x54,0x50,0x6f,0x8e,0xab,0x8c,0x6d,0x4d,0x2d,0xd,0x0,0x0,0xe,0x27,0x3f,0x55,0x69,0x7a,0x69,0x53,0x3c,0x23,0xa,0x0,0x0,0x0,0x10,0x29,0x41,0x57,0x6b,0x7b,0x69,0x53,0x3b,0x22,0x9,0x0,0x0,0x0,
+0x12,0x30,0x4e,0x6c,0x83,0x95,0x9c,0x8b,0x7b,0x6a,0x58,0x47,0x36,0x23,0xc,0x0,0x0,0x0,0x2,0x21,0x40,0x5f,0x7d,0x9a,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0xa2,0x88,0x6b,0x4c,0x2d,0xe,0x0,0x0,0x0,0x16,0x2b,0x3c,0x4c,0x5d,0x6d,0x7e,0x8d,0x9d,0xa8,0x98,0x86,0x67,0x47,0x27,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0xab,0x92,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x10,0x2e,0x4c,0x6b,0x89,0x97,0x7e,0x63,0x6b,0x88,0x97,0x7d,0x63,0x47,0x2a,0xd,
+0x0,0x0,0x0,0xa,0x2a,0x4a,0x96,0x84,0x84,0x7e,0x84,0x84,0x84,0x84,0x81,0x84,0x84,0x84,0x84,0x68,0x4b,0x2d,0xe,0x0,0x0,0xa,0x29,0x49,0x69,0x88,0xa6,0x88,0x73,0x92,0x7e,0x7f,0x9a,0x93,0x78,0x72,0x73,0x6b,0x59,0x42,0x28,0xc,0x0,0x0,0x0,0xd,0x27,0x3f,0x54,0x6c,0x83,0x97,0x9b,0x8e,0x84,0x77,0x6f,0x84,0x84,0x84,0x84,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x10,0x2e,0x4c,0x6b,0x89,0x97,0x7d,0x63,0x47,0x2a,0xd,0x0,0x0,0x0,0xe,0x2e,0x4c,0x67,0x6f,0x72,0x76,0x87,0xa4,0x9c,0x81,0x75,0x71,0x6d,0x60,
+0x44,0x25,0x6,0x0,0x0,0x15,0x35,0x55,0x75,0x86,0x86,0x86,0x86,0x93,0x9d,0x86,0x86,0x86,0x86,0x6b,0x4d,0x2f,0x11,0x0,0x0,0x0,0x1d,0x3c,0x5c,0x7b,0x9a,0x8f,0x73,0x54,0x36,0x18,0x0,0x0,0x0,0x3,0x16,0x23,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x23,0x16,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2b,0x3f,0x52,0x5d,0x52,0x3e,0x28,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x20,0x3e,0x5b,0x78,0x95,0x9b,0x7e,0x61,0x44,0x27,0xa,0x0,0x0,0x0,0x0,0x2,0x22,0x42,0x61,0x80,0x9f,0x90,0x70,0x50,0x53,0x71,
+0x8f,0xa7,0x87,0x68,0x48,0x28,0x8,0x0,0x0,0x4,0x17,0x24,0x2d,0x3d,0x5d,0x7d,0x9d,0x93,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x1e,0x2d,0x32,0x2f,0x47,0x5f,0x7a,0x97,0x9d,0x7e,0x66,0x49,0x2b,0xc,0x0,0x0,0x0,0x0,0x6,0x1d,0x2e,0x43,0x61,0x7e,0x86,0x94,0x9c,0x79,0x7c,0x68,0x4f,0x34,0x17,0x0,0x0,0x0,0x0,0x1b,0x3a,0x58,0x76,0x94,0x87,0x6c,0x68,0x87,0xa7,0x89,0x6a,0x4a,0x35,0x2c,0x19,0x1,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x94,0x97,0x8d,0x8b,0x89,0x80,0x71,0x5c,0x43,0x28,0xb,
+0x0,0x0,0x0,0xf,0x2c,0x49,0x65,0x81,0x9d,0x99,0x88,0x94,0x9d,0x9d,0x8a,0x72,0x57,0x3a,0x1c,0x0,0x0,0x0,0x11,0x2e,0x49,0x5b,0x5c,0x5c,0x5c,0x5c,0x66,0x7f,0x99,0x8a,0x70,0x54,0x37,0x1b,0x0,0x0,0x0,0x0,0x19,0x38,0x57,0x75,0x91,0xaa,0xa9,0x96,0x87,0x9a,0x84,0x6d,0x53,0x37,0x1b,0x0,0x0,0x0,0xb,0x2b,0x4a,0x6a,0x8a,0xa9,0x9a,0x80,0x68,0x5a,0x71,0x8f,0xa5,0x86,0x68,0x49,0x29,0xa,0x0,0x0,0x0,0x12,0x28,0x3d,0x50,0x5a,0x51,0x3c,0x26,0xf,0x0,0x0,0x0,0x0,0x0,0x14,0x2a,0x3e,0x51,0x5b,0x5a,
+0x49,0x2e,0x13,0x0,0x0,0x0,0x0,0x1a,0x39,0x58,0x77,0x94,0xab,0x8c,0x7a,0x6a,0x5a,0x49,0x39,0x28,0x18,0x7,0x0,0x0,0x0,0x8,0x27,0xb9,0x67,0x85,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x7d,0x60,0x42,0x24,0x6,0x0,0x0,0x0,0x0,0x10,0x20,0x31,0x41,0x52,0x62,0x72,0x82,0x9e,0x9c,0x7f,0x61,0x42,0x23,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x29,0x49,0x69,0x87,0xa7,0x91,0x72,0x52,0x32,0x12,0x0,0x0,0x0,0x1b,0x3a,0x58,0x76,0x92,0x7e,0x6b,0x57,0x75,
+0x92,0x7e,0x6b,0x52,0x37,0x1b,0x0,0x0,0x0,0x0,0x9,0x26,0x43,0x5d,0x64,0x67,0x86,0x64,0x7e,0x64,0x6b,0x89,0x64,0x7f,0x64,0x64,0x58,0x3d,0x21,0x3,0x0,0x0,0x5,0x25,0x44,0x63,0x80,0x9e,0x9a,0x7a,0x90,0x74,0x8e,0x9d,0x7e,0x79,0x8d,0x91,0x7c,0x6f,0x54,0x37,0x19,0x0,0x0,0x0,0x1c,0x39,0x54,0x6c,0x80,0x8f,0x7d,0x94,0x9d,0x86,0x70,0x6e,0x7d,0x8a,0x8a,0x7e,0x75,0x57,0x37,0x17,0x0,0x0,0x0,0x1b,0x3a,0x58,0x76,0x92,0x7e,0x6b,0x51,0x37,0x1b,0x0,0x0,0x0,0x0,0x5,0x21,0x39,0x4a,0x5b,0x71,0x87,0x9e,
+0x8a,0x95,0x97,0x81,0x6b,0x54,0x47,0x33,0x19,0x0,0x0,0x0,0x13,0x31,0x4f,0x65,0x67,0x67,0x67,0x72,0x92,0x9d,0x7d,0x67,0x67,0x67,0x5b,0x40,0x23,0x6,0x0,0x0,0x5,0x24,0x43,0x62,0x80,0x9b,0x7e,0x65,0x48,0x2b,0xe,0x0,0x0,0x0,0x0,0x0,0x3,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x25,0x35,0x3d,0x37,0x26,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x2d,0x4a,0x68,0x84,0xa1,0x8e,0x71,0x54,0x37,0x1a,0x0,0x0,0x0,0x0,0x0,0x5,0x25,0x45,0x65,
+0x84,0xa4,0x90,0x71,0x52,0x4c,0x6c,0x8a,0xa7,0x87,0x68,0x48,0x28,0x8,0x0,0x0,0x0,0x0,0x5,0x1d,0x3d,0x5d,0x7d,0x9d,0x93,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x17,0x2f,0x46,0x5c,0x74,0x76,0x9f,0x88,0x71,0x57,0x3b,0x1f,0x1,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4b,0x6a,0x89,0xa5,0xb0,0x50,0xa6,0x94,0x7b,0x5f,0x40,0x22,0x3,0x0,0x0,0x2,0x22,0x41,0x60,0x7e,0x9a,0x7c,0x5e,0x68,0x87,0xa7,0x89,0x6a,0x55,0x55,0x46,0x2d,0x11,0x0,0x0,0x0,0x12,0x32,0x51,0x71,0x8f,0xae,0xad,0xab,
+0xa8,0x9c,0x78,0x6f,0x53,0x35,0x17,0x0,0x0,0x0,0x1a,0x38,0x56,0x74,0x8f,0xa5,0x99,0x98,0x9f,0xac,0xb7,0x9d,0x80,0x62,0x43,0x24,0x5,0x0,0x0,0x3,0x1c,0x30,0x3b,0x3c,0x3c,0x45,0x5f,0x79,0x92,0x95,0x7b,0x5f,0x44,0x28,0xc,0x0,0x0,0x0,0x0,0x10,0x2e,0x4b,0x65,0x7e,0x93,0xad,0xb1,0xa7,0x8f,0x7d,0x68,0x52,0x38,0x1d,0x0,0x0,0x0,0x8,0x28,0x47,0x66,0x85,0xa4,0xab,0x94,0x7e,0x78,0x7b,0x97,0x9c,0x7e,0x60,0x41,0x22,0x3,0x0,0x0,0xd,0x26,0x3e,0x55,0x6a,0x75,0x61,0x4b,0x35,0x1d,0x4,0x0,0x0,0x0,
+0x0,0x15,0x2d,0x44,0x5a,0x6f,0x8b,0x5a,0x3e,0x20,0x3,0x0,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x90,0xa0,0xa5,0x95,0x84,0x75,0x65,0x54,0x44,0x33,0x20,0x6,0x0,0x0,0x6,0x25,0x44,0x5f,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x6a,0x69,0x53,0x36,0x19,0x0,0x0,0x0,0x0,0x4,0x1c,0x30,0x41,0x52,0x63,0x75,0x85,0x96,0x98,0x87,0x74,0x56,0x38,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x25,0x44,0x64,0x82,0xa1,0x8e,0x6f,0x50,0x30,0x10,0x0,0x0,0x0,0x1d,0x3d,
+0x5c,0x78,0x7f,0x6c,0x56,0x5c,0x78,0x7f,0x6c,0x56,0x3e,0x25,0xa,0x0,0x0,0x0,0x0,0x17,0x34,0x50,0x66,0x68,0x6f,0x8c,0x68,0x7b,0x68,0x72,0x90,0x95,0x77,0x68,0x66,0x51,0x33,0x15,0x0,0x0,0x0,0x0,0x1c,0x3a,0x58,0x73,0x8b,0x98,0x93,0x7f,0x84,0x9f,0x8d,0x73,0x8d,0x65,0xa6,0x9a,0x7d,0x5f,0x41,0x22,0x2,0x0,0x8,0x27,0x46,0x64,0x7f,0x98,0x88,0x6d,0x7f,0x95,0x9c,0x85,0x6f,0x6e,0x8b,0x7f,0x61,0x59,0x48,0x2e,0x11,0x0,0x0,0x0,0x1d,0x3d,0x5c,0x78,0x7f,0x6c,0x56,0x3e,0x24,0xa,0x0,0x0,0x0,0x0,0x0,
+0x12,0x32,0x51,0x70,0x87,0x9e,0x99,0x7d,0x86,0xa2,0x97,0x80,0x67,0x48,0x28,0x8,0x0,0x0,0x0,0x7,0x22,0x39,0x46,0x47,0x47,0x52,0x72,0x92,0x9d,0x7d,0x5d,0x47,0x47,0x41,0x2d,0x14,0x0,0x0,0x0,0xd,0x2c,0x4b,0x6a,0x88,0x86,0x6f,0x55,0x3a,0x1e,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x18,0x1d,0x19,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1d,0x3a,0x57,0x74,0x91,0x9e,0x7f,0x64,0x47,0x2a,0xd,0x0,0x0,
+0x0,0x0,0x0,0x7,0x27,0x47,0x67,0x86,0xa6,0x93,0x74,0x55,0x4a,0x6a,0x89,0xa4,0x85,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0xc,0x1d,0x3d,0x5d,0x7d,0x9d,0x93,0x73,0x53,0x33,0x21,0x17,0x5,0x0,0x0,0x0,0x0,0x0,0x11,0x2b,0x44,0x5c,0x73,0x77,0x9d,0x88,0x73,0x5c,0x44,0x2a,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x30,0x50,0x6f,0x8e,0x92,0x93,0x9b,0xab,0xa4,0x85,0x67,0x47,0x27,0x8,0x0,0x0,0x6,0x26,0x46,0x66,0x85,0x96,0x76,0x75,0x75,0x87,0xa7,0x89,0x75,0x75,0x73,0x58,0x39,0x19,0x0,0x0,0x0,0xd,
+0x2c,0x4b,0x6b,0x88,0x95,0x96,0x9a,0xa3,0xb2,0x99,0x7c,0x5d,0x3d,0x1e,0x0,0x0,0x3,0x22,0x41,0x60,0x7e,0x9c,0x92,0x7b,0x79,0x7f,0x92,0xa8,0xa7,0x87,0x68,0x49,0x29,0x9,0x0,0x0,0x0,0x4,0x14,0x1c,0x23,0x3d,0x58,0x71,0x8a,0x9f,0x7c,0x6a,0x4f,0x34,0x18,0x0,0x0,0x0,0x0,0x0,0x13,0x2f,0x4a,0x63,0x7a,0x70,0x8e,0x9e,0xaf,0xa8,0x94,0x7f,0x64,0x48,0x2a,0xc,0x0,0x0,0x2,0x21,0x3f,0x5e,0x7c,0x96,0xaf,0xae,0x9f,0x97,0x98,0xa6,0x8f,0x73,0x55,0x37,0x19,0x0,0x0,0x2,0x1f,0x39,0x53,0x6c,0x7e,0x8c,0x79,
+0x62,0x4a,0x31,0x17,0x0,0x0,0x0,0xd,0x28,0x42,0x5a,0x72,0x87,0x84,0x68,0x49,0x2a,0xb,0x0,0x0,0x0,0x19,0x37,0x52,0x65,0x75,0x85,0x96,0xa6,0xa0,0x90,0x80,0x70,0x5f,0x4d,0x32,0x15,0x0,0x0,0x0,0x19,0x32,0x45,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x4a,0x49,0x3d,0x27,0xc,0x0,0x0,0x0,0x0,0x13,0x30,0x4a,0x5c,0x6d,0x7e,0x8f,0xa0,0x8f,0x7e,0x6d,0x5b,0x47,0x2c,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3d,0x5c,0x7b,0x94,0x7e,0x66,0x4a,
+0x2b,0xc,0x0,0x0,0x0,0x16,0x32,0x4b,0x5d,0x63,0x53,0x3f,0x4b,0x5c,0x63,0x53,0x3f,0x29,0x11,0x0,0x0,0x0,0x0,0x4,0x22,0x40,0x5e,0x7b,0x87,0x87,0x87,0x87,0x87,0x87,0x7b,0x87,0x87,0x87,0x87,0x76,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x10,0x2c,0x46,0x5f,0x70,0x79,0x77,0x79,0x94,0x99,0x7d,0x7f,0x92,0x7d,0x8e,0xa4,0x85,0x66,0x46,0x26,0x7,0x0,0xd,0x2d,0x4d,0x6d,0x8c,0xa2,0x7e,0x63,0x69,0x80,0x96,0x9b,0x84,0x7d,0x8c,0x71,0x55,0x3a,0x2f,0x1b,0x2,0x0,0x0,0x0,0x15,0x32,0x4b,0x5d,0x63,0x53,0x3f,0x28,
+0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x2e,0x4c,0x67,0x7e,0x8f,0x8b,0x6f,0x78,0x93,0x8a,0x76,0x5e,0x43,0x25,0x5,0x0,0x0,0x0,0x0,0xc,0x1d,0x26,0x27,0x32,0x52,0x72,0x92,0x95,0x7d,0x5d,0x3d,0x27,0x23,0x15,0x0,0x0,0x0,0x0,0xe,0x2e,0x4d,0x6b,0x7e,0x71,0x5a,0x42,0x28,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x2a,0x47,0x64,0x82,0x9e,0x92,
+0x75,0x57,0x3a,0x1d,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x27,0x47,0x67,0x86,0xa6,0x98,0x79,0x5a,0x4c,0x6c,0x8b,0xa0,0x7f,0x62,0x43,0x23,0x3,0x0,0x0,0x0,0xa,0x24,0x39,0x42,0x5d,0x7d,0x9d,0x93,0x73,0x53,0x42,0x41,0x32,0x1c,0x1,0x0,0x0,0x0,0x6,0x22,0x3d,0x58,0x71,0x88,0x9c,0x7a,0x71,0x5c,0x46,0x42,0x3b,0x27,0xe,0x0,0x0,0x0,0x0,0x0,0xf,0x2f,0x4f,0x6c,0x74,0x72,0x75,0x80,0x94,0xa9,0x89,0x6a,0x4a,0x2a,0xa,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0x9e,0x95,0x95,0x95,0x96,0xac,0x97,0x95,0x93,0x75,
+0x56,0x37,0x17,0x0,0x0,0x0,0x6,0x25,0x43,0x62,0x76,0x76,0x77,0x7c,0x7a,0x9a,0xa0,0x80,0x60,0x41,0x21,0x1,0x0,0x8,0x27,0x47,0x67,0x85,0xa5,0x8b,0x6b,0x5a,0x66,0x7d,0x99,0xa8,0x88,0x69,0x49,0x29,0x9,0x0,0x0,0x0,0x0,0x0,0x18,0x34,0x4f,0x6a,0x7d,0x9d,0x91,0x75,0x59,0x3e,0x23,0x8,0x0,0x0,0x0,0x0,0x1,0x20,0x3e,0x5b,0x76,0x71,0x93,0x77,0x7d,0x94,0xa6,0xaa,0x8e,0x71,0x52,0x33,0x13,0x0,0x0,0x0,0x17,0x34,0x50,0x6b,0x7e,0x94,0x97,0x8f,0x87,0x9b,0x9e,0x7e,0x65,0x49,0x2b,0xe,0x0,0x0,0xc,
+0x2b,0x4a,0x66,0x7f,0x98,0xa4,0x8e,0x77,0x5e,0x42,0x23,0x4,0x0,0x0,0x17,0x37,0x54,0x6e,0x87,0x9e,0x8e,0x70,0x50,0x31,0x11,0x0,0x0,0x0,0xb,0x25,0x39,0x4a,0x5a,0x6b,0x7b,0x8b,0x9c,0xab,0x9b,0x8a,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x5,0x19,0x27,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x21,0x10,0x0,0x0,0x0,0x0,0x0,0x1e,0x3d,0x5b,0x77,0x87,0x98,0x96,0x85,0x75,0x63,0x52,0x40,0x2f,0x1a,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,
+0x34,0x52,0x6f,0x7c,0x68,0x51,0x39,0x1f,0x3,0x0,0x0,0x0,0x6,0x1e,0x31,0x3f,0x43,0x39,0x27,0x31,0x3f,0x43,0x39,0x26,0x12,0x0,0x0,0x0,0x0,0x0,0xc,0x2b,0x4a,0x69,0x86,0x62,0x7f,0x9e,0x8b,0x6c,0x65,0x83,0xa1,0x86,0x68,0x8b,0x6d,0x4f,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x1a,0x31,0x45,0x53,0x59,0x70,0x8a,0xa4,0x88,0x6e,0x85,0x94,0x76,0x7f,0x9c,0x87,0x68,0x48,0x28,0x8,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0xa4,0x85,0x68,0x53,0x6a,0x80,0x98,0x9a,0x8f,0x7b,0x61,0x46,0x2f,0x29,0x19,0x2,0x0,0x0,0x0,0x6,
+0x1e,0x31,0x3f,0x43,0x39,0x26,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x20,0x3a,0x50,0x64,0x75,0x7e,0x61,0x69,0x7d,0x70,0x5e,0x49,0x31,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x12,0x32,0x52,0x72,0x80,0x78,0x6b,0x56,0x39,0x1b,0x4,0x0,0x0,0x0,0x0,0x0,0x6,0x24,0x3e,0x53,0x5f,0x58,0x43,0x2d,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x1b,0x38,0x54,0x71,0x8e,0xa3,0x85,0x69,0x4b,0x2e,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x25,0x45,0x65,0x84,0xa4,0x9e,0x7f,0x63,0x54,0x72,0x90,0x99,0x7b,0x5c,0x3c,0x1d,0x0,0x0,0x0,0x0,0x1b,0x37,0x51,0x62,0x62,0x7d,0x9d,0x93,0x73,0x62,0x62,0x5f,0x48,0x2c,0xd,0x0,0x0,0x0,0x13,0x31,0x4e,0x6a,0x7c,0x9d,0x7a,0x70,0x62,0x62,0x62,0x62,0x55,0x3a,0x1c,0x0,0x0,0x0,0x0,0x5,0x1f,0x39,0x51,0x68,0x69,0x59,0x56,0x69,0x87,0xa5,0x86,0x67,0x48,0x28,0x8,0x0,0x0,0xb,0x2b,0x4b,0x6b,0x8a,0xaa,0xb5,0xb5,
+0xb5,0xb5,0xc2,0xb5,0xa6,0x89,0x6c,0x4e,0x2f,0x11,0x0,0x0,0x0,0x0,0x1a,0x36,0x4d,0x5d,0x58,0x58,0x5d,0x6e,0x8a,0x9d,0x7e,0x5e,0x3f,0x1f,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x89,0xa9,0x8d,0x70,0x53,0x52,0x71,0x90,0xa4,0x85,0x66,0x47,0x27,0x8,0x0,0x0,0x0,0x0,0x9,0x27,0x43,0x60,0x7b,0x95,0xa2,0x84,0x68,0x4a,0x2e,0x12,0x0,0x0,0x0,0x0,0x0,0x8,0x28,0x47,0x66,0x7c,0xa1,0x8c,0x6d,0x69,0x7a,0x8d,0xa4,0x95,0x76,0x56,0x36,0x16,0x0,0x0,0x0,0x9,0x24,0x3e,0x55,0x6a,0x78,0x78,0x71,0x8a,0xa5,0x8f,0x74,
+0x57,0x3a,0x1e,0x1,0x0,0x0,0xd,0x2d,0x4c,0x6a,0x7c,0x9c,0xaf,0x97,0x7e,0x63,0x44,0x25,0x5,0x0,0x0,0x19,0x39,0x58,0x77,0x94,0xb2,0x92,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0xd,0x1e,0x2e,0x3f,0x4f,0x60,0x71,0x80,0x91,0xa1,0x8e,0x72,0x54,0x35,0x16,0x0,0x0,0x0,0x0,0x0,0x7,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,0x4,0x0,0x0,0x0,0x0,0x0,0x6,0x26,0x45,0x65,0x7d,0x9e,0x8d,0x7d,0x6b,0x5a,0x48,0x37,0x26,0x14,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x6,0x20,0x38,0x50,0x65,0x77,0x68,0x54,0x3d,0x26,0xd,0x0,0x0,0x0,0x0,0x5,0x15,0x20,0x23,0x1c,0xd,0x15,0x20,0x23,0x1c,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x30,0x50,0x90,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x80,0x84,0x7f,0x62,0x45,0x27,0x8,0x0,0x0,0x0,0x0,0x0,0x4,0x19,0x31,0x4c,0x67,0x81,0x9b,0x94,0x79,0x68,0x87,0x9b,0x7e,0x76,0x94,0x86,0x66,0x47,0x27,0x7,0x0,0xc,0x2c,0x4b,0x6b,0x89,0xa6,0x91,0x78,0x63,0x5c,0x6b,0x82,0x9c,0x98,0x80,0x6a,0x52,0x4f,
+0x45,0x2f,0x14,0x0,0x0,0x0,0x0,0x5,0x15,0x21,0x23,0x1c,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x23,0x38,0x49,0x58,0x60,0x51,0x56,0x5e,0x53,0x44,0x31,0x1c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x2e,0x4b,0x62,0x62,0x5a,0x4e,0x3f,0x29,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x27,0x37,0x3f,0x3b,0x2b,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x29,0x46,0x62,0x7f,0x9b,0x97,0x7b,0x5d,0x3f,0x21,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x21,0x41,0x60,0x7f,0x9d,0xa9,0x8c,0x73,0x63,0x7d,0x9a,0x8f,0x72,0x53,0x35,0x16,0x0,0x0,0x0,0xe,0x2b,0x47,0x63,0x7e,0x82,0x82,0x9d,0x93,0x82,0x82,0x82,0x71,0x51,0x31,0x11,0x0,0x0,0x0,0x1e,0x3c,0x5b,0x78,0x94,0x94,0x82,0x82,0x82,0x82,0x82,0x82,0x60,0x40,0x20,0x0,0x0,0x0,0x0,0x16,0x31,0x4c,0x66,0x7e,0x7d,0x76,0x6e,0x76,0x8e,0x99,0x7c,0x5f,0x41,0x22,0x3,0x0,0x0,0xa,
+0x2a,0x4a,0x6a,0x89,0x96,0x96,0x96,0x96,0x97,0xad,0x97,0x96,0x7c,0x60,0x43,0x25,0x7,0x0,0x0,0x0,0x10,0x2c,0x47,0x60,0x79,0x76,0x6d,0x6b,0x76,0x8d,0x92,0x76,0x58,0x39,0x1a,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x89,0xa8,0x99,0x7f,0x68,0x5c,0x72,0x90,0x9a,0x7d,0x5f,0x40,0x21,0x2,0x0,0x0,0x0,0x0,0x14,0x32,0x51,0x6e,0x8a,0xa6,0x98,0x7a,0x5c,0x3e,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x89,0xa9,0x92,0x76,0x5d,0x61,0x79,0x95,0x92,0x73,0x54,0x34,0x15,0x0,0x0,0x0,0x0,0x11,0x28,0x3d,0x4e,
+0x5a,0x6a,0x83,0x9d,0x9d,0x7f,0x65,0x48,0x2c,0x10,0x0,0x0,0x0,0x5,0x23,0x3e,0x58,0x70,0x85,0x98,0x7e,0x6b,0x52,0x37,0x1c,0x0,0x0,0x0,0x11,0x30,0x4f,0x6e,0x8d,0xac,0x90,0x70,0x51,0x31,0x12,0x0,0x0,0x0,0x0,0x0,0x2,0x13,0x23,0x34,0x45,0x55,0x66,0x76,0x86,0x7e,0x63,0x47,0x2a,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x89,0x84,0x73,0x62,0x50,0x3f,0x2e,0x1c,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x32,0x4c,0x65,0x7d,0x91,0x80,0x6b,0x53,0x39,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x1,0x3,0x0,0x0,0x0,0x1,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x2c,0x49,0x60,0x64,0x75,0x92,0x64,0x7d,0x64,0x79,0x96,0x98,0x79,0x64,0x64,0x54,0x38,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x29,0x43,0x5e,0x78,0x92,0xa0,0x84,0x69,0x67,0x87,0xa6,0x88,0x71,0x90,0x7f,0x62,0x43,0x24,0x4,0x0,0x6,0x24,0x43,0x60,0x7c,0x94,0xa4,0x8e,0x80,0x7c,0x80,
+0x8f,0x82,0x9a,0x96,0x7f,0x72,0x6f,0x5c,0x3e,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x1d,0x2d,0x3a,0x40,0x37,0x3a,0x3e,0x36,0x28,0x17,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x1e,0x35,0x43,0x43,0x3b,0x31,0x23,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x19,0x1f,0x1c,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x37,0x54,0x71,0x8d,0xa9,0x8b,0x6f,0x51,0x33,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x3a,0x59,0x77,0x93,0xaf,0x9e,0x78,0x7e,0x71,0x9f,0x7d,0x66,0x49,0x2b,0xd,0x0,0x0,0x0,0x1b,0x38,0x56,0x73,0x8e,0xa2,0xa2,0xac,0xa6,0xa2,0xa2,0x84,0x67,0x49,0x2b,0xc,0x0,0x0,0x6,0x26,0x46,0x65,0x7e,0xa0,0xa7,0xa2,0xa2,0xa2,0xa2,0x96,0x78,0x5a,0x3b,0x1b,0x0,0x0,0x0,0x9,0x26,0x42,0x5d,0x78,0x92,0x9f,0x93,0x8d,0x92,0xa1,0x88,0x6f,
+0x53,0x36,0x18,0x0,0x0,0x0,0x6,0x25,0x45,0x63,0x77,0x77,0x77,0x77,0x77,0x86,0xa6,0x87,0x77,0x6d,0x51,0x35,0x18,0x0,0x0,0x0,0x1,0x1e,0x3b,0x58,0x73,0x8d,0x94,0x8c,0x8b,0x91,0x9f,0x84,0x69,0x4c,0x2f,0x11,0x0,0x0,0x7,0x26,0x46,0x64,0x7e,0xa0,0xac,0x93,0x7e,0x7c,0x7f,0x9a,0x8a,0x70,0x53,0x36,0x18,0x0,0x0,0x0,0x0,0x0,0x1d,0x3c,0x5b,0x79,0x96,0xb0,0x91,0x72,0x53,0x34,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x29,0x49,0x69,0x87,0xa6,0xa1,0x89,0x77,0x70,0x7d,0x97,0x88,0x6b,0x4d,0x2e,0xf,0x0,
+0x0,0x0,0x0,0x0,0x14,0x2e,0x49,0x63,0x7c,0x95,0xaa,0x8d,0x72,0x56,0x3a,0x1e,0x1,0x0,0x0,0x0,0x0,0x11,0x2b,0x43,0x59,0x6d,0x7e,0x6b,0x55,0x3e,0x25,0xb,0x0,0x0,0x0,0xb,0x2b,0x4b,0x6b,0x8a,0xa7,0x89,0x6b,0x4c,0x2d,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x19,0x29,0x3a,0x4b,0x5b,0x6c,0x69,0x52,0x38,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x2b,0x4b,0x6b,0x7b,0x6a,0x58,0x47,0x35,0x24,0x13,0x1,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x22,0x41,0x5e,0x79,0x91,0xa9,0x97,0x7f,0x66,0x4b,0x2d,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1c,0x34,0x43,0x61,0x7f,0x9c,0x95,0x77,0x65,0x82,0xa0,0x91,0x73,0x54,0x44,0x3b,0x27,0xd,0x0,0x0,0x0,0x0,0x0,0x5,0x20,0x3b,0x55,0x6f,0x89,0xa4,0x90,0x75,0x5a,0x63,0x7f,0x9f,0x98,0x7e,0x94,0x79,0x5b,0x3c,0x1d,0x0,0x0,0x0,0x19,0x35,0x4f,
+0x68,0x7d,0x8d,0x95,0x97,0x93,0x89,0x7a,0x6e,0x87,0x90,0x90,0x90,0x80,0x60,0x40,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x11,0x1c,0x20,0x1a,0x1b,0x1e,0x18,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x1a,0x24,0x23,0x1c,0x13,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x29,0x46,0x62,0x7f,0x9b,0x9d,0x7f,0x62,0x45,0x27,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x30,0x4d,0x69,0x7d,0x9b,0xaf,0xa3,0x9d,0xa4,0x8d,0x74,0x58,0x3c,0x1f,0x1,0x0,0x0,0x8,0x26,0x44,0x62,0x7f,0x9c,0xb0,0xb0,0xb0,0xb0,0xb0,0x94,0x79,0x5c,0x3e,0x20,0x2,0x0,0x0,0xb,0x2b,0x4b,0x6a,0x89,0xa8,0xb0,0xb0,0xb0,0xb0,0xa6,0x8a,0x6e,0x50,0x32,0x13,0x0,0x0,0x0,0x14,0x33,0x50,0x6d,0x89,0xa4,
+0xb6,0xb1,0xad,0x9f,0x8b,0x75,0x5c,0x42,0x27,0xb,0x0,0x0,0x0,0x0,0x1c,0x38,0x4e,0x57,0x57,0x57,0x57,0x67,0x86,0x99,0x7f,0x66,0x53,0x40,0x25,0xa,0x0,0x0,0x0,0xc,0x2a,0x48,0x65,0x7e,0x9e,0xb2,0xab,0xab,0xa2,0x8c,0x73,0x59,0x3e,0x21,0x4,0x0,0x0,0x0,0x1e,0x3d,0x5b,0x77,0x91,0xa6,0xae,0xa0,0x9b,0x9f,0x8f,0x79,0x5f,0x44,0x29,0xc,0x0,0x0,0x0,0x0,0x3,0x23,0x43,0x62,0x7f,0x9f,0xab,0x8f,0x70,0x51,0x31,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x24,0x42,0x60,0x7d,0x97,0xac,0xa2,0x94,0x8f,0x96,
+0x90,0x78,0x5e,0x41,0x24,0x6,0x0,0x0,0x0,0x0,0xa,0x26,0x40,0x5b,0x75,0x8e,0xa8,0x9a,0x7f,0x63,0x47,0x2b,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x2b,0x40,0x53,0x5e,0x53,0x3e,0x28,0x10,0x0,0x0,0x0,0x0,0xf,0x2f,0x4e,0x6e,0x8c,0x9b,0x7e,0x62,0x43,0x25,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x1f,0x2f,0x40,0x4f,0x4e,0x3c,0x24,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x25,0x42,0x5a,0x5f,0x4f,
+0x3d,0x2c,0x1b,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x23,0x42,0x61,0x7b,0x94,0xaa,0x9e,0x85,0x6b,0x4e,0x2e,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x30,0x4e,0x6c,0x89,0xa7,0x8f,0x70,0x70,0x8d,0xaa,0x8b,0x6c,0x4d,0x2e,0x1e,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2f,0x4c,0x67,0x82,0x9b,0x9b,0x80,0x66,0x4a,0x58,0x75,0x8e,0x9d,0x99,0x7d,0x6a,0x4f,0x31,
+0x14,0x0,0x0,0x0,0x9,0x22,0x3a,0x50,0x63,0x70,0x77,0x78,0x74,0x6c,0x5f,0x63,0x70,0x70,0x70,0x70,0x70,0x5c,0x3e,0x1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x38,0x54,0x71,0x8d,0xa9,0x91,0x74,0x56,0x39,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x21,0x3d,0x57,0x6f,0x7d,0x91,0x99,0x98,0x8b,0x78,0x61,0x48,0x2d,0x11,0x0,0x0,0x0,0xf,0x2f,0x4e,0x6d,0x8a,0x90,0x90,0x90,0x90,0x90,0x90,0x85,0x6a,0x4e,0x31,0x14,0x0,0x0,0x0,0xd,0x2d,0x4d,0x6d,0x8c,0x90,0x90,0x90,0x90,0x90,0x90,0x7c,0x60,0x44,0x27,0x9,0x0,0x0,
+0x0,0x17,0x37,0x56,0x75,0x86,0x91,0x97,0x96,0x90,0x7c,0x73,0x5f,0x48,0x2f,0x16,0x0,0x0,0x0,0x0,0x0,0xb,0x22,0x32,0x37,0x37,0x37,0x47,0x67,0x86,0x83,0x6d,0x54,0x3a,0x28,0x13,0x0,0x0,0x0,0x0,0x10,0x30,0x50,0x70,0x88,0x92,0x98,0x99,0x93,0x87,0x75,0x5f,0x47,0x2d,0x12,0x0,0x0,0x0,0x0,0x13,0x30,0x4c,0x65,0x7a,0x8a,0x95,0x98,0x96,0x8a,0x78,0x63,0x4c,0x32,0x18,0x0,0x0,0x0,0x0,0x0,0x7,0x26,0x46,0x66,0x85,0xa5,0x93,0x7f,0x67,0x4d,0x2f,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x36,0x51,
+0x6b,0x80,0x90,0x98,0x99,0x94,0x8a,0x79,0x63,0x4b,0x32,0x16,0x0,0x0,0x0,0x0,0x0,0x16,0x34,0x51,0x6d,0x86,0x93,0x8a,0x7e,0x6f,0x54,0x38,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x26,0x36,0x3e,0x38,0x26,0x11,0x0,0x0,0x0,0x0,0x0,0x16,0x35,0x54,0x73,0x91,0x8c,0x71,0x55,0x38,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x14,0x24,0x30,0x2f,0x23,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x15,0x2d,0x3d,0x40,0x34,0x23,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x35,0x4f,0x67,0x7e,0x92,0x88,0x72,0x59,0x3f,0x24,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x39,0x58,0x77,0x89,0x8a,0x87,0x69,0x7a,0x8a,0x8a,0x7c,0x66,0x47,0x27,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x32,0x52,0x71,0x7c,0x7d,0x7c,0x71,0x56,0x3a,0x49,0x62,
+0x75,0x7e,0x7c,0x6d,0x57,0x3e,0x23,0x7,0x0,0x0,0x0,0x0,0xd,0x23,0x37,0x46,0x52,0x57,0x58,0x55,0x4e,0x42,0x4a,0x50,0x50,0x50,0x50,0x50,0x47,0x30,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x22,0x42,0x62,0x7f,0x8a,0x8b,0x7c,0x68,0x4a,0x2d,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x2a,0x42,0x57,0x69,0x74,0x7a,0x79,0x70,0x5f,0x4b,0x34,0x1b,0x0,0x0,0x0,0x0,0xf,0x2f,0x4e,0x6a,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x3e,0x22,0x6,0x0,0x0,0x0,0xc,0x2c,0x4b,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
+0x6a,0x50,0x35,0x19,0x0,0x0,0x0,0x0,0x10,0x2d,0x48,0x5c,0x6a,0x73,0x78,0x78,0x72,0x68,0x59,0x46,0x31,0x1b,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x13,0x17,0x17,0x27,0x47,0x67,0x7d,0x6b,0x57,0x40,0x28,0xe,0x0,0x0,0x0,0x0,0x0,0xc,0x2b,0x48,0x5e,0x6b,0x73,0x79,0x79,0x75,0x6b,0x5c,0x48,0x32,0x1a,0x0,0x0,0x0,0x0,0x0,0x4,0x1f,0x37,0x4e,0x60,0x6e,0x76,0x79,0x77,0x6f,0x5f,0x4b,0x36,0x1e,0x6,0x0,0x0,0x0,0x0,0x0,0x7,0x27,0x47,0x67,0x86,0x8c,0x7b,0x67,0x51,0x3a,0x22,0x6,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0xa,0x25,0x3e,0x53,0x66,0x73,0x79,0x7a,0x76,0x6d,0x5f,0x4c,0x36,0x1e,0x5,0x0,0x0,0x0,0x0,0x0,0x1a,0x3a,0x5a,0x79,0x7b,0x75,0x6d,0x62,0x54,0x42,0x28,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x19,0x1e,0x1a,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x1f,0x3e,0x5d,0x7b,0x90,0x79,0x60,0x46,0x2a,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x10,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x1e,0x20,0x18,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x22,0x3a,0x51,0x66,0x79,0x71,0x5c,0x45,0x2c,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x35,0x51,0x66,0x6a,0x6a,0x68,0x5d,0x67,0x6a,0x6a,0x68,0x5a,0x3e,0x20,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x29,0x44,0x57,0x5c,
+0x5d,0x5c,0x57,0x45,0x2a,0x34,0x49,0x57,0x5e,0x5e,0x53,0x41,0x2a,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x1b,0x29,0x33,0x37,0x38,0x35,0x2f,0x24,0x2d,0x30,0x30,0x30,0x30,0x30,0x2a,0x1a,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1f,0x3d,0x59,0x68,0x6b,0x6b,0x68,0x5a,0x3e,0x21,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x2a,0x3d,0x4b,0x55,0x5a,0x59,0x52,0x45,0x33,0x1e,0x7,0x0,0x0,0x0,0x0,0x7,0x23,0x3d,0x4e,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x44,0x2c,0x12,0x0,0x0,0x0,0x0,0x4,0x21,0x3a,0x4d,
+0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4e,0x3d,0x23,0x9,0x0,0x0,0x0,0x0,0x1,0x1a,0x30,0x40,0x4b,0x54,0x58,0x58,0x53,0x4a,0x3d,0x2d,0x19,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x21,0x3f,0x58,0x60,0x51,0x3f,0x2a,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x32,0x41,0x4c,0x54,0x59,0x59,0x56,0x4e,0x40,0x2f,0x1b,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x21,0x34,0x44,0x50,0x57,0x59,0x58,0x52,0x44,0x32,0x1e,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x24,0x43,0x62,0x7d,0x71,0x60,0x4e,
+0x3a,0x24,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x26,0x3a,0x49,0x54,0x5a,0x5a,0x56,0x4f,0x43,0x33,0x1f,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x32,0x4c,0x5d,0x5b,0x56,0x4e,0x44,0x38,0x29,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x40,0x5f,0x78,0x79,0x64,0x4c,0x34,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x24,0x39,0x4c,0x5c,0x58,0x44,0x2f,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x25,0x3b,0x47,0x4a,0x4a,0x49,0x42,0x47,0x4a,0x4a,0x48,0x40,0x2d,0x13,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x17,0x2b,0x38,0x3c,0x3d,0x3c,0x38,0x2c,0x17,0x1c,0x2d,0x39,0x3e,0x3e,0x35,0x27,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x13,0x17,0x18,0x16,0x10,0x7,0xe,0x10,0x10,0x10,0x10,0x10,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x2c,0x40,0x48,0x4b,0x4b,0x49,0x40,0x2d,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x21,0x2d,0x36,0x3a,0x3a,0x34,0x28,0x19,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x23,0x2f,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x28,0x17,0x0,0x0,
+0x0,0x0,0x0,0x0,0xd,0x22,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2f,0x23,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x15,0x23,0x2d,0x34,0x38,0x38,0x34,0x2c,0x21,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x2a,0x3c,0x40,0x36,0x25,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x17,0x24,0x2e,0x35,0x39,0x39,0x37,0x2f,0x24,0x15,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x18,0x27,0x31,0x37,0x39,0x38,0x33,0x28,0x18,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x1a,0x38,0x51,0x5d,0x54,0x45,0x34,0x21,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x1e,0x2c,0x35,0x3a,0x3a,0x37,0x30,0x26,0x18,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x1f,0x33,0x3d,0x3c,0x37,0x2f,0x26,0x1a,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x34,0x4b,0x5b,0x5e,0x4c,0x37,0x1f,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x20,0x31,0x3d,0x3a,0x2b,0x17,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x1f,0x27,0x2a,0x2a,0x29,0x24,0x28,0x2a,0x2a,0x29,0x22,0x14,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x19,0x1c,0x1d,0x1d,0x19,0x10,0x0,0x2,0x10,0x1a,0x1e,0x1e,0x17,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x22,0x29,0x2b,0x2b,0x29,0x22,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xf,0x16,0x1a,0x1a,0x15,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0xf,0x10,0x10,0x10,0x10,0x10,
+0x10,0x10,0x10,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xf,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xf,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xe,0x15,0x18,0x18,0x14,0xd,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x1d,0x20,0x19,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xf,0x16,0x19,0x1a,0x17,0x10,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x12,0x17,0x19,0x18,0x14,0xb,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x23,0x36,0x3d,0x36,0x29,0x19,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xe,0x16,0x1a,0x1a,0x17,0x11,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x16,0x1d,0x1c,0x17,0x11,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x1e,0x30,0x3d,0x3e,0x33,0x1f,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x14,0x1d,0x1b,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x7,0xa,0xa,0x9,
+0x5,0x8,0xa,0xa,0x9,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x9,0xb,0xb,0x9,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x18,0x1d,0x19,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x14,0x1e,0x1f,0x17,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xb,0x10,0xd,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xb,0xd,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0xe,0xd,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x7,0xa,0xb,0xa,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x2,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x5,0x5,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x4,0x4,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x6,0x7,0x6,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x6,0x8,0x6,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0xe,0xf,0xe,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x12,0x20,0x2a,0x30,0x2c,0x1d,
+0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x14,0x1e,0x24,0x2b,0x2d,0x24,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x24,0x2e,0x2c,0x1f,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x16,0x19,0x18,0x16,0x12,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x18,0x20,0x27,0x2a,0x2b,0x2a,0x25,0x1e,0x14,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x1d,0x22,0x22,0x22,0x1e,0x10,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x18,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1d,0x19,0x13,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x15,0x1d,0x23,0x25,0x25,0x22,0x1e,0x17,0xe,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x18,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1d,0x19,0x13,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x18,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1a,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x19,0x1e,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1a,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x14,0x1c,0x22,0x24,0x24,0x23,0x1f,0x19,0x12,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x18,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x16,0x1d,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1a,0xe,0x0,0x0,0x0,0x0,0x0,0x9,0x18,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1a,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x1a,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x17,0x7,0x0,0x0,0x0,0x0,0x0,0x9,0x18,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x1e,0x1e,0x1a,0x1e,0x1e,0x1e,0x1e,0x1e,0x1c,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x18,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x17,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x19,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1b,0xf,0x0,0x3,0x14,0x1d,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x16,0x7,0x0,0x0,0x0,0x0,0x0,0xb,0x19,0x1e,0x1e,0x1e,0x1e,0x1e,0x1d,0x14,0x9,0x17,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x16,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xf,0x1a,0x21,0x26,0x27,0x26,0x21,
+0x1a,0xf,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x19,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1d,0x1c,0x17,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xf,0x1a,0x21,0x26,0x28,0x26,0x22,0x1a,0x10,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x18,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1d,0x1a,0x14,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x23,0x2e,0x2f,0x2e,0x24,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x17,0x2e,0x3d,0x48,0x50,0x49,0x35,0x1a,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x26,0x33,0x3c,0x43,0x4a,0x4d,0x3f,0x27,0xb,0x0,0x0,0x0,0x0,0x0,0xd,0x27,0x3f,0x4d,0x4a,0x38,0x21,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x24,0x35,0x39,0x38,0x36,0x31,0x28,0x1d,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x1c,0x2b,0x37,0x3f,0x46,0x4a,0x4b,0x49,0x44,0x3d,0x31,0x23,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x27,0x3b,0x42,
+0x42,0x42,0x3c,0x2a,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x22,0x36,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3c,0x39,0x31,0x26,0x17,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x1a,0x28,0x34,0x3d,0x42,0x45,0x45,0x42,0x3d,0x36,0x2d,0x21,0xe,0x0,0x0,0x0,0x0,0xa,0x22,0x36,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3d,0x38,0x32,0x29,0x1d,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x22,0x36,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x39,0x28,0x10,0x0,0x0,0x0,0x0,
+0xb,0x24,0x36,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x38,0x26,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x19,0x28,0x33,0x3b,0x41,0x44,0x44,0x42,0x3e,0x38,0x31,0x27,0x16,0x0,0x0,0x0,0x0,0x0,0x9,0x22,0x35,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x33,0x3c,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x39,0x28,0x10,0x0,0x0,0x0,0x9,0x22,0x35,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x38,0x26,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x26,0x38,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x33,0x1f,0x6,0x0,0x0,
+0x0,0x9,0x22,0x35,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x38,0x3e,0x3e,0x3e,0x3e,0x3e,0x3c,0x2d,0x17,0x0,0x0,0x0,0x0,0xa,0x23,0x36,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x34,0x20,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x24,0x37,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3a,0x29,0x12,0x1a,0x2f,0x3c,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x33,0x1f,0x5,0x0,0x0,0x0,0xc,0x24,0x37,0x3e,0x3e,0x3e,0x3e,0x3e,0x3d,0x30,0x21,0x35,0x3e,0x3e,0x3e,0x3e,0x3e,0x3d,0x32,0x1d,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x1e,
+0x2d,0x38,0x40,0x45,0x47,0x46,0x41,0x39,0x2d,0x1e,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x24,0x37,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3d,0x3b,0x36,0x2f,0x24,0x15,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x1e,0x2d,0x38,0x41,0x46,0x48,0x46,0x41,0x39,0x2e,0x1f,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x21,0x35,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3d,0x3a,0x33,0x28,0x1a,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x25,0x3e,0x4d,0x4f,0x4e,0x3f,0x27,0xb,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x28,0x44,0x5a,0x67,0x6f,0x62,0x44,0x2f,0x28,0x1e,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x27,0x40,0x50,0x5b,0x63,0x6a,0x6b,0x53,0x35,0x15,0x0,0x0,0x0,0x0,0x2,0x1e,0x39,0x53,0x6b,0x65,0x4f,0x38,0x20,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x23,0x3b,0x51,0x59,0x58,0x56,0x50,0x46,0x38,0x26,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x26,0x38,0x48,0x55,0x5e,0x66,0x6a,0x6b,0x69,0x64,0x5b,0x4e,0x3e,0x2b,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x1c,0x3a,0x55,0x62,0x62,0x62,0x57,0x3d,0x1f,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x36,0x50,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5c,0x58,0x50,0x43,0x32,0x1c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x22,0x35,0x45,0x52,0x5c,0x62,0x65,0x65,0x62,0x5c,0x55,0x4c,0x3b,0x22,0x6,0x0,0x0,0x0,0x18,0x36,0x50,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5c,0x57,0x51,0x47,0x39,0x29,0x16,0x2,0x0,0x0,0x0,0x0,0x0,0x18,0x36,0x50,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,
+0x55,0x3c,0x1f,0x1,0x0,0x0,0x0,0x1a,0x37,0x51,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x53,0x3a,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x23,0x35,0x45,0x51,0x5b,0x61,0x64,0x64,0x62,0x5e,0x58,0x50,0x43,0x2b,0x10,0x0,0x0,0x0,0x0,0x18,0x35,0x4f,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5d,0x4c,0x5a,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x55,0x3c,0x1f,0x1,0x0,0x0,0x18,0x35,0x4f,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x53,0x3a,0x1d,0x0,0x0,0x0,0x0,0x0,0x0,0x1d,0x3a,0x53,0x5e,0x5e,0x5e,0x5e,0x5e,
+0x5e,0x5d,0x4c,0x32,0x14,0x0,0x0,0x0,0x18,0x35,0x4f,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5d,0x53,0x5e,0x5e,0x5e,0x5e,0x5e,0x5a,0x44,0x28,0x9,0x0,0x0,0x0,0x19,0x36,0x50,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5d,0x4d,0x32,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x38,0x51,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x56,0x3e,0x22,0x2b,0x47,0x5b,0x5e,0x5e,0x5e,0x5e,0x5e,0x5d,0x4c,0x31,0x13,0x0,0x0,0x0,0x1a,0x38,0x51,0x5e,0x5e,0x5e,0x5e,0x5e,0x5c,0x48,0x34,0x4e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5d,0x4b,0x2f,0x12,0x0,0x0,
+0x0,0x0,0x0,0x0,0x12,0x26,0x39,0x49,0x57,0x60,0x65,0x67,0x65,0x60,0x57,0x49,0x39,0x27,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x38,0x51,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5d,0x5b,0x56,0x4d,0x41,0x30,0x1b,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x27,0x39,0x4a,0x57,0x60,0x66,0x68,0x65,0x60,0x58,0x4a,0x3a,0x28,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x34,0x4f,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5d,0x59,0x52,0x45,0x35,0x21,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x17,0x34,0x50,0x6b,0x6f,0x6c,
+0x52,0x33,0x1f,0x16,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x1d,0x2e,0x4e,0x6e,0x7c,0x86,0x66,0x53,0x4e,0x46,0x3b,0x26,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x37,0x53,0x6d,0x79,0x7f,0x88,0x71,0x55,0x36,0x16,0x0,0x0,0x0,0x0,0x11,0x2d,0x4a,0x66,0x7f,0x7c,0x65,0x4c,0x34,0x1a,0x0,0x0,0x0,0x0,0x0,0x1,0x1d,0x37,0x50,0x68,0x79,0x78,0x75,0x6f,0x64,0x53,0x3e,0x26,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x2b,0x40,0x53,0x64,0x72,0x7d,0x84,0x89,0x8b,0x88,0x82,0x79,0x6a,0x58,0x44,0x2c,0x14,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x27,0x45,0x63,0x80,0x82,0x82,0x66,0x48,0x2a,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7d,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7c,0x78,0x6e,0x5f,0x49,0x31,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x24,0x3a,0x4f,0x61,0x70,0x7a,0x7e,0x84,0x84,0x7e,0x7c,0x73,0x68,0x4e,0x2f,0xf,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7d,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7c,0x77,0x70,0x65,0x55,0x43,0x2f,0x17,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7d,0x7e,0x7e,0x7e,
+0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x65,0x45,0x25,0x5,0x0,0x0,0x0,0x20,0x40,0x60,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x62,0x42,0x22,0x2,0x0,0x0,0x0,0x0,0xd,0x25,0x3b,0x50,0x61,0x6f,0x79,0x80,0x83,0x84,0x7f,0x7d,0x76,0x6f,0x57,0x39,0x19,0x0,0x0,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x7e,0x7e,0x7e,0x7e,0x7e,0x79,0x59,0x70,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x65,0x45,0x25,0x5,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x63,0x43,0x23,0x3,0x0,0x0,0x0,0x0,0x3,0x23,
+0x43,0x63,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x79,0x59,0x39,0x19,0x0,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x7e,0x7e,0x7e,0x7e,0x7e,0x79,0x62,0x7e,0x7e,0x7e,0x7e,0x7e,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x0,0x1f,0x3f,0x5f,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x40,0x60,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x68,0x48,0x28,0x32,0x52,0x72,0x7e,0x7e,0x7e,0x7e,0x7e,0x79,0x59,0x39,0x19,0x0,0x0,0x0,0x20,0x40,0x60,0x7e,0x7e,0x7e,0x7e,0x7e,0x73,0x53,0x3c,0x5c,0x7b,0x7e,0x7e,0x7e,
+0x7e,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x0,0x10,0x28,0x3f,0x53,0x65,0x74,0x7e,0x84,0x86,0x84,0x7e,0x74,0x65,0x53,0x3f,0x28,0x10,0x0,0x0,0x0,0x0,0x0,0x20,0x40,0x60,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7d,0x7a,0x75,0x6b,0x5c,0x49,0x31,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x28,0x3f,0x53,0x65,0x74,0x7e,0x85,0x87,0x85,0x7f,0x75,0x66,0x55,0x40,0x29,0x11,0x0,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7c,0x78,0x70,0x61,0x4e,0x37,0x1d,0x2,0x0,0x0,0x0,0x0,0x0,0x8,
+0x1e,0x2e,0x42,0x5f,0x7b,0x8e,0x75,0x55,0x40,0x3f,0x32,0x1d,0x3,0x0,0x0,0x0,0x0,0x0,0xd,0x23,0x38,0x49,0x59,0x6e,0x8e,0x86,0x75,0x73,0x6e,0x65,0x53,0x37,0x18,0x0,0x0,0x0,0x0,0x0,0xe,0x2a,0x47,0x63,0x7e,0x97,0x98,0x7d,0x61,0x46,0x2a,0xe,0x0,0x0,0x0,0x0,0x1c,0x3a,0x58,0x75,0x90,0x91,0x79,0x60,0x46,0x2c,0x10,0x0,0x0,0x0,0x0,0x11,0x2d,0x49,0x64,0x7d,0x95,0x97,0x94,0x8c,0x7f,0x6b,0x53,0x38,0x1c,0x0,0x0,0x0,0x0,0x0,0x11,0x2a,0x42,0x58,0x6d,0x7e,0x8e,0x87,0x7d,0x77,0x75,0x77,0x7e,
+0x8a,0x84,0x71,0x5a,0x40,0x26,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x32,0x50,0x6e,0x8b,0xa2,0x8e,0x71,0x53,0x35,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x84,0x93,0x9d,0x78,0x85,0x88,0x93,0x95,0x89,0x76,0x5d,0x42,0x24,0x6,0x0,0x0,0x0,0x0,0x5,0x1f,0x39,0x51,0x67,0x7b,0x8c,0x98,0x8e,0x86,0x7b,0x8a,0x98,0x90,0x71,0x51,0x31,0x11,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x84,0x93,0x9d,0x8a,0x86,0x87,0x8d,0x96,0x8d,0x7f,0x70,0x5c,0x44,0x2b,0x12,0x0,0x0,0x0,0x0,
+0x1e,0x3e,0x5e,0x7e,0x84,0x92,0x9d,0x89,0x86,0x86,0x86,0x86,0x96,0x85,0x65,0x45,0x25,0x5,0x0,0x0,0x0,0x20,0x40,0x60,0x80,0x84,0x92,0x9d,0x8b,0x87,0x87,0x87,0x87,0x99,0x82,0x62,0x42,0x22,0x2,0x0,0x0,0x0,0x6,0x21,0x3a,0x53,0x68,0x7c,0x8b,0x97,0x8f,0x86,0x84,0x87,0x91,0x95,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x84,0x94,0x9d,0x90,0x83,0x79,0x59,0x70,0x83,0x8a,0x9d,0x9a,0x85,0x82,0x65,0x45,0x25,0x5,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x84,0x90,0x9d,0x93,0x84,0x82,0x63,0x43,0x23,
+0x3,0x0,0x0,0x0,0x0,0x3,0x23,0x43,0x63,0x82,0x84,0x92,0x9d,0x8f,0x83,0x79,0x59,0x39,0x19,0x0,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x84,0x92,0x9d,0x90,0x83,0x79,0x62,0x82,0x84,0x9d,0x86,0x83,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x0,0x1f,0x3f,0x5f,0x7f,0x84,0x93,0x9d,0x90,0x83,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x40,0x60,0x80,0x84,0x93,0x8e,0x9d,0x8a,0x6d,0x4f,0x30,0x3a,0x58,0x76,0x94,0x8f,0x9d,0x8d,0x83,0x79,0x59,0x39,0x19,0x0,0x0,0x0,0x20,0x40,0x60,0x80,0x84,0x93,0x9d,0x96,0x7c,
+0x61,0x46,0x5c,0x7c,0x84,0x92,0x90,0x83,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x8,0x23,0x3d,0x55,0x6c,0x7f,0x90,0x95,0x88,0x82,0x86,0x93,0x90,0x7f,0x6c,0x56,0x3d,0x24,0x9,0x0,0x0,0x0,0x0,0x20,0x40,0x60,0x80,0x84,0x92,0x9d,0x8b,0x87,0x89,0x93,0x93,0x87,0x76,0x5e,0x43,0x27,0xa,0x0,0x0,0x0,0x0,0x7,0x23,0x3d,0x56,0x6c,0x7f,0x90,0x95,0x87,0x7e,0x87,0x94,0x91,0x7f,0x6d,0x57,0x3e,0x24,0x9,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x84,0x92,0x9d,0x89,0x87,0x89,0x93,0x97,0x8c,0x7b,0x64,0x49,0x2d,
+0xf,0x0,0x0,0x0,0x0,0x0,0x19,0x35,0x4a,0x5a,0x6d,0x89,0x95,0x75,0x60,0x60,0x5e,0x4a,0x2e,0x10,0x0,0x0,0x0,0x0,0x8,0x22,0x3a,0x50,0x64,0x75,0x7e,0x90,0x94,0x94,0x92,0x8c,0x7b,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x0,0x1b,0x38,0x55,0x72,0x8d,0xa5,0x89,0x6e,0x52,0x35,0x1a,0x0,0x0,0x0,0x0,0x6,0x25,0x44,0x63,0x7f,0x9e,0xa6,0x8c,0x73,0x57,0x3b,0x1f,0x2,0x0,0x0,0x2,0x1f,0x3c,0x59,0x75,0x8f,0xa9,0xb2,0xb4,0xaa,0x98,0x7f,0x64,0x46,0x27,0x8,0x0,0x0,0x0,0x9,0x24,0x3e,0x57,0x6f,0x84,0x8c,
+0x79,0x6a,0x5e,0x57,0x55,0x58,0x61,0x70,0x7d,0x86,0x6d,0x52,0x35,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1f,0x3d,0x5b,0x79,0x96,0x9c,0x99,0x7c,0x5e,0x40,0x22,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x38,0x53,0x62,0x6e,0x8d,0xa6,0x86,0x66,0x6a,0x79,0x93,0xa3,0x88,0x6b,0x4c,0x2d,0xd,0x0,0x0,0x0,0x0,0x14,0x30,0x4c,0x66,0x7e,0x94,0x99,0x7e,0x72,0x67,0x66,0x6c,0x89,0x90,0x71,0x51,0x31,0x11,0x0,0x0,0x0,0x1a,0x38,0x53,0x62,0x6c,0x8c,0xa8,0x88,0x69,0x68,0x6f,0x7c,0x8f,0x9b,0x88,0x72,
+0x58,0x3d,0x22,0x5,0x0,0x0,0x0,0x1a,0x38,0x53,0x62,0x6c,0x8c,0xa7,0x87,0x67,0x67,0x67,0x6f,0x8e,0x85,0x65,0x45,0x25,0x5,0x0,0x0,0x0,0x1b,0x39,0x54,0x63,0x6c,0x8c,0xa8,0x88,0x69,0x68,0x68,0x72,0x91,0x82,0x62,0x42,0x22,0x2,0x0,0x0,0x0,0x16,0x32,0x4d,0x67,0x7f,0x95,0x98,0x7e,0x72,0x68,0x65,0x69,0x80,0x9a,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x19,0x37,0x52,0x62,0x6e,0x8d,0xa7,0x87,0x68,0x62,0x4f,0x5e,0x64,0x80,0x9f,0x96,0x76,0x63,0x58,0x3e,0x21,0x2,0x0,0x0,0x19,0x37,0x52,0x62,0x69,0x88,
+0xa8,0x8d,0x6e,0x63,0x56,0x3c,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x1f,0x3d,0x57,0x63,0x6c,0x8c,0xa7,0x87,0x68,0x62,0x4f,0x33,0x15,0x0,0x0,0x0,0x19,0x37,0x52,0x62,0x6c,0x8c,0xa9,0x89,0x69,0x62,0x56,0x6f,0x87,0x89,0x71,0x64,0x5e,0x46,0x29,0xb,0x0,0x0,0x0,0x1a,0x38,0x54,0x62,0x6d,0x8d,0xa8,0x88,0x69,0x62,0x50,0x34,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x3a,0x54,0x62,0x6e,0x8e,0x80,0x98,0x95,0x77,0x59,0x3b,0x44,0x62,0x80,0x8d,0x8b,0xa6,0x86,0x66,0x61,0x4f,0x33,0x15,0x0,0x0,0x0,0x1c,0x3a,
+0x55,0x63,0x6e,0x8e,0x98,0xa7,0x8c,0x73,0x58,0x50,0x61,0x69,0x89,0x86,0x66,0x60,0x4c,0x31,0x12,0x0,0x0,0x0,0x0,0x17,0x34,0x50,0x6a,0x83,0x98,0x94,0x7d,0x6b,0x63,0x69,0x7a,0x91,0x99,0x83,0x6b,0x50,0x35,0x18,0x0,0x0,0x0,0x0,0x1c,0x3a,0x55,0x63,0x6c,0x8c,0xa8,0x88,0x69,0x6b,0x7a,0x90,0xa2,0x89,0x6f,0x50,0x32,0x13,0x0,0x0,0x0,0x0,0x16,0x33,0x4f,0x6a,0x7e,0x99,0x93,0x7c,0x6a,0x63,0x6a,0x7b,0x92,0x9a,0x83,0x6b,0x50,0x35,0x19,0x0,0x0,0x0,0x0,0x18,0x36,0x52,0x62,0x6c,0x8c,0xa7,0x87,0x67,0x6b,
+0x78,0x8d,0xa7,0x8f,0x74,0x56,0x37,0x18,0x0,0x0,0x0,0x0,0x4,0x23,0x43,0x61,0x76,0x84,0x97,0x95,0x80,0x80,0x80,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0x18,0x34,0x4f,0x68,0x7d,0x8f,0x9f,0xaa,0xa6,0xa6,0xa3,0x88,0x6d,0x51,0x34,0x16,0x0,0x0,0x0,0x0,0xa,0x28,0x45,0x62,0x7f,0x9c,0x97,0x7b,0x5e,0x42,0x26,0xa,0x0,0x0,0x0,0x0,0x7,0x27,0x46,0x65,0x7f,0x99,0xb3,0x9e,0x7e,0x67,0x49,0x2c,0xe,0x0,0x0,0xc,0xd5,0x4a,0x67,0x7d,0x91,0x90,0x93,0x9d,0xaf,0xaa,0x8b,0x6d,0x4d,0x2d,0xd,0x0,0x0,0x0,
+0x18,0x34,0x50,0x6b,0x83,0x8b,0x75,0x60,0x54,0x60,0x68,0x6a,0x64,0x69,0x69,0x6e,0x88,0x7d,0x60,0x42,0x24,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2a,0x48,0x66,0x83,0x89,0x8d,0xa5,0x87,0x6a,0x4c,0x2e,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x26,0x3a,0x4e,0x6e,0x8d,0xa6,0x86,0x66,0x4c,0x6a,0x88,0xa8,0x8f,0x70,0x51,0x31,0x11,0x0,0x0,0x0,0x3,0x21,0x3f,0x5c,0x77,0x92,0xa1,0x86,0x6c,0x56,0x48,0x46,0x65,0x83,0x90,0x71,0x51,0x31,0x11,0x0,0x0,0x0,0xc,0x26,0x3a,0x4c,0x6c,0x8c,0xa8,0x88,0x69,
+0x49,0x51,0x62,0x7b,0x95,0x9e,0x84,0x69,0x4c,0x2f,0x11,0x0,0x0,0x0,0xc,0x26,0x3a,0x4c,0x6c,0x8c,0xa7,0x87,0x67,0x47,0x58,0x6a,0x87,0x85,0x65,0x45,0x25,0x5,0x0,0x0,0x0,0xe,0x27,0x3a,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x49,0x4f,0x6d,0x8c,0x82,0x62,0x42,0x22,0x2,0x0,0x0,0x5,0x23,0x40,0x5d,0x79,0x93,0xa0,0x84,0x6c,0x57,0x49,0x45,0x5b,0x7a,0x99,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0xc,0x25,0x39,0x4e,0x6e,0x8d,0xa7,0x87,0x68,0x48,0x37,0x40,0x60,0x80,0x9f,0x96,0x76,0x56,0x3d,0x2b,0x12,0x0,0x0,
+0x0,0xc,0x25,0x39,0x49,0x69,0x88,0xa8,0x8d,0x6e,0x4e,0x3c,0x29,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x2a,0x3c,0x4c,0x6c,0x8c,0xa7,0x87,0x68,0x48,0x37,0x22,0x8,0x0,0x0,0x0,0xc,0x25,0x39,0x4c,0x6c,0x8c,0xa9,0x89,0x69,0x52,0x6b,0x82,0x8d,0x75,0x5d,0x44,0x40,0x31,0x1a,0x0,0x0,0x0,0x0,0xd,0x26,0x3a,0x4d,0x6d,0x8d,0xa8,0x88,0x69,0x49,0x38,0x23,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x27,0x3a,0x4e,0x6e,0x8e,0x80,0x8e,0x9f,0x81,0x63,0x45,0x4e,0x6c,0x8a,0x82,0x8b,0xa6,0x86,0x66,0x46,0x37,
+0x22,0x8,0x0,0x0,0x0,0xe,0x27,0x3b,0x4e,0x6e,0x8e,0x80,0x96,0x9e,0x83,0x69,0x4e,0x49,0x69,0x89,0x86,0x66,0x46,0x35,0x1f,0x5,0x0,0x0,0x0,0x5,0x23,0x41,0x5f,0x7a,0x96,0x9f,0x83,0x68,0x50,0x43,0x4e,0x65,0x7f,0x9c,0x96,0x7c,0x60,0x43,0x25,0x7,0x0,0x0,0x0,0xe,0x27,0x3b,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x4d,0x65,0x7e,0xa1,0x96,0x78,0x59,0x39,0x19,0x0,0x0,0x0,0x5,0x23,0x41,0x5e,0x7a,0x95,0x9f,0x7e,0x67,0x4f,0x43,0x4e,0x65,0x80,0x9c,0x96,0x7d,0x61,0x44,0x26,0x8,0x0,0x0,0x0,0xb,0x24,0x39,
+0x4c,0x6c,0x8c,0xa7,0x87,0x67,0x4c,0x63,0x7f,0x9f,0x9b,0x7c,0x5c,0x3c,0x1d,0x0,0x0,0x0,0x0,0x4,0x24,0x44,0x64,0x84,0x87,0x9a,0x96,0x87,0x87,0x87,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x6,0x25,0x42,0x5f,0x7b,0x94,0x96,0x8b,0x90,0x88,0x86,0x8a,0x78,0x5d,0x42,0x26,0xa,0x0,0x0,0x0,0x0,0x15,0x33,0x51,0x6f,0x8c,0xa6,0x89,0x6d,0x50,0x34,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x1d,0x39,0x53,0x6d,0x87,0xa2,0xad,0x90,0x73,0x55,0x37,0x18,0x0,0x0,0xd,0x2d,0x4c,0x6a,0x74,0x71,0x70,0x74,0x7d,0x9c,0xa8,0x8a,
+0x6c,0x4c,0x2d,0xd,0x0,0x0,0x7,0x25,0x43,0x60,0x7c,0x93,0x79,0x5f,0x5d,0x6f,0x7e,0x87,0x89,0x7f,0x86,0x87,0x69,0x7a,0x88,0x6a,0x4b,0x2b,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x35,0x53,0x71,0x8e,0x80,0x82,0xa0,0x92,0x75,0x57,0x39,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xa6,0x86,0x66,0x4b,0x69,0x88,0xa8,0x8c,0x6e,0x4f,0x2f,0xf,0x0,0x0,0x0,0xc,0x2b,0x4a,0x69,0x85,0xa2,0x95,0x78,0x5a,0x40,0x2a,0x40,0x5f,0x7e,0x7e,0x71,0x51,0x31,0x11,0x0,0x0,0x0,0x0,0xd,
+0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x49,0x35,0x4f,0x6b,0x88,0xa6,0x93,0x76,0x57,0x39,0x1a,0x0,0x0,0x0,0x0,0xd,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x67,0x56,0x74,0x79,0x6e,0x67,0x5c,0x40,0x22,0x3,0x0,0x0,0x0,0x0,0xe,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x50,0x6c,0x70,0x6e,0x6e,0x5e,0x40,0x21,0x1,0x0,0x0,0xe,0x2c,0x4b,0x6a,0x87,0xa4,0x93,0x76,0x59,0x3f,0x2b,0x36,0x55,0x75,0x7e,0x7a,0x5a,0x3a,0x1a,0x1,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xa7,0x87,0x68,0x48,0x45,0x45,0x60,0x80,0x9f,0x96,
+0x76,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x0,0xd,0x29,0x49,0x69,0x88,0xa8,0x8d,0x6e,0x4e,0x2e,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x68,0x48,0x28,0xb,0x0,0x0,0x0,0x0,0x0,0xd,0x2c,0x4c,0x6c,0x8c,0xa9,0x89,0x69,0x66,0x7f,0x90,0x79,0x61,0x48,0x30,0x21,0x16,0x4,0x0,0x0,0x0,0x0,0x0,0xe,0x2d,0x4d,0x6d,0x8d,0xa8,0x88,0x69,0x49,0x29,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0x80,0x84,0xa2,0x8b,0x6e,0x4f,0x58,0x77,0x94,
+0x79,0x8b,0xa6,0x86,0x66,0x46,0x26,0xa,0x0,0x0,0x0,0x0,0x0,0xf,0x2e,0x4e,0x6e,0x8e,0x80,0x85,0x9f,0x94,0x7a,0x5f,0x49,0x69,0x89,0x86,0x66,0x46,0x26,0x8,0x0,0x0,0x0,0x0,0xd,0x2c,0x4b,0x6a,0x88,0xa5,0x94,0x76,0x58,0x3c,0x23,0x39,0x56,0x74,0x91,0xa6,0x89,0x6c,0x4e,0x2f,0x10,0x0,0x0,0x0,0x0,0xf,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x49,0x5e,0x7e,0x9d,0x9b,0x7b,0x5c,0x3c,0x1c,0x0,0x0,0x0,0xe,0x2c,0x4b,0x6a,0x87,0xa4,0x94,0x76,0x58,0x3b,0x23,0x39,0x56,0x73,0x90,0xa8,0x8b,0x6e,0x4f,0x31,
+0x12,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x67,0x47,0x5e,0x7e,0x9d,0x9b,0x7c,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x2,0x21,0x3f,0x5b,0x67,0x7a,0x9a,0x95,0x75,0x67,0x67,0x65,0x4e,0x30,0x12,0x0,0x0,0x0,0xd,0x2d,0x4c,0x6b,0x89,0x6f,0x7a,0x6e,0x8e,0x86,0x67,0x6c,0x66,0x4c,0x31,0x16,0x0,0x0,0x0,0x0,0x0,0x1e,0x3d,0x5b,0x7a,0x97,0x9b,0x7e,0x60,0x43,0x26,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x26,0x41,0x5c,0x77,0x93,0xb0,0x9b,0x7d,0x5e,0x3f,0x20,0x0,0x0,0x6,0x23,0x3d,0x51,0x54,
+0x52,0x50,0x60,0x7a,0x98,0x96,0x7e,0x62,0x45,0x26,0x7,0x0,0x0,0x12,0x30,0x4e,0x6c,0x89,0x85,0x69,0x5b,0x73,0x88,0x8b,0x7a,0x76,0x90,0x9c,0x7f,0x60,0x72,0x8f,0x70,0x50,0x31,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x22,0x40,0x5e,0x7c,0x92,0x75,0x78,0x95,0x9d,0x80,0x62,0x44,0x26,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xa6,0x86,0x66,0x64,0x76,0x91,0x96,0x7f,0x64,0x47,0x28,0xa,0x0,0x0,0x0,0x12,0x32,0x51,0x71,0x8f,0xac,0x8d,0x6e,0x4f,0x31,0x19,0x36,0x50,0x5e,0x5e,0x5b,0x46,
+0x2a,0xc,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x49,0x29,0x42,0x62,0x80,0xa0,0x9d,0x7e,0x5f,0x40,0x20,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x67,0x62,0x7a,0x8f,0x70,0x50,0x41,0x2e,0x15,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x59,0x75,0x90,0x73,0x53,0x46,0x31,0x16,0x0,0x0,0x0,0x14,0x33,0x53,0x72,0x91,0xaa,0x8b,0x6c,0x4d,0x34,0x42,0x43,0x49,0x5c,0x5e,0x5d,0x4d,0x3f,0x2f,0x17,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xa7,0x87,0x68,
+0x65,0x65,0x65,0x65,0x80,0x9f,0x96,0x76,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0xa8,0x8d,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x68,0x48,0x28,0x8,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa9,0x89,0x69,0x7b,0x92,0x7d,0x64,0x4c,0x33,0x1b,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x2d,0x4d,0x6d,0x8d,0xa8,0x88,0x69,0x49,0x29,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0x80,0x7b,
+0x98,0x95,0x78,0x5a,0x63,0x80,0x8c,0x6f,0x8b,0xa6,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0x80,0x74,0x8e,0xa6,0x8b,0x71,0x56,0x69,0x89,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x13,0x33,0x52,0x71,0x90,0xad,0x8d,0x6e,0x4f,0x30,0x11,0x2d,0x4c,0x6b,0x8a,0xaa,0x93,0x75,0x56,0x36,0x17,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x49,0x60,0x7f,0x9f,0x98,0x79,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x14,0x33,0x53,0x72,0x90,0xac,0x8d,0x6e,0x4f,0x30,0x11,0x2c,0x4c,
+0x6b,0x8a,0xa9,0x95,0x77,0x58,0x38,0x19,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x67,0x56,0x67,0x7d,0xa2,0x90,0x74,0x56,0x38,0x18,0x0,0x0,0x0,0x0,0x0,0x14,0x2e,0x41,0x5a,0x7a,0x9a,0x95,0x75,0x55,0x47,0x46,0x38,0x21,0x6,0x0,0x0,0x0,0x10,0x30,0x50,0x70,0x8f,0x96,0x7f,0x74,0x8e,0x86,0x66,0x4d,0x4b,0x39,0x20,0x9,0x0,0x0,0x0,0x0,0x6,0x26,0x45,0x64,0x7e,0xa0,0x93,0x75,0x56,0x37,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x30,0x4d,0x69,0x7a,0xa4,0xa3,0x83,0x64,0x45,0x25,
+0x5,0x0,0x0,0x10,0x25,0x33,0x34,0x42,0x5b,0x74,0x8b,0x97,0x80,0x6a,0x52,0x37,0x1a,0x0,0x0,0x0,0x19,0x39,0x57,0x76,0x94,0x7b,0x5c,0x6d,0x87,0x91,0x76,0x5f,0x67,0x85,0x97,0x78,0x59,0x6f,0x8f,0x72,0x52,0x32,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2d,0x4b,0x69,0x86,0x88,0x6b,0x6d,0x8b,0xa8,0x8a,0x6d,0x4f,0x31,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xa6,0x86,0x7e,0x7e,0x8e,0x88,0x7c,0x6a,0x54,0x3f,0x26,0xb,0x0,0x0,0x0,0x16,0x36,0x56,0x75,0x94,0xa9,0x89,0x6a,0x4a,0x2a,
+0xa,0x23,0x36,0x3e,0x3e,0x3c,0x2f,0x19,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x49,0x29,0x3e,0x5e,0x7d,0x9c,0xa2,0x83,0x63,0x43,0x23,0x3,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x81,0x81,0x85,0x8f,0x70,0x50,0x30,0x16,0x1,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x79,0x79,0x7d,0x93,0x73,0x53,0x33,0x1a,0x4,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x96,0xa7,0x87,0x67,0x48,0x4a,0x60,0x63,0x63,0x63,0x63,0x63,0x63,0x5c,0x43,0x25,0x7,0x0,0x0,0x0,0xe,
+0x2e,0x4e,0x6e,0x8d,0xa7,0x88,0x84,0x84,0x84,0x84,0x84,0x84,0x9f,0x96,0x76,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0xa8,0x8d,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0xb,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x68,0x48,0x28,0x8,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa9,0x89,0x76,0x8e,0x8a,0x70,0x55,0x3b,0x20,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x2d,0x4d,0x6d,0x8d,0xa8,0x88,0x69,0x49,0x29,0xc,0xe,0xe,0xb,0x0,0x0,0x0,0x0,0x0,0x0,
+0xe,0x2e,0x4e,0x6e,0x8e,0x80,0x70,0x8e,0xa0,0x81,0x64,0x6d,0x8a,0x82,0x6b,0x8b,0xa6,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0x80,0x63,0x7e,0x98,0x9c,0x81,0x67,0x69,0x89,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x95,0xaa,0x8a,0x6a,0x4b,0x2b,0xb,0x28,0x48,0x67,0x87,0xa6,0x99,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x58,0x6c,0x87,0xa5,0x8e,0x72,0x53,0x34,0x15,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x96,0xaa,
+0x8a,0x6a,0x4b,0x2b,0xb,0x27,0x47,0x67,0x86,0xa5,0x9a,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x72,0x74,0x7f,0x93,0x8d,0x7b,0x64,0x49,0x2d,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x3a,0x5a,0x7a,0x9a,0x95,0x75,0x55,0x35,0x27,0x1d,0xb,0x0,0x0,0x0,0x0,0xf,0x2f,0x4e,0x6e,0x8c,0xa9,0x9d,0x91,0x93,0x86,0x74,0x69,0x5c,0x4b,0x36,0x1e,0x5,0x0,0x0,0x0,0xc,0x2b,0x4b,0x6a,0x89,0xa8,0x8d,0x6f,0x4f,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x22,0x3f,0x5e,
+0x7c,0x9a,0xa6,0x86,0x67,0x47,0x27,0x7,0x0,0x0,0x0,0xa,0x13,0x32,0x50,0x6d,0x78,0xa0,0x88,0x6b,0x53,0x3c,0x25,0xb,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7d,0x92,0x73,0x5c,0x7a,0x97,0x85,0x67,0x4d,0x6c,0x8b,0x90,0x72,0x52,0x71,0x8f,0x70,0x50,0x31,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x37,0x56,0x74,0x91,0x7e,0x6c,0x6c,0x80,0x9e,0x95,0x78,0x5a,0x3c,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xa6,0x78,0x85,0x86,0x8c,0x93,0x8d,0x80,0x6c,0x52,0x36,0x1a,0x0,0x0,0x0,0x16,0x36,0x56,
+0x76,0x96,0xa8,0x88,0x69,0x49,0x29,0x9,0x17,0x27,0x2e,0x2e,0x2d,0x21,0xe,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x49,0x29,0x3c,0x5c,0x7c,0x9b,0xa3,0x83,0x64,0x44,0x24,0x4,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x88,0x85,0x85,0x87,0x8f,0x70,0x50,0x30,0x1c,0xc,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xaa,0x90,0x8e,0x8e,0x8e,0x93,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x96,0xa6,0x86,0x67,0x47,0x52,0x72,0x83,0x83,0x83,0x83,0x83,0x83,0x6a,
+0x4a,0x2a,0xa,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xa7,0x87,0x82,0x82,0x82,0x82,0x82,0x82,0x9f,0x96,0x76,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0xa8,0x8d,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x0,0x0,0x7,0x1b,0x28,0x2b,0x2b,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x68,0x48,0x28,0x8,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xaa,0x8d,0x8b,0x9a,0x9c,0x81,0x67,0x4c,0x31,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x2d,0x4d,0x6d,0x8d,0xa8,0x88,0x69,0x49,0x29,0x2b,0x2e,0x2e,
+0x2a,0x1b,0x5,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0x80,0x66,0x83,0xa2,0x8c,0x6e,0x77,0x94,0x78,0x6b,0x8b,0xa6,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0x80,0x61,0x6c,0x86,0xa1,0x92,0x79,0x69,0x89,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0xa9,0x89,0x6a,0x4a,0x2a,0xa,0x26,0x46,0x66,0x85,0xa5,0x9a,0x7b,0x5b,0x3b,0x1b,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x73,0x76,0x83,0x98,0x93,0x7d,0x63,0x47,0x2b,0xc,0x0,0x0,
+0x0,0x17,0x37,0x57,0x77,0x97,0xa9,0x89,0x6a,0x4a,0x2a,0xa,0x26,0x45,0x65,0x85,0xa5,0x9c,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xaa,0x93,0x91,0x93,0x8e,0x7d,0x71,0x62,0x4e,0x37,0x1d,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x3a,0x5a,0x7a,0x9a,0x95,0x75,0x55,0x35,0x20,0x17,0x6,0x0,0x0,0x0,0x0,0x9,0x28,0x46,0x63,0x7d,0x93,0xa2,0xae,0xaf,0x9b,0x91,0x85,0x77,0x63,0x4b,0x31,0x14,0x0,0x0,0x0,0x10,0x30,0x4f,0x6f,0x8e,0xab,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x17,0x37,0x56,0x75,0x94,0xa6,0x86,0x67,0x47,0x27,0x7,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x96,0xa9,0x8b,0x6f,0x54,0x35,0x16,0x0,0x0,0x0,0x0,0x20,0x40,0x60,0x7f,0x90,0x71,0x64,0x83,0x9e,0x7f,0x5f,0x52,0x72,0x90,0x8a,0x6b,0x59,0x77,0x8a,0x6b,0x4c,0x2c,0xd,0x0,0x0,0x0,0x0,0x0,0x6,0x24,0x42,0x60,0x7f,0x99,0x8c,0x8c,0x8c,0x8c,0x99,0xa0,0x82,0x65,0x47,0x29,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xa6,0x86,0x66,0x66,0x6f,0x7e,0x9c,0x98,0x7e,0x61,0x43,
+0x24,0x5,0x0,0x0,0x15,0x35,0x54,0x74,0x93,0xaa,0x8a,0x6b,0x4c,0x2c,0x12,0x2d,0x43,0x4e,0x4e,0x4c,0x3b,0x22,0x6,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x49,0x29,0x3f,0x5e,0x7e,0x9d,0xa1,0x81,0x62,0x42,0x22,0x3,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x67,0x65,0x7b,0x8f,0x70,0x50,0x43,0x38,0x23,0x9,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x6e,0x6e,0x78,0x93,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x15,0x35,0x55,0x74,0x94,0xa8,0x89,0x6a,0x4a,0x52,0x71,
+0x7e,0x81,0x98,0x9b,0x82,0x7d,0x6a,0x4a,0x2a,0xa,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xa7,0x87,0x68,0x62,0x62,0x62,0x62,0x80,0x9f,0x96,0x76,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0xa8,0x8d,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x0,0x0,0x1a,0x34,0x47,0x4b,0x4b,0x46,0x4c,0x6c,0x8c,0xa7,0x87,0x68,0x48,0x28,0x8,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa9,0x89,0x74,0x88,0xa3,0x92,0x78,0x5d,0x42,0x27,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x2d,0x4d,0x6d,0x8d,0xa8,
+0x88,0x69,0x49,0x37,0x4a,0x4e,0x4e,0x47,0x32,0x18,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0x80,0x60,0x7a,0x98,0x96,0x79,0x80,0x8b,0x6e,0x6b,0x8b,0xa6,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0x80,0x61,0x5b,0x76,0x90,0xa4,0x89,0x6f,0x89,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x15,0x35,0x55,0x74,0x93,0xab,0x8b,0x6c,0x4c,0x2c,0xd,0x28,0x48,0x68,0x87,0xa7,0x97,0x78,0x59,0x39,0x19,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xab,0x92,0x91,0x92,0x8f,0x87,0x7a,
+0x67,0x50,0x37,0x1c,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x94,0xab,0x8b,0x6c,0x4c,0x2d,0xd,0x28,0x48,0x67,0x87,0xa7,0x9a,0x7b,0x5b,0x3b,0x1b,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x74,0x7c,0x8e,0x9a,0x89,0x72,0x56,0x39,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x3a,0x5a,0x7a,0x9a,0x95,0x75,0x55,0x3d,0x3f,0x33,0x1d,0x3,0x0,0x0,0x0,0x0,0x1b,0x36,0x50,0x67,0x78,0x85,0x90,0x9a,0xa4,0xaa,0xa2,0x8f,0x78,0x5c,0x3e,0x20,0x1,0x0,0x0,0x11,0x31,0x51,0x71,0x90,0xad,0x8e,0x70,0x50,
+0x31,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x34,0x54,0x74,0x93,0xa3,0x84,0x64,0x44,0x24,0x5,0x0,0x0,0x0,0x0,0x15,0x35,0x54,0x73,0x8e,0x9d,0x86,0x6e,0x53,0x34,0x15,0x0,0x0,0x0,0x0,0x20,0x40,0x60,0x7f,0x90,0x71,0x66,0x86,0x9d,0x7d,0x5d,0x58,0x78,0x96,0x83,0x65,0x66,0x7e,0x80,0x62,0x44,0x25,0x6,0x0,0x0,0x0,0x0,0x0,0x11,0x2f,0x4d,0x6b,0x88,0x86,0x78,0x78,0x78,0x78,0x86,0xa4,0x8e,0x71,0x53,0x35,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xa6,0x86,0x66,0x47,
+0x55,0x73,0x91,0xa6,0x87,0x68,0x49,0x29,0x9,0x0,0x0,0x10,0x2f,0x4e,0x6d,0x8b,0xa9,0x90,0x72,0x53,0x36,0x1c,0x3b,0x59,0x6e,0x6e,0x68,0x4e,0x2f,0xf,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x49,0x29,0x46,0x64,0x83,0xa2,0x99,0x7b,0x5d,0x3d,0x1e,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x67,0x57,0x76,0x7c,0x70,0x63,0x62,0x50,0x35,0x16,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x54,0x74,0x85,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x11,0x30,0x4f,0x6e,
+0x8c,0xaa,0x8e,0x71,0x53,0x46,0x5a,0x5e,0x78,0x97,0x9a,0x7a,0x5e,0x56,0x3f,0x23,0x5,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0xa7,0x87,0x68,0x48,0x42,0x42,0x60,0x80,0x9f,0x96,0x76,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0xa8,0x8d,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x0,0x7,0x27,0x45,0x61,0x6b,0x6b,0x5f,0x4d,0x6d,0x8d,0xa6,0x86,0x67,0x47,0x27,0x7,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa9,0x89,0x69,0x78,0x91,0xa3,0x88,0x6e,0x53,0x38,0x1d,0xb,0x0,0x0,0x0,0x0,0x0,
+0x0,0xd,0x2d,0x4d,0x6d,0x8d,0xa8,0x88,0x69,0x49,0x48,0x65,0x6e,0x6e,0x5f,0x42,0x23,0x4,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0x80,0x60,0x70,0x8d,0xa0,0x82,0x8b,0x81,0x63,0x6b,0x8b,0xa6,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8e,0x80,0x61,0x4a,0x65,0x80,0x99,0x9a,0x80,0x89,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x11,0x30,0x4f,0x6f,0x8d,0xab,0x8f,0x71,0x52,0x34,0x16,0x2f,0x4e,0x6d,0x8b,0xaa,0x91,0x72,0x54,0x34,0x15,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,
+0xa8,0x88,0x72,0x72,0x70,0x69,0x5e,0x4d,0x3a,0x23,0xa,0x0,0x0,0x0,0x0,0x12,0x31,0x51,0x70,0x8d,0xac,0x90,0x72,0x53,0x35,0x18,0x30,0x4e,0x6d,0x8b,0xab,0x92,0x74,0x56,0x36,0x17,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x67,0x62,0x7c,0x98,0x9c,0x80,0x63,0x45,0x26,0xe,0x4,0x0,0x0,0x0,0x0,0x0,0x1a,0x3a,0x5a,0x7a,0x9a,0x95,0x77,0x5c,0x5d,0x5e,0x4a,0x2e,0x10,0x0,0x0,0x0,0x0,0xa,0x23,0x3a,0x4c,0x5c,0x68,0x73,0x8e,0x87,0x8b,0x98,0xa2,0x84,0x65,0x46,0x26,0x6,0x0,0x0,0x11,0x30,
+0x50,0x70,0x8f,0xaf,0x95,0x77,0x59,0x3b,0x1d,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x39,0x58,0x78,0x96,0x9d,0x7f,0x60,0x40,0x21,0x1,0x0,0x0,0x0,0x0,0xe,0x2c,0x49,0x64,0x7a,0x7c,0x71,0x5a,0x41,0x28,0xc,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x94,0x75,0x65,0x84,0xa0,0x7f,0x65,0x6c,0x7e,0x9c,0x7e,0x61,0x78,0x8c,0x72,0x56,0x39,0x1b,0x0,0x0,0x0,0x0,0x0,0x14,0x26,0x3a,0x58,0x76,0x93,0x7d,0x5e,0x58,0x58,0x5e,0x7d,0x9a,0x99,0x7c,0x5e,0x40,0x28,0x17,0x0,0x0,0x0,0x0,0x1,0x18,0x2e,
+0x4e,0x6e,0x8d,0xa6,0x86,0x66,0x46,0x52,0x71,0x90,0xa8,0x88,0x69,0x49,0x29,0x9,0x0,0x0,0x8,0x27,0x45,0x63,0x7f,0x9b,0x9a,0x7d,0x61,0x48,0x36,0x42,0x61,0x80,0x8d,0x71,0x51,0x31,0x11,0x0,0x0,0x0,0x1,0x18,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x49,0x3f,0x55,0x70,0x8d,0xa9,0x8d,0x71,0x53,0x35,0x16,0x0,0x0,0x0,0x1,0x18,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x67,0x4a,0x5b,0x5c,0x73,0x82,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x1,0x18,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x4c,0x62,0x65,0x63,0x4c,0x2f,0x10,0x0,
+0x0,0x0,0x0,0x9,0x28,0x46,0x64,0x7f,0x9d,0x99,0x7d,0x62,0x4a,0x3b,0x58,0x78,0x97,0x9a,0x7a,0x5a,0x3a,0x29,0x12,0x0,0x0,0x0,0x1,0x18,0x2e,0x4e,0x6e,0x8d,0xa7,0x87,0x68,0x48,0x28,0x40,0x60,0x80,0x9f,0x96,0x76,0x56,0x36,0x1d,0x7,0x0,0x0,0x0,0x1,0x18,0x29,0x49,0x69,0x88,0xa8,0x8d,0x6e,0x4e,0x2e,0x1b,0x5,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0x88,0x69,0x51,0x70,0x8f,0xa2,0x82,0x64,0x44,0x25,0x5,0x0,0x0,0x0,0x0,0x1,0x18,0x2c,0x4c,0x6c,0x8c,0xa9,0x89,0x69,0x66,0x80,0x9b,0x99,0x7f,0x65,0x4a,
+0x30,0x29,0x18,0x2,0x0,0x0,0x0,0x2,0x19,0x2d,0x4d,0x6d,0x8d,0xa8,0x88,0x69,0x49,0x4e,0x6d,0x8c,0x84,0x65,0x45,0x25,0x5,0x0,0x0,0x3,0x1a,0x2e,0x4e,0x6e,0x8e,0x80,0x60,0x66,0x83,0xa1,0x8c,0x95,0x77,0x59,0x6b,0x8b,0xa6,0x86,0x66,0x46,0x27,0x15,0x0,0x0,0x0,0x0,0x2,0x19,0x2e,0x4e,0x6e,0x8e,0x80,0x61,0x41,0x53,0x6e,0x88,0xa3,0x91,0x89,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0xa,0x29,0x47,0x65,0x7d,0x9f,0x98,0x7a,0x5e,0x42,0x2d,0x3e,0x5a,0x77,0x93,0xa1,0x85,0x69,0x4b,0x2d,0xe,0x0,0x0,
+0x0,0x1,0x18,0x2c,0x4c,0x6c,0x8c,0xa8,0x88,0x69,0x52,0x50,0x4a,0x40,0x33,0x21,0xd,0x0,0x0,0x0,0x0,0x0,0xb,0x29,0x48,0x66,0x83,0x9f,0x99,0x7c,0x60,0x45,0x31,0x3f,0x5a,0x77,0x94,0xa3,0x86,0x6a,0x4c,0x2e,0x10,0x0,0x0,0x0,0x0,0x17,0x2c,0x4c,0x6c,0x8c,0xa7,0x87,0x67,0x52,0x6f,0x8c,0xa8,0x8a,0x6d,0x4e,0x30,0x2d,0x20,0xb,0x0,0x0,0x0,0x0,0x1a,0x3a,0x5a,0x7a,0x98,0x9f,0x7b,0x7c,0x7d,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0x2,0x1b,0x33,0x49,0x52,0x4e,0x6e,0x8e,0x86,0x6f,0x7f,0x9d,0x86,0x67,
+0x47,0x27,0x7,0x0,0x0,0xd,0x2d,0x4d,0x6c,0x8a,0xaa,0x9e,0x7f,0x65,0x48,0x2d,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x23,0x41,0x5f,0x7e,0x9c,0x96,0x78,0x59,0x3a,0x1b,0x0,0x0,0x0,0x0,0x0,0x12,0x2c,0x44,0x5b,0x6f,0x72,0x5e,0x49,0x32,0x1a,0x1,0x0,0x0,0x0,0x0,0x1a,0x3a,0x59,0x78,0x96,0x7d,0x5f,0x7b,0x96,0x91,0x7e,0x86,0x7e,0x9d,0x7d,0x7e,0x8d,0x78,0x60,0x46,0x2a,0xe,0x0,0x0,0x0,0x0,0xd,0x29,0x41,0x4f,0x63,0x80,0x8f,0x72,0x54,0x3e,0x3d,0x54,0x72,0x8f,0xa4,0x86,0x69,0x50,0x44,0x2d,
+0x11,0x0,0x0,0x0,0x13,0x2e,0x45,0x50,0x6e,0x8d,0xa6,0x86,0x66,0x55,0x5f,0x79,0x96,0x9f,0x7e,0x63,0x45,0x25,0x6,0x0,0x0,0x0,0x1c,0x39,0x55,0x71,0x8a,0xa2,0x8d,0x75,0x61,0x55,0x51,0x68,0x86,0x90,0x71,0x51,0x31,0x11,0x0,0x0,0x0,0x13,0x2e,0x45,0x50,0x6c,0x8c,0xa8,0x88,0x69,0x55,0x5c,0x6b,0x81,0x9b,0x95,0x7d,0x62,0x46,0x2a,0xc,0x0,0x0,0x0,0x13,0x2e,0x45,0x50,0x6c,0x8c,0xa7,0x87,0x67,0x55,0x55,0x58,0x77,0x96,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x12,0x2e,0x45,0x50,0x6c,0x8c,0xa8,0x88,0x69,0x50,
+0x46,0x45,0x44,0x36,0x1f,0x5,0x0,0x0,0x0,0x0,0x0,0x1d,0x3a,0x56,0x71,0x8b,0xa2,0x8e,0x77,0x64,0x57,0x58,0x78,0x97,0x9a,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x12,0x2e,0x45,0x50,0x6e,0x8d,0xa7,0x87,0x68,0x4f,0x42,0x4d,0x60,0x80,0x9f,0x96,0x76,0x56,0x49,0x34,0x19,0x0,0x0,0x0,0x12,0x2e,0x45,0x50,0x69,0x88,0xa8,0x8d,0x6e,0x50,0x48,0x32,0x17,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0x8d,0x6f,0x59,0x77,0x95,0x99,0x7c,0x5e,0x3e,0x1f,0x0,0x0,0x0,0x0,0x0,0x12,0x2e,0x45,0x50,0x6c,0x8c,0xa9,0x89,0x69,
+0x55,0x70,0x89,0xa4,0x90,0x76,0x5b,0x50,0x45,0x2f,0x13,0x0,0x0,0x0,0x14,0x2f,0x46,0x50,0x6d,0x8d,0xa8,0x88,0x69,0x55,0x55,0x71,0x90,0x84,0x65,0x45,0x25,0x5,0x0,0x0,0x15,0x30,0x46,0x50,0x6e,0x8e,0x80,0x60,0x5c,0x7a,0x97,0xa7,0x8a,0x6d,0x4f,0x6b,0x8b,0xa6,0x86,0x66,0x4f,0x42,0x2a,0xe,0x0,0x0,0x0,0x14,0x2f,0x45,0x4f,0x6e,0x8e,0x80,0x61,0x4d,0x42,0x5d,0x78,0x92,0xa4,0x9d,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x0,0x1e,0x3c,0x58,0x74,0x8e,0xa4,0x88,0x6f,0x58,0x4d,0x56,0x6b,0x85,0xa0,0x90,
+0x76,0x5b,0x3e,0x21,0x4,0x0,0x0,0x0,0x13,0x2e,0x45,0x50,0x6c,0x8c,0xa8,0x88,0x69,0x50,0x46,0x30,0x22,0x16,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1f,0x3c,0x58,0x74,0x8d,0xa5,0x8b,0x72,0x5c,0x50,0x57,0x6c,0x85,0xa0,0x91,0x78,0x5d,0x40,0x23,0x5,0x0,0x0,0x0,0x11,0x2d,0x44,0x50,0x6c,0x8c,0xa7,0x87,0x67,0x4f,0x65,0x7d,0xa0,0x93,0x77,0x59,0x50,0x4c,0x39,0x1f,0x2,0x0,0x0,0x0,0x16,0x35,0x54,0x70,0x7b,0x92,0x92,0x8d,0x85,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0x14,0x2f,0x48,0x61,0x72,0x69,0x6e,
+0x8e,0x86,0x71,0x80,0x9c,0x80,0x62,0x43,0x24,0x4,0x0,0x0,0x8,0x27,0x46,0x65,0x83,0xa0,0xab,0x8f,0x74,0x58,0x3e,0x23,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x2f,0x4d,0x6a,0x87,0xa5,0x8c,0x6f,0x51,0x32,0x13,0x0,0x0,0x0,0x0,0x8,0x24,0x3f,0x59,0x71,0x87,0x8a,0x76,0x5f,0x46,0x2e,0x13,0x0,0x0,0x0,0x0,0x13,0x32,0x50,0x6e,0x8b,0x88,0x6d,0x6a,0x80,0x8b,0x87,0x7a,0x75,0x8a,0x8d,0x84,0x75,0x62,0x4b,0x33,0x19,0x0,0x0,0x0,0x0,0x0,0x16,0x36,0x54,0x6e,0x73,0x8b,0x85,0x72,0x6b,0x50,0x4e,0x6a,0x71,
+0x85,0xa4,0x91,0x75,0x70,0x59,0x3b,0x1b,0x0,0x0,0x0,0x1d,0x3c,0x5a,0x70,0x72,0x8d,0xa6,0x86,0x73,0x74,0x7b,0x8c,0x9e,0x8c,0x74,0x58,0x3b,0x1d,0x0,0x0,0x0,0x0,0xd,0x2a,0x44,0x5f,0x76,0x8b,0x9d,0x8d,0x7e,0x74,0x71,0x75,0x8d,0x90,0x71,0x51,0x31,0x11,0x0,0x0,0x0,0x1d,0x3c,0x5a,0x70,0x72,0x8c,0xa8,0x88,0x74,0x75,0x7a,0x86,0x98,0x92,0x7e,0x69,0x51,0x36,0x1b,0x0,0x0,0x0,0x0,0x1d,0x3c,0x5a,0x70,0x72,0x8c,0xa7,0x87,0x75,0x75,0x75,0x75,0x7c,0x9a,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x1c,0x3b,0x5a,
+0x70,0x72,0x8c,0xa8,0x88,0x72,0x70,0x5c,0x3e,0x25,0x1b,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x2a,0x45,0x5f,0x76,0x8b,0x9d,0x8f,0x7f,0x77,0x73,0x78,0x97,0x9a,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x1c,0x3b,0x5a,0x70,0x72,0x8d,0xa7,0x87,0x72,0x6e,0x56,0x69,0x71,0x80,0x9f,0x96,0x77,0x70,0x61,0x43,0x24,0x4,0x0,0x0,0x1c,0x3b,0x5a,0x70,0x72,0x88,0xa8,0x8d,0x72,0x70,0x5f,0x41,0x22,0x2,0x0,0x9,0x29,0x49,0x69,0x88,0x93,0x74,0x72,0x7b,0x9f,0x8b,0x70,0x53,0x35,0x17,0x0,0x0,0x0,0x0,0x0,0x1c,0x3b,
+0x5a,0x70,0x72,0x8c,0xa9,0x89,0x72,0x6f,0x5e,0x79,0x93,0xa1,0x86,0x72,0x70,0x5b,0x3c,0x1d,0x0,0x0,0x0,0x1e,0x3d,0x5b,0x70,0x72,0x8d,0xa8,0x88,0x75,0x75,0x75,0x77,0x94,0x84,0x65,0x45,0x25,0x5,0x0,0x0,0x1f,0x3e,0x5c,0x70,0x74,0x8e,0x80,0x72,0x6b,0x70,0x8d,0x9e,0x80,0x63,0x6f,0x72,0x8b,0xa6,0x86,0x72,0x6e,0x56,0x37,0x18,0x0,0x0,0x0,0x1e,0x3e,0x5c,0x6f,0x74,0x8e,0x80,0x72,0x6a,0x50,0x4c,0x66,0x80,0x9b,0xa6,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x0,0x11,0x2d,0x48,0x61,0x79,0x8e,0x9b,0x84,
+0x74,0x6d,0x72,0x7f,0x98,0x90,0x7c,0x64,0x4a,0x2f,0x13,0x0,0x0,0x0,0x0,0x1d,0x3c,0x5a,0x70,0x72,0x8c,0xa8,0x88,0x72,0x70,0x5c,0x3e,0x1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x2d,0x48,0x61,0x79,0x8e,0x9e,0x88,0x77,0x70,0x75,0x7e,0x98,0x90,0x7c,0x65,0x4b,0x31,0x15,0x0,0x0,0x0,0x0,0x1b,0x3b,0x59,0x70,0x72,0x8c,0xa7,0x87,0x72,0x6e,0x5a,0x77,0x6f,0x9f,0x7c,0x74,0x70,0x66,0x49,0x2a,0xa,0x0,0x0,0x0,0xc,0x29,0x44,0x5a,0x6b,0x73,0x73,0x6f,0x67,0x5d,0x49,0x2d,0xf,0x0,0x0,0x0,0x9,
+0x25,0x41,0x5b,0x75,0x8d,0x88,0x85,0x8e,0x8b,0x8e,0x99,0x8d,0x73,0x57,0x3a,0x1c,0x0,0x0,0x0,0x0,0x1e,0x3c,0x5b,0x78,0x94,0xb0,0x9f,0x7d,0x6a,0x50,0x34,0x16,0x0,0x0,0x0,0x0,0x0,0x3,0x20,0x3d,0x5a,0x77,0x93,0x9f,0x7f,0x64,0x46,0x28,0xa,0x0,0x0,0x0,0x0,0x11,0x31,0x4f,0x6b,0x85,0x9d,0xa2,0x8b,0x73,0x5a,0x3d,0x1e,0x0,0x0,0x0,0x0,0x9,0x27,0x45,0x61,0x7c,0x97,0x7f,0x67,0x64,0x6c,0x6a,0x5e,0x5f,0x6c,0x6e,0x67,0x5d,0x5c,0x46,0x29,0xc,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x90,0x90,
+0x90,0x90,0x73,0x53,0x51,0x71,0x90,0x90,0x90,0x90,0x90,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x90,0x90,0x90,0x90,0x90,0x90,0x8f,0x8b,0x7e,0x73,0x60,0x48,0x2d,0x11,0x0,0x0,0x0,0x0,0x0,0x18,0x32,0x48,0x5e,0x72,0x7e,0x8d,0x94,0x92,0x90,0x93,0x8e,0x86,0x71,0x51,0x31,0x11,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x90,0x90,0x90,0x90,0x90,0x90,0x8f,0x8a,0x83,0x77,0x67,0x52,0x3c,0x24,0xa,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x7a,0x5a,0x3a,
+0x1a,0x0,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x90,0x90,0x90,0x90,0x90,0x80,0x60,0x40,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x32,0x49,0x5f,0x72,0x82,0x8d,0x94,0x95,0x93,0x93,0x8d,0x86,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x90,0x90,0x90,0x90,0x90,0x79,0x59,0x70,0x8f,0x90,0x90,0x90,0x90,0x85,0x65,0x45,0x25,0x5,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x90,0x90,0x90,0x90,0x90,0x82,0x63,0x43,0x23,0x3,0x0,0x9,0x29,0x49,0x69,0x88,0x92,0x73,0x90,0x93,0x88,0x76,0x5f,0x44,0x28,0xc,
+0x0,0x0,0x0,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x90,0x90,0x90,0x90,0x90,0x79,0x59,0x68,0x86,0x90,0x90,0x90,0x7e,0x5e,0x3e,0x1e,0x0,0x0,0x0,0x1f,0x3f,0x5f,0x7f,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x84,0x65,0x45,0x25,0x5,0x0,0x0,0x20,0x40,0x60,0x80,0x90,0x90,0x90,0x90,0x72,0x65,0x83,0x90,0x77,0x59,0x79,0x90,0x90,0x90,0x90,0x90,0x79,0x59,0x39,0x19,0x0,0x0,0x0,0x20,0x40,0x60,0x80,0x90,0x90,0x90,0x90,0x73,0x53,0x3a,0x55,0x70,0x8a,0x90,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x0,0x0,0x1,
+0x1b,0x35,0x4c,0x62,0x75,0x85,0x90,0x91,0x8d,0x90,0x92,0x86,0x77,0x64,0x4e,0x37,0x1d,0x3,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x90,0x90,0x90,0x90,0x90,0x80,0x60,0x40,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1b,0x34,0x4c,0x61,0x74,0x84,0x8e,0x95,0x90,0x92,0x8e,0x84,0x76,0x64,0x4f,0x38,0x1f,0x5,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x90,0x90,0x90,0x90,0x90,0x79,0x59,0x66,0x7c,0x8d,0x94,0x91,0x8b,0x6b,0x4b,0x2b,0xb,0x0,0x0,0x0,0x0,0x17,0x2e,0x40,0x4d,0x53,0x53,0x4f,0x49,0x3f,
+0x32,0x1c,0x2,0x0,0x0,0x0,0x17,0x35,0x51,0x6d,0x87,0xa1,0xa8,0xa5,0xa7,0xa9,0x9d,0x8c,0x78,0x61,0x47,0x2c,0x10,0x0,0x0,0x0,0x0,0x13,0x30,0x4d,0x6a,0x85,0xa0,0xb0,0x95,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x0,0x12,0x2f,0x4b,0x67,0x84,0xa0,0x92,0x75,0x58,0x3b,0x1d,0x0,0x0,0x0,0x0,0x0,0x12,0x32,0x51,0x6e,0x87,0x9f,0xab,0x92,0x79,0x5e,0x3f,0x1f,0x0,0x0,0x0,0x0,0x0,0x1a,0x36,0x51,0x6b,0x82,0x94,0x7d,0x6c,0x5f,0x56,0x52,0x52,0x57,0x5f,0x6b,0x79,0x71,0x53,0x36,0x17,0x0,0x0,0x0,0x0,
+0x0,0x16,0x36,0x54,0x6e,0x70,0x70,0x70,0x70,0x6c,0x50,0x4e,0x6a,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x3b,0x1b,0x0,0x0,0x0,0x1d,0x3c,0x5a,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x6c,0x64,0x58,0x47,0x32,0x1b,0x1,0x0,0x0,0x0,0x0,0x0,0x4,0x1b,0x31,0x45,0x56,0x66,0x6f,0x75,0x78,0x78,0x75,0x70,0x68,0x5d,0x48,0x2b,0xd,0x0,0x0,0x0,0x1d,0x3c,0x5a,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x6f,0x6c,0x65,0x5a,0x4c,0x3a,0x25,0xf,0x0,0x0,0x0,0x0,0x0,0x1d,0x3c,0x5a,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
+0x70,0x70,0x70,0x70,0x6f,0x57,0x39,0x19,0x0,0x0,0x0,0x1c,0x3c,0x5a,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x5d,0x3f,0x1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x1c,0x32,0x46,0x57,0x65,0x6f,0x75,0x78,0x78,0x74,0x6f,0x68,0x5e,0x4d,0x32,0x15,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5a,0x70,0x70,0x70,0x70,0x70,0x70,0x6f,0x56,0x6a,0x70,0x70,0x70,0x70,0x70,0x70,0x61,0x43,0x24,0x4,0x0,0x0,0x1c,0x3c,0x5a,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x5f,0x41,0x22,0x2,0x0,0x7,0x26,0x44,0x5f,0x6d,0x74,0x78,0x78,
+0x74,0x6b,0x5c,0x49,0x32,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5a,0x70,0x70,0x70,0x70,0x70,0x70,0x6f,0x56,0x62,0x70,0x70,0x70,0x70,0x70,0x5b,0x3d,0x1d,0x0,0x0,0x0,0x1e,0x3d,0x5b,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x61,0x43,0x24,0x4,0x0,0x0,0x1f,0x3f,0x5d,0x70,0x70,0x70,0x70,0x70,0x6b,0x5b,0x70,0x70,0x6a,0x56,0x6f,0x70,0x70,0x70,0x70,0x70,0x6f,0x56,0x37,0x18,0x0,0x0,0x0,0x1f,0x3e,0x5c,0x70,0x70,0x70,0x70,0x70,0x6c,0x50,0x31,0x44,0x5f,0x70,0x70,0x70,0x62,0x44,0x25,
+0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x1f,0x35,0x49,0x5b,0x68,0x72,0x79,0x7a,0x79,0x74,0x6a,0x5c,0x4a,0x37,0x21,0x9,0x0,0x0,0x0,0x0,0x0,0x1d,0x3c,0x5a,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x5c,0x3e,0x1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x1f,0x34,0x48,0x59,0x67,0x70,0x87,0xa7,0x92,0x74,0x67,0x5a,0x4a,0x4c,0x45,0x31,0x17,0x0,0x0,0x0,0x0,0x1b,0x3b,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x6f,0x56,0x4f,0x62,0x6f,0x75,0x75,0x72,0x66,0x49,0x2a,0xa,0x0,0x0,0x0,0x0,0x0,0x13,
+0x23,0x2e,0x33,0x33,0x30,0x2a,0x21,0x16,0x5,0x0,0x0,0x0,0x0,0x1d,0x3d,0x5d,0x7c,0x8d,0x94,0x98,0x98,0x9a,0x8c,0x7f,0x72,0x60,0x4b,0x34,0x1b,0x0,0x0,0x0,0x0,0x0,0x6,0x23,0x3e,0x5a,0x75,0x8e,0xa7,0x8c,0x6f,0x51,0x33,0x15,0x0,0x0,0x0,0x0,0x6,0x21,0x3e,0x5a,0x76,0x91,0xa0,0x84,0x68,0x4b,0x2e,0x11,0x0,0x0,0x0,0x0,0x0,0xa,0x27,0x42,0x5b,0x73,0x88,0x94,0x7e,0x66,0x4d,0x32,0x16,0x0,0x0,0x0,0x0,0x0,0xa,0x24,0x3e,0x56,0x6c,0x82,0x92,0x88,0x7c,0x75,0x72,0x72,0x76,0x7d,0x88,0x87,0x78,
+0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x0,0xd,0x29,0x41,0x50,0x50,0x50,0x50,0x50,0x4f,0x3e,0x3d,0x4e,0x50,0x50,0x50,0x50,0x50,0x50,0x44,0x2d,0x12,0x0,0x0,0x0,0x13,0x2e,0x45,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4d,0x46,0x3b,0x2c,0x1a,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x19,0x2b,0x3b,0x48,0x50,0x56,0x58,0x58,0x55,0x50,0x49,0x3f,0x31,0x1b,0x0,0x0,0x0,0x0,0x13,0x2e,0x45,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4c,0x46,0x3c,0x30,0x20,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x2e,0x45,
+0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x43,0x2c,0x10,0x0,0x0,0x0,0x12,0x2e,0x45,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x47,0x30,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x19,0x2b,0x3a,0x47,0x50,0x56,0x58,0x58,0x55,0x50,0x49,0x40,0x34,0x20,0x7,0x0,0x0,0x0,0x0,0x12,0x2e,0x45,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x42,0x4e,0x50,0x50,0x50,0x50,0x50,0x50,0x49,0x34,0x1a,0x0,0x0,0x0,0x12,0x2e,0x45,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x48,0x32,0x17,0x0,0x0,0x0,
+0x19,0x32,0x44,0x4e,0x54,0x58,0x58,0x55,0x4d,0x41,0x30,0x1c,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x2e,0x45,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x43,0x4a,0x50,0x50,0x50,0x50,0x50,0x46,0x2f,0x13,0x0,0x0,0x0,0x14,0x2f,0x46,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x49,0x34,0x19,0x0,0x0,0x0,0x15,0x30,0x47,0x50,0x50,0x50,0x50,0x50,0x4e,0x46,0x50,0x50,0x4e,0x43,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x42,0x2a,0xe,0x0,0x0,0x0,0x15,0x30,0x47,0x50,0x50,0x50,0x50,0x50,0x4f,0x3e,0x25,0x32,
+0x48,0x50,0x50,0x50,0x4a,0x35,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x1c,0x2f,0x3e,0x4a,0x54,0x59,0x5a,0x5a,0x55,0x4c,0x3f,0x30,0x1e,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x2e,0x45,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x47,0x30,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x1c,0x2d,0x3c,0x48,0x64,0x7e,0xa0,0x9b,0x80,0x6c,0x65,0x66,0x6c,0x5e,0x41,0x22,0x3,0x0,0x0,0x0,0x12,0x2d,0x44,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x42,0x36,0x46,0x51,0x55,0x55,0x52,0x4c,0x39,0x1f,
+0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0xf,0x13,0x13,0x10,0xb,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x38,0x54,0x66,0x6f,0x75,0x79,0x79,0x8e,0x86,0x66,0x57,0x46,0x33,0x1e,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x2e,0x49,0x61,0x7a,0x92,0x7e,0x62,0x45,0x28,0xb,0x0,0x0,0x0,0x0,0x12,0x30,0x4d,0x69,0x84,0x93,0x88,0x75,0x59,0x3d,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x2e,0x45,0x5c,0x6f,0x7c,0x67,0x51,0x39,0x20,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x28,0x3f,0x54,0x66,0x76,0x83,0x8c,0x91,
+0x91,0x8f,0x8a,0x82,0x78,0x6b,0x5c,0x4a,0x31,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x27,0x30,0x30,0x30,0x30,0x30,0x2f,0x24,0x23,0x2f,0x30,0x30,0x30,0x30,0x30,0x30,0x29,0x18,0x0,0x0,0x0,0x0,0x2,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2d,0x27,0x1d,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x1e,0x29,0x31,0x36,0x38,0x38,0x36,0x31,0x2a,0x21,0x16,0x4,0x0,0x0,0x0,0x0,0x2,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2c,0x27,0x1e,0x13,0x4,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x2,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x28,0x16,0x0,0x0,0x0,0x0,0x1,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2a,0x1a,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x1e,0x29,0x31,0x36,0x38,0x38,0x35,0x30,0x2a,0x21,0x17,0x8,0x0,0x0,0x0,0x0,0x0,0x1,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x27,0x2f,0x30,0x30,0x30,0x30,0x30,0x30,0x2c,0x1d,0x7,0x0,0x0,0x0,0x1,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x2b,0x1c,0x5,0x0,0x0,0x0,0x5,0x19,0x26,0x2f,0x35,0x38,0x38,0x35,0x2f,0x24,0x15,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x27,0x2d,0x30,0x30,0x30,0x30,0x30,0x2a,0x19,0x2,0x0,0x0,0x0,0x2,0x19,0x2a,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2c,0x1d,0x7,0x0,0x0,0x0,0x4,0x1a,0x2a,0x30,0x30,0x30,0x30,0x30,0x2f,0x2a,0x30,0x30,0x2f,0x27,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x27,0x15,0x0,0x0,0x0,0x0,0x3,0x1a,0x2a,0x30,0x30,
+0x30,0x30,0x30,0x2f,0x24,0x11,0x1b,0x2b,0x30,0x30,0x30,0x2c,0x1e,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x13,0x21,0x2c,0x34,0x39,0x3a,0x3a,0x35,0x2d,0x22,0x14,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2a,0x1a,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x11,0x1f,0x3c,0x59,0x75,0x8b,0x9a,0x96,0x89,0x84,0x7b,0x84,0x64,0x44,0x24,0x4,0x0,0x0,0x0,0x0,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x27,0x1b,0x29,
+0x31,0x35,0x35,0x32,0x2d,0x20,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x27,0x3b,0x47,0x50,0x56,0x59,0x6e,0x8e,0x7b,0x66,0x46,0x2b,0x1a,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x1c,0x35,0x4d,0x65,0x7c,0x6c,0x51,0x36,0x1b,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x7c,0x75,0x6b,0x5f,0x4a,0x2e,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x18,0x2e,0x42,0x54,0x5d,0x4f,0x3a,0x24,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,
+0x27,0x3a,0x4c,0x5a,0x65,0x6d,0x71,0x72,0x71,0x6c,0x64,0x5a,0x4d,0x40,0x31,0x1d,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x10,0x10,0x10,0x10,0x10,0x10,0x8,0x7,0xf,0x10,0x10,0x10,0x10,0x10,0x10,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xd,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x12,0x16,0x18,0x18,0x16,0x11,0xb,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xd,
+0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x11,0x16,0x18,0x18,0x16,0x11,0xa,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xa,0xf,0x10,0x10,0x10,0x10,0x10,0x10,0xd,0x2,0x0,0x0,0x0,0x0,0x0,0x0,
+0xb,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xd,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x10,0x15,0x18,0x18,0x16,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xa,0xe,0x10,0x10,0x10,0x10,0x10,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xd,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x10,0x10,0x10,0x10,0x10,0x10,0xb,0x10,0x10,0xf,0xa,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xa,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0xc,0x10,0x10,0x10,0x10,0x10,0x10,0x8,0x0,0x0,0xd,0x10,0x10,0x10,0xe,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0xd,0x15,0x19,0x1a,0x1a,0x16,0xf,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x2e,0x48,0x5f,0x71,0x7c,0x7e,0x7e,0x80,0x7d,0x76,0x62,0x43,0x24,0x4,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,
+0x10,0x10,0x10,0x10,0xa,0x0,0xa,0x12,0x15,0x15,0x13,0xe,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x1e,0x29,0x31,0x37,0x4d,0x6b,0x73,0x69,0x59,0x3f,0x22,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x20,0x38,0x4f,0x5f,0x57,0x3f,0x25,0xa,0x0,0x0,0x0,0x0,0x0,0x12,0x30,0x4c,0x5f,0x5d,0x56,0x4d,0x42,0x33,0x1d,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x15,0x28,0x38,0x3d,0x34,0x22,0xd,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x20,0x2f,0x3c,0x46,0x4e,0x51,0x52,0x51,0x4c,0x45,0x3c,0x30,0x23,0x15,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1b,0x32,0x46,0x54,0x5d,0x62,0x62,0x61,0x5d,0x57,0x4d,0x36,0x1b,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0xa,0x11,0x23,0x3e,0x51,0x54,0x4b,0x3e,0x2c,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x22,0x35,0x40,0x3b,0x2a,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x1f,0x34,0x40,0x3e,0x37,0x2f,0x24,0x17,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x1a,
+0x1d,0x17,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x12,0x1e,0x28,0x2e,0x32,0x32,0x31,0x2d,0x26,0x1d,0x13,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x19,0x2a,0x36,0x3e,0x42,0x42,0x41,0x3d,
+0x38,0x30,0x20,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x26,0x32,0x34,0x2d,0x22,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x19,0x20,0x1d,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x18,0x20,0x1e,0x18,0x10,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0xf,0x12,0x12,0x11,0xd,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0xd,0x18,0x1f,0x22,0x22,0x21,0x1e,0x19,0x11,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x13,0x14,0xf,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x2,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x4,0x5,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xe,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xe,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xb,0xb,0xb,0xb,
+0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xa,0xe,0x10,0xf,0xb,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xb,0xe,0xe,0xa,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0xe,0x10,0xf,0xb,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xa,0xc,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x9,0xd,0xe,0xc,0x7,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x9,0x9,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x9,0x9,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x9,0x9,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0xe,0xe,0x9,0xc,0x10,0xf,0x8,0x0,0x4,0xc,0xf,0xd,0x7,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0xe,0xe,0x9,0xb,0xf,0xe,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0xd,0xf,0xf,0xc,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0xb,0xe,0xe,0x7,0xe,0x10,0xd,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0xa,0xe,0xe,0x8,0xe,0xe,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0xf,0x1a,0x21,0x24,0x25,0x23,0x1f,0x18,0xf,0x5,0x0,0x0,0x0,0x0,
+0x0,0x0,0xe,0x1b,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1c,0x11,0x0,0x0,0x0,0x0,0x0,0xd,0x1a,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1d,0x15,0x1a,0x1e,0x1e,0x1e,0x1e,0x1e,0x1c,0x11,0x0,0x0,0x0,0x0,0x0,0xa,0x18,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1d,0x14,0x15,0x1d,0x1e,0x1e,0x1e,0x1e,0x1e,0x16,0x6,0x0,0x0,0x0,0x0,0x1,0x12,0x1c,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x17,0x13,0x1d,0x1e,0x1e,0x1d,0x13,0x19,0x1e,0x1e,0x1e,0x1e,0x1e,0x1c,0x11,0x0,0x0,0x0,0x0,0x0,0xf,0x1b,0x1e,
+0x1e,0x1e,0x1e,0x1e,0x1e,0x1c,0x1c,0x1e,0x1e,0x1e,0x1e,0x1e,0x1a,0xe,0x0,0x0,0x0,0x0,0x0,0x6,0x16,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x16,0x1c,0x1e,0x1e,0x1e,0x1e,0x1e,0x19,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x1b,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1c,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x19,0x19,0x19,0x18,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x22,0x2d,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x2d,0x22,0xe,0x0,0x0,0x0,
+0x0,0x12,0x23,0x2b,0x2b,0x2b,0x2b,0x22,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x16,0x21,0x29,0x2e,0x30,0x2f,0x2a,0x23,0x16,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x1a,0x24,0x2b,0x2e,0x2e,0x29,0x21,0x14,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x1d,0x27,0x2e,0x30,0x2f,0x2a,0x21,0x13,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x19,0x24,0x2a,0x2c,0x28,0x1e,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x14,0x20,0x29,0x2d,0x2e,0x2c,
+0x26,0x1d,0x1c,0x1c,0x1b,0x12,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x13,0x1c,0x26,0x29,0x29,0x21,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x16,0x1e,0x20,0x1a,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x12,0x1b,0x25,0x29,0x29,0x21,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x11,0x1a,0x24,0x29,0x29,0x22,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x15,0x1f,0x29,0x2e,0x2e,0x27,0x2c,0x30,0x2e,0x26,0x19,0x23,0x2b,0x2f,0x2c,
+0x25,0x19,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x15,0x1f,0x29,0x2e,0x2e,0x27,0x2a,0x2e,0x2e,0x27,0x1c,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x1c,0x25,0x2c,0x2f,0x2f,0x2b,0x23,0x18,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x16,0x20,0x2a,0x2e,0x2e,0x26,0x2d,0x30,0x2c,0x24,0x18,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x15,0x1f,0x29,0x2e,0x2e,0x26,0x2e,0x2e,0x28,0x1e,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x1c,0x2c,0x38,0x40,0x44,0x45,0x43,0x3e,
+0x37,0x2e,0x22,0xe,0x0,0x0,0x0,0x0,0x11,0x28,0x39,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3b,0x2c,0x15,0x0,0x0,0x0,0xe,0x26,0x38,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3d,0x31,0x39,0x3e,0x3e,0x3e,0x3e,0x3e,0x3b,0x2c,0x15,0x0,0x0,0x0,0xa,0x22,0x36,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3d,0x30,0x32,0x3d,0x3e,0x3e,0x3e,0x3e,0x3d,0x32,0x1d,0x4,0x0,0x0,0x0,0x17,0x2e,0x3c,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x33,0x2e,0x3c,0x3e,0x3e,0x3c,0x2f,0x36,0x3e,0x3e,0x3e,0x3e,0x3e,0x3b,0x2c,0x15,
+0x0,0x0,0x0,0x11,0x29,0x39,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3c,0x3a,0x3e,0x3e,0x3e,0x3e,0x3e,0x39,0x28,0x10,0x0,0x0,0x0,0x4,0x1e,0x32,0x3d,0x3e,0x3e,0x3e,0x3e,0x3e,0x3d,0x33,0x3a,0x3e,0x3e,0x3e,0x3e,0x3e,0x37,0x25,0xd,0x0,0x0,0x0,0x0,0x13,0x2a,0x3a,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3b,0x2c,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x2c,0x38,0x39,0x39,0x38,0x2c,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x22,0x3c,0x4c,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,
+0x4f,0x4c,0x3c,0x22,0x6,0x0,0x0,0xd,0x28,0x3f,0x4b,0x4b,0x4b,0x4b,0x3d,0x26,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x22,0x33,0x40,0x49,0x4e,0x50,0x4e,0x4a,0x40,0x32,0x1f,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x28,0x37,0x43,0x4b,0x4e,0x4d,0x49,0x3e,0x30,0x1d,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x18,0x2b,0x3a,0x46,0x4d,0x50,0x4e,0x49,0x3e,0x2f,0x1b,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x25,0x35,0x42,0x4a,0x4c,0x47,0x3c,0x2a,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xa,
+0x1f,0x30,0x3e,0x48,0x4d,0x4e,0x4b,0x45,0x3c,0x3c,0x3c,0x3b,0x2f,0x19,0x0,0x0,0x0,0x0,0x5,0x1a,0x28,0x31,0x3b,0x45,0x49,0x49,0x3c,0x25,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x22,0x33,0x3e,0x3f,0x39,0x2b,0x18,0x0,0x0,0x0,0x0,0x0,0x4,0x19,0x27,0x30,0x3a,0x43,0x49,0x49,0x3d,0x27,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x16,0x25,0x2f,0x39,0x43,0x49,0x49,0x3e,0x29,0xe,0x0,0x0,0x0,0x0,0x0,0x17,0x28,0x33,0x3d,0x47,0x4e,0x4e,0x43,0x4b,0x50,
+0x4e,0x44,0x35,0x41,0x4b,0x4f,0x4c,0x43,0x34,0x21,0xa,0x0,0x0,0x0,0x0,0x0,0x2,0x18,0x29,0x33,0x3d,0x47,0x4e,0x4e,0x43,0x49,0x4e,0x4d,0x46,0x38,0x25,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x17,0x2a,0x39,0x44,0x4c,0x4f,0x4f,0x4b,0x42,0x36,0x25,0x12,0x0,0x0,0x0,0x0,0x0,0x5,0x1b,0x2b,0x34,0x3e,0x48,0x4e,0x4d,0x44,0x4d,0x50,0x4c,0x42,0x33,0x20,0xa,0x0,0x0,0x0,0x0,0x0,0x4,0x1a,0x2a,0x34,0x3e,0x47,0x4e,0x4e,0x42,0x4e,0x4e,0x47,0x3b,0x27,0xd,0x0,0x0,0x0,0x0,0x0,0xa,0x21,0x36,
+0x48,0x56,0x5f,0x64,0x65,0x62,0x5d,0x55,0x4d,0x3b,0x21,0x5,0x0,0x0,0x2,0x20,0x3d,0x55,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x58,0x42,0x25,0x7,0x0,0x0,0x1d,0x3a,0x53,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5c,0x49,0x55,0x5e,0x5e,0x5e,0x5e,0x5e,0x59,0x42,0x26,0x7,0x0,0x0,0x18,0x36,0x50,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5b,0x47,0x4a,0x5d,0x5e,0x5e,0x5e,0x5e,0x5d,0x4b,0x2f,0x12,0x0,0x0,0xa,0x28,0x44,0x5a,0x5e,0x5e,0x5e,0x5e,0x5e,0x5d,0x4c,0x45,0x5a,0x5e,0x5e,0x5b,0x46,0x51,0x5e,
+0x5e,0x5e,0x5e,0x5e,0x59,0x42,0x26,0x7,0x0,0x3,0x21,0x3e,0x56,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5a,0x58,0x5e,0x5e,0x5e,0x5e,0x5e,0x55,0x3c,0x1f,0x1,0x0,0x0,0x12,0x30,0x4b,0x5d,0x5e,0x5e,0x5e,0x5e,0x5e,0x5d,0x4b,0x58,0x5e,0x5e,0x5e,0x5e,0x5e,0x52,0x39,0x1c,0x0,0x0,0x0,0x4,0x22,0x3f,0x57,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x5e,0x59,0x42,0x26,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2c,0x44,0x57,0x59,0x59,0x57,0x44,0x2c,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x2f,0x4d,0x69,0x6f,0x6f,
+0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x69,0x4d,0x2f,0xf,0x0,0x0,0x17,0x36,0x54,0x6a,0x6b,0x6b,0x69,0x52,0x35,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x25,0x3c,0x4e,0x5d,0x68,0x6e,0x6f,0x6e,0x69,0x5e,0x4c,0x35,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x2e,0x42,0x53,0x61,0x6a,0x6e,0x6d,0x68,0x5b,0x4a,0x33,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x30,0x45,0x56,0x64,0x6d,0x70,0x6e,0x68,0x5a,0x48,0x33,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x2a,0x3f,0x51,0x60,0x69,0x6b,0x66,0x57,0x40,0x25,
+0x9,0x0,0x0,0x0,0x0,0x7,0x20,0x37,0x4b,0x5b,0x66,0x6c,0x6e,0x6b,0x64,0x5c,0x5c,0x5c,0x5a,0x47,0x2b,0xe,0x0,0x0,0x0,0x18,0x32,0x45,0x50,0x59,0x63,0x69,0x68,0x52,0x34,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x20,0x39,0x4e,0x5c,0x5f,0x57,0x45,0x2d,0x12,0x0,0x0,0x0,0x0,0x17,0x31,0x45,0x4f,0x58,0x62,0x69,0x68,0x53,0x36,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2e,0x42,0x4e,0x57,0x61,0x69,0x69,0x55,0x38,0x19,0x0,0x0,0x0,0x0,0x11,0x2d,0x44,0x51,
+0x5b,0x65,0x6e,0x6e,0x5e,0x69,0x70,0x6d,0x61,0x52,0x5f,0x69,0x6f,0x6b,0x60,0x4e,0x36,0x1c,0x0,0x0,0x0,0x0,0x0,0x13,0x2f,0x45,0x52,0x5c,0x66,0x6e,0x6e,0x5d,0x68,0x6e,0x6d,0x63,0x52,0x3c,0x22,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x30,0x44,0x55,0x63,0x6b,0x6f,0x6f,0x6a,0x60,0x51,0x3f,0x2a,0x11,0x0,0x0,0x0,0x0,0x17,0x32,0x47,0x53,0x5d,0x66,0x6e,0x6d,0x62,0x6c,0x70,0x6b,0x5f,0x4d,0x38,0x20,0x6,0x0,0x0,0x0,0x0,0x15,0x31,0x47,0x52,0x5c,0x66,0x6e,0x6e,0x5c,0x6d,0x6e,0x65,0x54,0x38,0x1a,0x0,
+0x0,0x0,0x0,0x3,0x1e,0x37,0x4f,0x63,0x73,0x7e,0x83,0x84,0x82,0x7c,0x74,0x68,0x4c,0x2d,0xd,0x0,0x0,0x6,0x26,0x46,0x66,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x6c,0x4c,0x2c,0xc,0x0,0x3,0x23,0x43,0x63,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x75,0x55,0x65,0x7e,0x7e,0x7e,0x7e,0x7e,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x1e,0x3e,0x5e,0x7d,0x7e,0x7e,0x7e,0x7e,0x7e,0x73,0x53,0x56,0x76,0x7e,0x7e,0x7e,0x7e,0x77,0x57,0x37,0x17,0x0,0x0,0xf,0x2f,0x4f,0x6f,0x7e,0x7e,0x7e,0x7e,0x7e,0x79,0x59,0x52,
+0x70,0x7e,0x7e,0x71,0x52,0x60,0x7e,0x7e,0x7e,0x7e,0x7e,0x6c,0x4c,0x2c,0xc,0x0,0x7,0x27,0x47,0x67,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x6e,0x6a,0x7e,0x7e,0x7e,0x7e,0x7e,0x65,0x45,0x25,0x5,0x0,0x0,0x17,0x37,0x57,0x77,0x7e,0x7e,0x7e,0x7e,0x7e,0x78,0x58,0x6a,0x7e,0x7e,0x7e,0x7e,0x7e,0x62,0x42,0x22,0x2,0x0,0x0,0x9,0x29,0x49,0x69,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x0,0x12,0x2a,0x42,0x5a,0x71,0x79,0x79,0x71,0x59,0x41,0x29,0x11,0x0,0x0,0x0,0x0,
+0x0,0x10,0x30,0x50,0x70,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x70,0x50,0x30,0x10,0x0,0x0,0x19,0x39,0x58,0x74,0x8b,0x8b,0x7d,0x61,0x44,0x28,0xb,0x0,0x0,0x0,0x0,0x0,0x1c,0x38,0x52,0x69,0x7a,0x86,0x8d,0x8f,0x8d,0x87,0x79,0x62,0x46,0x29,0xc,0x0,0x0,0x0,0x0,0x0,0x11,0x2b,0x44,0x5b,0x6f,0x7c,0x88,0x8d,0x8c,0x85,0x77,0x60,0x47,0x2a,0xc,0x0,0x0,0x0,0x0,0x12,0x2d,0x46,0x5d,0x72,0x7f,0x8b,0x8f,0x8d,0x84,0x75,0x60,0x47,0x2c,0xf,0x0,0x0,0x0,0x0,0x0,0xb,0x26,0x3f,0x57,0x6c,
+0x7d,0x88,0x8a,0x7f,0x6d,0x51,0x32,0x13,0x0,0x0,0x0,0x0,0x17,0x33,0x4d,0x65,0x78,0x84,0x8c,0x8d,0x8a,0x7e,0x7c,0x7c,0x7c,0x73,0x53,0x33,0x13,0x0,0x0,0x5,0x24,0x43,0x5f,0x6e,0x78,0x81,0x89,0x78,0x58,0x38,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2f,0x4c,0x66,0x7a,0x7f,0x71,0x5a,0x3e,0x20,0x1,0x0,0x0,0x3,0x23,0x41,0x5e,0x6e,0x77,0x80,0x89,0x79,0x59,0x39,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1f,0x3e,0x5b,0x6c,0x76,0x7f,0x88,0x7c,0x5c,0x3c,0x1c,0x0,
+0x0,0x0,0x0,0x1b,0x3b,0x59,0x70,0x7a,0x83,0x8d,0x7d,0x7b,0x87,0x8f,0x8a,0x7a,0x6e,0x7b,0x87,0x8e,0x89,0x7a,0x63,0x47,0x2a,0xc,0x0,0x0,0x0,0x0,0x1d,0x3c,0x5b,0x70,0x7a,0x83,0x8d,0x7d,0x7a,0x85,0x8d,0x8b,0x7f,0x69,0x4d,0x31,0x13,0x0,0x0,0x0,0x0,0x0,0x12,0x2d,0x46,0x5d,0x71,0x7f,0x89,0x8e,0x8e,0x87,0x7d,0x6b,0x57,0x3e,0x24,0x9,0x0,0x0,0x1,0x21,0x40,0x5e,0x71,0x7b,0x84,0x8d,0x79,0x7f,0x89,0x8f,0x88,0x7a,0x65,0x4d,0x32,0x16,0x0,0x0,0x0,0x0,0x20,0x3f,0x5d,0x71,0x7b,0x83,0x8d,0x7c,0x75,
+0x88,0x8c,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x11,0x2e,0x4a,0x64,0x7c,0x8e,0x94,0x88,0x7c,0x88,0x97,0x8e,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x6,0x26,0x46,0x66,0x86,0x96,0x87,0x87,0x87,0x99,0x9d,0x87,0x87,0x87,0x93,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x3,0x23,0x43,0x63,0x82,0x84,0x96,0x9d,0x8c,0x83,0x75,0x55,0x65,0x82,0x85,0x98,0x87,0x83,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x87,0x95,0x9d,0x8d,0x83,0x73,0x53,0x56,0x76,0x83,0x8f,0x90,0x86,0x77,0x57,0x37,0x17,0x0,0x0,0xf,0x2f,0x4f,0x6f,0x85,
+0x8c,0x9d,0x92,0x84,0x79,0x59,0x5b,0x7a,0x97,0x98,0x7a,0x5b,0x60,0x80,0x87,0x96,0x8b,0x84,0x6c,0x4c,0x2c,0xc,0x0,0x7,0x27,0x47,0x67,0x82,0x87,0x9d,0x9d,0x88,0x82,0x6e,0x6a,0x82,0x89,0x9b,0x86,0x82,0x65,0x45,0x25,0x5,0x0,0x0,0x17,0x37,0x57,0x77,0x85,0x90,0x9d,0x93,0x84,0x78,0x58,0x6a,0x83,0x89,0x9c,0x88,0x81,0x62,0x42,0x22,0x2,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0x95,0x87,0x87,0x87,0x87,0x87,0x95,0x9d,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0xf,0x27,0x3f,0x57,0x6f,0x86,0x99,0x99,0x85,0x6e,
+0x56,0x3e,0x26,0xf,0x0,0x0,0x0,0x0,0x10,0x30,0x50,0x70,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x70,0x50,0x30,0x10,0x0,0x0,0x11,0x2d,0x47,0x60,0x79,0x91,0x8b,0x6f,0x53,0x36,0x1a,0x0,0x0,0x0,0x0,0x6,0x26,0x45,0x63,0x7e,0x95,0x90,0x75,0x75,0x7d,0x9e,0x8d,0x71,0x53,0x34,0x15,0x0,0x0,0x0,0x0,0x3,0x20,0x3d,0x58,0x71,0x87,0x9a,0x7b,0x75,0x7f,0x9e,0x8c,0x71,0x53,0x33,0x14,0x0,0x0,0x0,0x4,0x21,0x3e,0x59,0x73,0x89,0x93,0x7d,0x74,0x7f,0x98,0x8c,0x73,0x57,0x3a,0x1c,0x0,0x0,0x0,
+0x0,0x0,0x1a,0x37,0x52,0x6c,0x83,0x8a,0x7f,0x93,0x96,0x77,0x58,0x38,0x18,0x0,0x0,0x0,0x5,0x24,0x42,0x5f,0x7a,0x91,0x92,0x7a,0x72,0x7d,0x9e,0x90,0x89,0x89,0x73,0x53,0x33,0x13,0x0,0x0,0x6,0x26,0x46,0x66,0x86,0x8e,0x9a,0x97,0x78,0x58,0x38,0x18,0xd,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x56,0x75,0x6e,0x9d,0x7c,0x66,0x47,0x27,0x7,0x0,0x0,0x5,0x25,0x45,0x65,0x84,0x8e,0x9a,0x99,0x79,0x59,0x39,0x19,0x7,0x7,0x7,0x4,0x0,0x0,0x0,0x0,0x0,0x2,0x22,0x42,0x62,0x81,0x8e,
+0x97,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x8a,0x95,0x9d,0x88,0x8a,0x89,0x94,0xa7,0x8f,0x89,0x8a,0x8a,0x95,0xa6,0x8e,0x71,0x53,0x34,0x15,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x8a,0x95,0x9d,0x88,0x8b,0x89,0x91,0xa5,0x94,0x78,0x5a,0x3b,0x1c,0x0,0x0,0x0,0x0,0x4,0x22,0x3e,0x59,0x73,0x89,0x9c,0x7d,0x75,0x78,0x8b,0x97,0x83,0x6b,0x50,0x34,0x17,0x0,0x0,0x2,0x22,0x42,0x62,0x82,0x8a,0x98,0x99,0x89,0x88,0x89,0x96,0xa5,0x91,0x79,0x5e,0x41,0x24,0x6,0x0,0x0,0x1,0x21,0x41,
+0x61,0x80,0x8a,0x95,0x9a,0x7b,0x8c,0xa0,0x99,0x7a,0x5a,0x3a,0x1b,0x0,0x0,0x0,0x0,0x1b,0x3a,0x58,0x76,0x90,0x98,0x7d,0x6a,0x65,0x6b,0x89,0x8e,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x6,0x26,0x46,0x66,0x86,0x8d,0x6f,0x67,0x79,0x98,0x9e,0x7e,0x67,0x6a,0x88,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x1f,0x3d,0x57,0x63,0x72,0x92,0xa4,0x84,0x64,0x60,0x4c,0x58,0x63,0x73,0x92,0x7c,0x64,0x5c,0x44,0x27,0x9,0x0,0x0,0x1a,0x38,0x53,0x63,0x6d,0x8a,0xa8,0x8c,0x6f,0x60,0x4a,0x4d,0x61,0x70,0x8d,0x84,0x67,0x61,0x4d,0x31,0x13,
+0x0,0x0,0xb,0x2a,0x47,0x5e,0x66,0x80,0x9f,0x90,0x72,0x61,0x4f,0x64,0x82,0xa0,0xa1,0x82,0x65,0x54,0x63,0x72,0x90,0x7f,0x66,0x5c,0x44,0x27,0x9,0x0,0x4,0x22,0x40,0x59,0x63,0x72,0x8c,0xa7,0x8c,0x71,0x5d,0x5b,0x72,0x8b,0x88,0x6f,0x63,0x58,0x3e,0x21,0x2,0x0,0x0,0x13,0x32,0x4e,0x61,0x66,0x80,0x9c,0x95,0x7a,0x61,0x4e,0x5b,0x6a,0x85,0x8c,0x71,0x63,0x56,0x3b,0x1d,0x0,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0x8c,0x6e,0x68,0x68,0x68,0x82,0x9d,0x97,0x7d,0x62,0x46,0x29,0xa,0x0,0x0,0x0,0xd,0x25,0x3c,0x54,
+0x6c,0x83,0x99,0x86,0x86,0x9a,0x83,0x6c,0x54,0x3c,0x24,0xc,0x0,0x0,0x0,0xe,0x2d,0x4a,0x63,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x63,0x4a,0x2d,0xe,0x0,0x0,0x1,0x1a,0x33,0x4c,0x65,0x7e,0x96,0x7e,0x61,0x45,0x28,0xb,0x0,0x0,0x0,0x8,0x28,0x48,0x68,0x87,0x92,0x90,0x71,0x58,0x77,0x95,0x98,0x79,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0xe,0x2c,0x4a,0x68,0x83,0x9d,0x8b,0x70,0x5f,0x7f,0x9e,0x93,0x74,0x55,0x35,0x15,0x0,0x0,0x0,0xe,0x2d,0x4b,0x68,0x84,0x9f,0x7d,0x67,0x55,0x6f,0x8d,0x9e,
+0x80,0x62,0x43,0x24,0x5,0x0,0x0,0x0,0x7,0x26,0x44,0x62,0x7e,0x98,0x80,0x67,0x7c,0x7c,0x6f,0x53,0x34,0x15,0x0,0x0,0x0,0xc,0x2b,0x4b,0x6a,0x88,0xa5,0x87,0x69,0x58,0x77,0x95,0x96,0x79,0x69,0x66,0x4e,0x30,0x11,0x0,0x0,0x5,0x25,0x44,0x61,0x6e,0x77,0x97,0x97,0x78,0x58,0x38,0x2f,0x2d,0x26,0x1a,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x56,0x76,0x93,0x9e,0x7c,0x66,0x47,0x27,0x7,0x0,0x0,0x4,0x23,0x42,0x60,0x6e,0x76,0x96,0x99,0x79,0x59,0x39,0x27,0x27,0x27,0x27,0x23,0x15,0x1,0x0,0x0,
+0x0,0x1,0x20,0x40,0x5d,0x6f,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x1a,0x39,0x56,0x6a,0x73,0x92,0x9d,0x7d,0x6b,0x6b,0x7e,0x9a,0x9a,0x7a,0x6c,0x6c,0x7f,0x9b,0x98,0x79,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x1c,0x3b,0x58,0x6a,0x73,0x92,0x9d,0x7d,0x6d,0x6a,0x79,0x95,0x9f,0x7e,0x60,0x40,0x21,0x1,0x0,0x0,0x0,0xe,0x2d,0x4b,0x69,0x85,0x9f,0x8d,0x71,0x57,0x5f,0x7a,0x97,0x96,0x7c,0x5f,0x41,0x22,0x3,0x0,0x1,0x20,0x3f,0x5b,0x6a,0x76,0x96,0x98,0x79,0x6a,0x6c,0x7d,0x95,0xa4,0x88,0x6b,0x4d,
+0x2e,0xf,0x0,0x0,0x0,0x1e,0x3d,0x5a,0x6a,0x73,0x92,0x9c,0x8b,0x7f,0x7e,0x94,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x1,0x21,0x41,0x60,0x7f,0x9e,0x92,0x72,0x52,0x45,0x65,0x84,0x8e,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x6,0x26,0x46,0x66,0x86,0x89,0x6a,0x59,0x79,0x98,0x9e,0x7e,0x5e,0x65,0x83,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x11,0x2a,0x3c,0x52,0x72,0x92,0xa4,0x84,0x64,0x44,0x35,0x3d,0x53,0x73,0x92,0x7c,0x5c,0x3f,0x30,0x18,0x0,0x0,0x0,0xc,0x26,0x3a,0x43,0x61,0x7f,0x9c,0x97,0x79,0x5b,0x3d,0x3e,0x5d,0x7b,
+0x97,0x7a,0x5c,0x42,0x36,0x20,0x6,0x0,0x0,0x0,0x1a,0x31,0x40,0x5a,0x79,0x97,0x98,0x7a,0x5b,0x4e,0x6d,0x8b,0x88,0xa0,0x8b,0x6e,0x4f,0x5a,0x7a,0x95,0x77,0x58,0x3f,0x30,0x18,0x0,0x0,0x0,0x14,0x2c,0x3d,0x46,0x61,0x7c,0x96,0x9c,0x81,0x67,0x6a,0x83,0x8f,0x76,0x5c,0x43,0x3c,0x2b,0x12,0x0,0x0,0x0,0x7,0x21,0x36,0x42,0x56,0x72,0x8d,0xa4,0x88,0x6d,0x51,0x5f,0x7a,0x95,0x7c,0x61,0x45,0x3b,0x28,0xf,0x0,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0x87,0x69,0x49,0x5e,0x79,0x93,0xa1,0x86,0x6c,0x51,0x36,0x1b,0x0,
+0x0,0x0,0xa,0x22,0x3a,0x52,0x6a,0x81,0x94,0x80,0x6d,0x6e,0x81,0x94,0x80,0x69,0x51,0x39,0x21,0x9,0x0,0x0,0x3,0x1e,0x36,0x45,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x45,0x36,0x1e,0x3,0x0,0x0,0x0,0x6,0x1f,0x38,0x51,0x6a,0x82,0x8b,0x70,0x53,0x34,0x14,0x0,0x0,0x0,0x4,0x23,0x41,0x5d,0x71,0x73,0x73,0x6c,0x6e,0x75,0x94,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x16,0x35,0x54,0x73,0x90,0xa0,0x7f,0x63,0x5e,0x79,0x7d,0x7e,0x69,0x4d,0x2f,0x10,0x0,0x0,0x0,0x15,0x35,0x54,0x73,0x91,
+0x9d,0x7d,0x75,0x75,0x75,0x89,0xa7,0x88,0x69,0x49,0x29,0x9,0x0,0x0,0x2,0x19,0x2e,0x4d,0x6c,0x8a,0x9b,0x7c,0x5c,0x65,0x68,0x59,0x42,0x28,0xb,0x0,0x0,0x0,0xd,0x2d,0x4d,0x6d,0x8d,0xa5,0x85,0x65,0x54,0x73,0x93,0x9b,0x7c,0x5c,0x48,0x39,0x22,0x6,0x0,0x0,0x0,0x1a,0x34,0x48,0x57,0x77,0x97,0x97,0x78,0x58,0x4a,0x4f,0x4d,0x44,0x35,0x22,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x2f,0x4d,0x67,0x7c,0x80,0x73,0x5a,0x3e,0x20,0x1,0x0,0x0,0x0,0x18,0x33,0x47,0x56,0x76,0x96,0x99,0x79,0x59,0x47,0x47,0x47,
+0x47,0x47,0x41,0x2e,0x15,0x0,0x0,0x0,0x0,0x16,0x31,0x46,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0xf,0x2a,0x40,0x53,0x73,0x92,0x9d,0x7d,0x5d,0x56,0x75,0x94,0x9a,0x7a,0x5a,0x56,0x75,0x95,0x9b,0x7b,0x5b,0x3b,0x1b,0x0,0x0,0x0,0x0,0x11,0x2b,0x41,0x53,0x73,0x92,0x9d,0x7d,0x5d,0x4f,0x6f,0x8e,0xa1,0x81,0x62,0x42,0x22,0x2,0x0,0x0,0x0,0x15,0x35,0x54,0x73,0x91,0xa3,0x84,0x66,0x47,0x51,0x70,0x8f,0xa5,0x86,0x68,0x49,0x2a,0xa,0x0,0x0,0x14,0x2e,0x43,0x56,0x76,0x96,0x98,0x79,0x59,
+0x50,0x6b,0x88,0xa6,0x91,0x73,0x54,0x34,0x14,0x0,0x0,0x0,0x13,0x2d,0x42,0x53,0x73,0x92,0x9c,0x7c,0x61,0x6b,0x75,0x70,0x54,0x34,0x14,0x0,0x0,0x0,0x2,0x22,0x42,0x62,0x7f,0xa1,0x97,0x7b,0x64,0x52,0x60,0x79,0x79,0x6d,0x4e,0x2e,0xe,0x0,0x0,0x6,0x26,0x45,0x64,0x74,0x74,0x64,0x59,0x79,0x98,0x9e,0x7e,0x5e,0x5f,0x74,0x74,0x69,0x4b,0x2b,0xb,0x0,0x0,0x0,0x12,0x32,0x52,0x72,0x92,0xa4,0x84,0x64,0x44,0x24,0x33,0x53,0x73,0x92,0x7c,0x5c,0x3c,0x1c,0x2,0x0,0x0,0x0,0x0,0xd,0x1c,0x38,0x56,0x74,0x91,
+0xa1,0x83,0x66,0x48,0x49,0x67,0x84,0x8c,0x6f,0x51,0x33,0x1a,0x9,0x0,0x0,0x0,0x0,0x4,0x16,0x33,0x52,0x71,0x8f,0xa0,0x81,0x64,0x58,0x76,0x94,0x7a,0x97,0x95,0x77,0x58,0x62,0x80,0x8e,0x70,0x51,0x32,0x15,0x2,0x0,0x0,0x0,0x0,0x12,0x1f,0x35,0x50,0x6b,0x85,0xa0,0x92,0x77,0x7c,0x95,0x7d,0x63,0x49,0x30,0x1e,0x11,0x0,0x0,0x0,0x0,0x0,0x9,0x1a,0x2a,0x46,0x62,0x7e,0x99,0x97,0x7c,0x60,0x6f,0x8a,0x87,0x6c,0x51,0x35,0x1e,0x10,0x0,0x0,0x0,0x0,0x8,0x28,0x48,0x66,0x74,0x74,0x63,0x54,0x6f,0x89,0xa4,
+0x90,0x76,0x5b,0x40,0x25,0x9,0x0,0x0,0x3,0x1f,0x37,0x4f,0x67,0x7f,0x8e,0x7c,0x68,0x54,0x55,0x69,0x7c,0x8f,0x7e,0x66,0x4e,0x36,0x1d,0x2,0x0,0x0,0x9,0x1b,0x26,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x26,0x1b,0x9,0x0,0x0,0x0,0x0,0x0,0xb,0x24,0x3d,0x56,0x6d,0x6f,0x6c,0x52,0x33,0x14,0x0,0x0,0x0,0x1,0x1d,0x37,0x4f,0x62,0x70,0x7b,0x85,0x8c,0x8b,0x96,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x19,0x39,0x59,0x79,0x98,0x9d,0x7e,0x5e,0x4c,0x5c,0x63,0x60,0x52,0x3c,0x22,0x5,0x0,
+0x0,0x0,0x19,0x39,0x58,0x78,0x98,0x9c,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8b,0x6b,0x4b,0x2b,0xb,0x0,0x0,0x13,0x2f,0x46,0x55,0x72,0x91,0x9b,0x7c,0x60,0x60,0x5d,0x48,0x2c,0x15,0x0,0x0,0x0,0x0,0xc,0x2b,0x4b,0x6a,0x87,0xa4,0x89,0x6c,0x5c,0x79,0x97,0x92,0x76,0x57,0x38,0x1f,0xc,0x0,0x0,0x0,0x0,0x7,0x1c,0x37,0x57,0x77,0x97,0x97,0x78,0x5e,0x69,0x6e,0x6c,0x61,0x4f,0x38,0x1e,0x2,0x0,0x0,0x0,0x0,0x11,0x2d,0x44,0x51,0x5b,0x65,0x6e,0x6e,0x59,0x3b,0x1c,0x0,0x0,0x0,0x0,0x6,0x1b,0x36,0x56,0x76,
+0x96,0x99,0x79,0x59,0x67,0x67,0x67,0x67,0x67,0x5b,0x40,0x22,0x2,0x0,0x0,0x0,0x4,0x1a,0x33,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x92,0x9d,0x7d,0x5d,0x54,0x74,0x94,0x9a,0x7a,0x5a,0x54,0x74,0x94,0x9b,0x7b,0x5b,0x3b,0x1b,0x0,0x0,0x0,0x0,0x0,0x14,0x33,0x53,0x73,0x92,0x9d,0x7d,0x5d,0x4d,0x6d,0x8d,0xa1,0x81,0x62,0x42,0x22,0x2,0x0,0x0,0x0,0x19,0x39,0x58,0x78,0x98,0xa0,0x80,0x61,0x41,0x4c,0x6b,0x8b,0xaa,0x8c,0x6d,0x4d,0x2d,0xd,0x0,0x0,0x1,0x16,
+0x36,0x56,0x76,0x96,0x98,0x79,0x59,0x43,0x62,0x7f,0xa1,0x95,0x76,0x56,0x37,0x17,0x0,0x0,0x0,0x0,0x16,0x33,0x53,0x73,0x92,0x9c,0x7c,0x5c,0x51,0x55,0x54,0x43,0x29,0xd,0x0,0x0,0x0,0x0,0x1f,0x3e,0x5d,0x7b,0x97,0xa7,0x90,0x7e,0x6f,0x62,0x59,0x59,0x55,0x41,0x25,0x8,0x0,0x0,0x0,0x1c,0x38,0x4d,0x54,0x54,0x4e,0x59,0x79,0x98,0x9e,0x7e,0x5e,0x4a,0x54,0x54,0x50,0x3c,0x21,0x4,0x0,0x0,0x0,0x12,0x32,0x52,0x72,0x92,0xa4,0x84,0x64,0x44,0x24,0x33,0x53,0x73,0x92,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,
+0x0,0x0,0xf,0x2d,0x4b,0x69,0x86,0xa4,0x8e,0x71,0x53,0x54,0x72,0x8f,0x81,0x64,0x46,0x28,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2b,0x4a,0x69,0x86,0xa5,0x8a,0x6c,0x61,0x7f,0x8f,0x71,0x8e,0x9e,0x80,0x62,0x6a,0x88,0x86,0x68,0x49,0x2a,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x24,0x3f,0x5a,0x75,0x8f,0xa2,0x87,0x8e,0x82,0x6a,0x50,0x36,0x1d,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x37,0x53,0x6f,0x8a,0xa6,0x8a,0x6f,0x7f,0x92,0x77,0x5c,0x40,0x25,0x9,0x0,0x0,0x0,0x0,0x0,0x1,0x1f,0x3a,0x4f,
+0x54,0x54,0x4d,0x65,0x80,0x9a,0x9a,0x80,0x65,0x4a,0x2f,0x14,0x0,0x0,0x0,0xe,0x2d,0x4b,0x65,0x7c,0x89,0x76,0x63,0x4f,0x3b,0x3c,0x4f,0x63,0x77,0x8a,0x7b,0x63,0x49,0x2b,0xc,0x0,0x0,0x0,0x0,0x6,0x7,0x7,0x7,0x7,0x7,0x7,0x7,0x7,0x7,0x7,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x29,0x40,0x4e,0x4f,0x4e,0x3f,0x26,0xa,0x0,0x0,0x0,0xd,0x2b,0x49,0x64,0x7c,0x8c,0x93,0x7f,0x76,0x75,0x94,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x1a,0x3a,0x5a,0x7a,0x99,0x9e,0x7f,0x5f,0x3f,0x3e,
+0x43,0x41,0x3a,0x30,0x1d,0x4,0x0,0x0,0x0,0x19,0x39,0x59,0x79,0x98,0x99,0x7a,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x64,0x48,0x29,0xa,0x0,0x0,0x1c,0x3c,0x5b,0x72,0x7f,0x93,0x9b,0x80,0x80,0x80,0x72,0x52,0x32,0x12,0x0,0x0,0x0,0x0,0x5,0x23,0x42,0x5e,0x78,0x8e,0x97,0x7f,0x79,0x77,0x93,0x80,0x67,0x4c,0x2f,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x97,0x97,0x78,0x7c,0x86,0x8d,0x8a,0x7c,0x65,0x4a,0x2c,0xf,0x0,0x0,0x0,0x0,0x1b,0x3a,0x58,0x6f,0x7a,0x83,0x8d,0x7e,0x5e,0x3e,0x1e,0x0,0x0,
+0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x99,0x79,0x5e,0x7e,0x87,0x87,0x87,0x84,0x65,0x45,0x25,0x5,0x0,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x92,0x9d,0x7d,0x5d,0x54,0x74,0x94,0x9a,0x7a,0x5a,0x54,0x74,0x94,0x9b,0x7b,0x5b,0x3b,0x1b,0x0,0x0,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x92,0x9d,0x7d,0x5d,0x4d,0x6d,0x8d,0xa1,0x81,0x62,0x42,0x22,0x2,0x0,0x0,0x0,0x19,0x39,0x59,0x79,0x98,0xa0,0x7f,0x61,0x41,0x4b,0x6b,0x8a,0xaa,0x8d,0x6e,
+0x4e,0x2e,0xe,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x98,0x79,0x59,0x42,0x62,0x7f,0xa1,0x94,0x75,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x92,0x9c,0x7c,0x5c,0x3c,0x35,0x34,0x29,0x16,0x0,0x0,0x0,0x0,0x0,0x16,0x34,0x51,0x6d,0x85,0x9a,0xaa,0x99,0x8b,0x7f,0x70,0x5e,0x4a,0x32,0x18,0x0,0x0,0x0,0x0,0xb,0x21,0x30,0x34,0x34,0x39,0x59,0x79,0x98,0x9e,0x7e,0x5e,0x3e,0x34,0x34,0x32,0x24,0xf,0x0,0x0,0x0,0x0,0x12,0x32,0x52,0x72,0x92,0xa4,0x84,0x64,0x44,0x24,0x33,0x53,0x73,0x92,0x7c,
+0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x22,0x40,0x5e,0x7c,0x99,0x99,0x7c,0x5e,0x5e,0x7d,0x95,0x77,0x59,0x3b,0x1d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x22,0x41,0x60,0x7f,0x9d,0x92,0x74,0x6a,0x87,0x86,0x68,0x84,0xa3,0x88,0x6b,0x72,0x90,0x7f,0x60,0x41,0x22,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x2e,0x49,0x64,0x7f,0x99,0x9e,0x89,0x70,0x57,0x3d,0x23,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x27,0x43,0x5f,0x7b,0x96,0x9a,0x7e,0x8e,0x82,0x67,0x4c,0x30,0x14,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0xd,0x22,0x31,0x34,0x40,0x5b,0x76,0x90,0xa4,0x89,0x6f,0x54,0x39,0x1e,0x3,0x0,0x0,0x0,0x10,0x30,0x4f,0x6e,0x78,0x71,0x5d,0x49,0x36,0x22,0x22,0x36,0x4a,0x5e,0x71,0x78,0x6d,0x4e,0x2e,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x25,0x2f,0x2f,0x2e,0x24,0x11,0x0,0x0,0x0,0x0,0x15,0x34,0x53,0x72,0x8f,0x9f,0x7f,0x67,0x58,0x75,0x94,0x9b,0x7c,0x5c,0x3c,0x1c,0x5,0x0,0x0,0x0,0x18,0x38,0x57,
+0x77,0x95,0xa3,0x84,0x67,0x4c,0x3e,0x44,0x53,0x5a,0x4a,0x30,0x13,0x0,0x0,0x0,0x17,0x37,0x56,0x75,0x94,0x9e,0x80,0x62,0x4d,0x4d,0x4d,0x4f,0x5e,0x59,0x41,0x25,0x6,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x87,0x94,0x9c,0x87,0x87,0x87,0x72,0x52,0x32,0x12,0x0,0x0,0x0,0x0,0x0,0x17,0x32,0x4c,0x62,0x74,0x80,0x7c,0x85,0x7f,0x77,0x67,0x53,0x3a,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x97,0x98,0x8a,0x8b,0x8a,0x93,0xa7,0x90,0x74,0x56,0x37,0x17,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x8a,0x94,
+0x9d,0x7e,0x5e,0x3e,0x1e,0x0,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x99,0x79,0x5d,0x75,0x7f,0x90,0x7a,0x76,0x63,0x44,0x24,0x5,0x0,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x0,0x15,0x33,0x53,0x73,0x92,0x9d,0x7d,0x5d,0x54,0x74,0x94,0x9a,0x7a,0x5a,0x54,0x74,0x94,0x9b,0x7b,0x5b,0x3b,0x1b,0x5,0x0,0x0,0x0,0x0,0x15,0x33,0x53,0x73,0x92,0x9d,0x7d,0x5d,0x4d,0x6d,0x8d,0xa1,0x81,0x62,0x42,0x22,0xa,0x0,0x0,0x0,0x17,0x36,0x56,0x75,0x93,0xa3,0x83,0x65,
+0x45,0x4e,0x6e,0x8d,0xa7,0x89,0x6a,0x4b,0x2b,0xb,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x98,0x79,0x59,0x49,0x67,0x86,0xa4,0x8e,0x70,0x51,0x32,0x12,0x0,0x0,0x0,0x0,0x16,0x33,0x53,0x73,0x92,0x9c,0x7c,0x5c,0x3c,0x22,0x14,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x26,0x40,0x58,0x6e,0x80,0x71,0x9d,0xa8,0x9a,0x8a,0x77,0x5f,0x45,0x28,0xb,0x0,0x0,0x0,0x0,0x6,0x11,0x14,0x19,0x39,0x59,0x79,0x98,0x9e,0x7e,0x5e,0x3e,0x1e,0x14,0x13,0x8,0x0,0x0,0x0,0x0,0x0,0x12,0x32,0x52,0x72,0x92,0xa4,0x84,0x64,
+0x44,0x24,0x33,0x53,0x73,0x92,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x35,0x53,0x71,0x8e,0xa4,0x86,0x69,0x69,0x86,0x8a,0x6d,0x4e,0x30,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x39,0x58,0x77,0x95,0x9b,0x7d,0x73,0x91,0x7e,0x5f,0x7c,0x9a,0x92,0x74,0x79,0x95,0x77,0x58,0x39,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x21,0x3b,0x55,0x6f,0x8a,0xa6,0x92,0x78,0x5d,0x42,0x27,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x34,0x50,0x6c,0x87,0xa3,0x91,0x8d,0x73,
+0x57,0x3b,0x20,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x1a,0x36,0x51,0x6c,0x86,0xa1,0x93,0x79,0x5e,0x43,0x2c,0x2b,0x20,0xc,0x0,0x0,0x9,0x26,0x41,0x55,0x58,0x55,0x44,0x30,0x1c,0x9,0x9,0x1d,0x31,0x45,0x56,0x58,0x54,0x40,0x25,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0xf,0xf,0xe,0x7,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x96,0x9e,0x7f,0x60,0x5f,0x75,0x94,0x9b,0x7c,0x5c,0x46,0x33,
+0x19,0x0,0x0,0x0,0x12,0x31,0x50,0x6e,0x8a,0xa6,0x91,0x79,0x65,0x5e,0x63,0x6f,0x77,0x59,0x39,0x19,0x0,0x0,0x0,0x11,0x30,0x4f,0x6d,0x89,0xa5,0x8d,0x75,0x62,0x5c,0x60,0x6b,0x7b,0x6a,0x4a,0x2a,0xa,0x0,0x0,0x1a,0x39,0x55,0x67,0x73,0x93,0x9b,0x7c,0x67,0x67,0x64,0x4c,0x2e,0xf,0x0,0x0,0x0,0x0,0x0,0x8,0x1f,0x3d,0x5c,0x7a,0x94,0x7d,0x6f,0x6b,0x64,0x5c,0x50,0x41,0x2c,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x97,0x97,0x78,0x6c,0x6b,0x7d,0x99,0x9a,0x7b,0x5c,0x3c,0x1c,0x0,0x0,0x0,
+0x0,0x1a,0x39,0x56,0x6a,0x72,0x91,0x9d,0x7e,0x5e,0x3e,0x1e,0x0,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x99,0x79,0x63,0x7c,0x92,0x7b,0x63,0x56,0x4d,0x37,0x1b,0x0,0x0,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x10,0x2b,0x42,0x53,0x73,0x92,0x9d,0x7d,0x5d,0x54,0x74,0x94,0x9a,0x7a,0x5a,0x54,0x74,0x94,0x9b,0x7b,0x5b,0x47,0x33,0x18,0x0,0x0,0x0,0x10,0x2b,0x42,0x53,0x73,0x92,0x9d,0x7d,0x5d,0x4d,0x6d,0x8d,0xa1,0x81,0x62,0x4a,0x37,0x1e,0x1,0x0,0x0,0x10,
+0x2f,0x4e,0x6c,0x88,0xa4,0x8a,0x6e,0x52,0x5a,0x76,0x94,0x9a,0x7f,0x62,0x43,0x24,0x5,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x98,0x79,0x59,0x5c,0x74,0x90,0x9c,0x7f,0x65,0x48,0x29,0xb,0x0,0x0,0x0,0x12,0x2d,0x43,0x53,0x73,0x92,0x9c,0x7c,0x5c,0x4c,0x3c,0x24,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0x1f,0x3a,0x4e,0x52,0x55,0x65,0x74,0x80,0x90,0xa4,0xa3,0x8a,0x6f,0x52,0x34,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x39,0x59,0x79,0x98,0x9e,0x7e,0x5e,0x3e,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,
+0x32,0x52,0x72,0x92,0xa4,0x84,0x64,0x44,0x24,0x33,0x53,0x73,0x92,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2a,0x48,0x66,0x83,0xa1,0x91,0x74,0x74,0x91,0x80,0x62,0x44,0x25,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x31,0x50,0x6f,0x8d,0xa3,0x84,0x7c,0x92,0x75,0x56,0x73,0x90,0x9b,0x7d,0x80,0x8d,0x6f,0x50,0x31,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x34,0x4e,0x68,0x81,0x90,0x8e,0xa3,0x88,0x6e,0x53,0x38,0x1d,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x24,
+0x40,0x5d,0x79,0x94,0xa2,0x82,0x62,0x47,0x2b,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2b,0x47,0x62,0x7d,0x97,0x9d,0x82,0x68,0x4d,0x4c,0x4c,0x4a,0x3a,0x21,0x5,0x0,0x0,0x14,0x29,0x36,0x38,0x37,0x2a,0x17,0x3,0x0,0x0,0x4,0x18,0x2b,0x37,0x38,0x36,0x28,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x35,0x55,0x74,0x91,0xa7,0x74,0x7d,0x7e,
+0x87,0x97,0x9b,0x7c,0x6d,0x60,0x43,0x24,0x5,0x0,0x0,0x9,0x27,0x44,0x60,0x7a,0x92,0xa4,0x90,0x7e,0x7e,0x7f,0x8b,0x79,0x59,0x39,0x19,0x0,0x0,0x0,0x8,0x25,0x42,0x5f,0x7a,0x90,0xa1,0x8c,0x7f,0x7c,0x7f,0x88,0x8a,0x6a,0x4a,0x2a,0xa,0x0,0x0,0xe,0x29,0x3e,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x47,0x46,0x37,0x1f,0x4,0x0,0x0,0x0,0x0,0x2,0x1d,0x36,0x4b,0x61,0x80,0xa0,0x92,0x8e,0x89,0x83,0x7a,0x6d,0x59,0x40,0x25,0x8,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x97,0x97,0x78,0x58,0x54,0x73,0x92,0x9d,
+0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0xe,0x29,0x3f,0x52,0x72,0x91,0x9d,0x7e,0x5e,0x3e,0x1e,0x0,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x99,0x79,0x78,0x8f,0x7e,0x66,0x4e,0x37,0x31,0x21,0xa,0x0,0x0,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x1b,0x3a,0x58,0x6d,0x73,0x92,0x9d,0x7d,0x6e,0x6b,0x74,0x94,0x9a,0x7a,0x6d,0x6c,0x74,0x94,0x9b,0x7b,0x6e,0x5f,0x43,0x24,0x4,0x0,0x0,0x1b,0x3a,0x58,0x6d,0x73,0x92,0x9d,0x7d,0x6e,0x69,0x6f,0x8d,0xa1,0x81,0x6e,
+0x65,0x49,0x2a,0xa,0x0,0x0,0x7,0x25,0x42,0x5e,0x78,0x8f,0x98,0x7f,0x6e,0x72,0x7a,0x9c,0x87,0x6f,0x54,0x38,0x1a,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x98,0x79,0x72,0x78,0x89,0x9b,0x87,0x70,0x56,0x3a,0x1e,0x0,0x0,0x0,0x0,0x1c,0x3b,0x59,0x6d,0x73,0x92,0x9c,0x7c,0x6f,0x69,0x50,0x31,0x12,0x0,0x0,0x0,0x0,0x0,0xa,0x29,0x49,0x66,0x72,0x72,0x63,0x57,0x65,0x78,0x8d,0xa8,0x97,0x79,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x39,0x59,0x79,0x98,0x9e,0x7e,0x5e,0x3e,0x1e,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x32,0x52,0x72,0x92,0xa4,0x84,0x65,0x45,0x25,0x34,0x54,0x74,0x93,0x7b,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1f,0x3d,0x5b,0x79,0x96,0x9c,0x7f,0x7e,0x92,0x75,0x57,0x39,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x29,0x47,0x66,0x84,0xa3,0x8c,0x84,0x89,0x6c,0x4d,0x69,0x87,0xa4,0x85,0x88,0x86,0x68,0x49,0x29,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x13,0x2d,0x47,0x61,0x7b,0x94,0x7e,0x7e,0x99,0x99,0x7f,0x64,0x49,0x2e,0x13,0x4,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x33,0x53,0x73,0x93,0xa2,0x82,0x62,0x42,0x22,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x21,0x3c,0x58,0x73,0x8d,0xa7,0x8c,0x72,0x57,0x59,0x6c,0x6c,0x67,0x4c,0x2e,0xf,0x0,0x0,0x0,0xd,0x17,0x18,0x17,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x17,0x18,0x16,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x2d,
+0x4b,0x67,0x7f,0x91,0x96,0x90,0x84,0x76,0x8f,0x90,0x90,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x0,0x19,0x34,0x4e,0x65,0x7a,0x89,0x92,0x95,0x92,0x8a,0x7f,0x72,0x57,0x38,0x19,0x0,0x0,0x0,0x0,0x17,0x33,0x4d,0x64,0x79,0x88,0x92,0x96,0x94,0x8e,0x84,0x77,0x65,0x48,0x29,0x9,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x26,0x1c,0xa,0x0,0x0,0x0,0x0,0x0,0xf,0x2d,0x49,0x63,0x77,0x7f,0x8c,0x86,0x8c,0x92,0x9c,0x97,0x85,0x6d,0x4f,0x31,0x12,0x0,0x0,0x0,0x0,0x0,0x17,0x37,0x57,0x77,0x97,
+0x97,0x78,0x58,0x52,0x72,0x91,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x0,0x13,0x32,0x52,0x72,0x91,0x9d,0x7e,0x5e,0x3e,0x1e,0x0,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x99,0x79,0x8c,0x9a,0x7f,0x64,0x49,0x2e,0x12,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x8f,0x90,0x90,0x90,0x80,0x77,0x8f,0x90,0x90,0x8f,0x80,0x79,0x8f,0x90,0x90,0x8f,0x85,0x65,0x45,0x25,0x5,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x8f,0x90,0x90,0x90,
+0x82,0x72,0x8e,0x90,0x90,0x90,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x16,0x32,0x4b,0x63,0x78,0x87,0x91,0x8d,0x8f,0x8e,0x7f,0x70,0x5b,0x42,0x28,0xc,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x9b,0x8e,0x90,0x90,0x8a,0x7f,0x6f,0x5b,0x43,0x2a,0xf,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x8f,0x90,0x90,0x90,0x8e,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x8a,0x88,0x6a,0x4a,0x4b,0x62,0x7f,0x9d,0x9a,0x7a,0x5b,0x3b,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x21,0x39,0x59,0x79,0x98,
+0x9e,0x7e,0x5e,0x3e,0x24,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x31,0x51,0x71,0x8f,0xa7,0x88,0x6a,0x4b,0x3c,0x3e,0x5b,0x79,0x97,0x78,0x59,0x3a,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x32,0x50,0x6e,0x8b,0xa7,0x89,0x88,0x87,0x6a,0x4c,0x2e,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x20,0x3f,0x5e,0x7d,0x9b,0x95,0x8e,0x80,0x62,0x44,0x60,0x7f,0x9c,0x8e,0x90,0x7f,0x60,0x41,0x22,0x3,0x0,0x0,0x0,0x0,0x0,0xe,0x22,0x2d,0x40,0x5a,0x74,0x8d,0x85,0x6c,0x6e,0x88,0xa3,0x90,0x76,
+0x5b,0x40,0x2d,0x20,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x1f,0x33,0x53,0x73,0x93,0xa2,0x82,0x62,0x42,0x27,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x32,0x4d,0x69,0x83,0x9e,0x96,0x7c,0x61,0x46,0x61,0x80,0x8c,0x70,0x50,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x3,0x1f,0x3a,0x52,0x67,0x74,0x76,0x72,0x68,0x67,0x70,0x70,0x70,0x70,0x62,0x44,0x25,0x5,0x0,0x0,0x0,0x7,0x21,0x38,0x4d,0x5f,0x6c,0x74,0x75,0x73,0x6c,0x63,0x56,0x45,0x2c,0x10,0x0,0x0,0x0,0x0,0x6,0x20,0x37,0x4c,0x5e,0x6b,0x74,0x76,0x75,0x70,0x67,0x5b,0x4c,0x38,0x1e,0x1,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x37,0x56,0x74,0x8f,0x97,0x7a,0x68,0x6d,0x74,0x7f,0x9b,0x94,0x76,0x56,0x36,0x17,0x0,0x0,0x0,
+0x0,0x0,0x17,0x37,0x57,0x77,0x97,0x97,0x78,0x58,0x52,0x72,0x91,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x0,0x12,0x32,0x52,0x72,0x91,0x9d,0x7e,0x5e,0x3e,0x1e,0x0,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x99,0x80,0x86,0xa1,0x8f,0x75,0x5a,0x3e,0x23,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x1c,0x0,0x0,0x0,0x0,0x1b,0x3b,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x6e,0x70,0x70,0x70,0x70,0x70,0x6f,0x70,0x70,0x70,0x70,0x70,0x61,0x43,0x24,0x4,0x0,0x0,0x1b,
+0x3b,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x6b,0x70,0x70,0x70,0x70,0x70,0x66,0x4a,0x2a,0xb,0x0,0x0,0x0,0x5,0x1e,0x36,0x4b,0x5c,0x69,0x72,0x75,0x75,0x70,0x65,0x56,0x43,0x2d,0x15,0x0,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x98,0x79,0x71,0x70,0x6c,0x63,0x55,0x42,0x2d,0x16,0x0,0x0,0x0,0x0,0x0,0x1d,0x3c,0x5a,0x70,0x70,0x70,0x70,0x70,0x70,0x6c,0x51,0x32,0x12,0x0,0x0,0x0,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x8a,0x8c,0x6e,0x54,0x54,0x63,0x7f,0x9d,0x91,0x74,0x56,0x37,0x17,0x0,0x0,0x0,0x0,0x0,
+0x4,0x20,0x3a,0x4c,0x59,0x79,0x98,0x9e,0x7e,0x5e,0x4e,0x3e,0x25,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x2c,0x4c,0x6b,0x89,0xa6,0x91,0x77,0x62,0x5b,0x5d,0x6b,0x7d,0x8f,0x72,0x53,0x34,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x27,0x45,0x63,0x80,0x9e,0x95,0x94,0x7d,0x5f,0x41,0x23,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x37,0x56,0x75,0x93,0xac,0x96,0x78,0x59,0x3b,0x57,0x75,0x93,0xa4,0x95,0x77,0x58,0x39,0x1a,0x0,0x0,0x0,0x0,0x0,0x6,0x22,0x3c,0x4c,0x53,0x6d,0x86,0x8c,
+0x73,0x59,0x5d,0x78,0x93,0xa1,0x86,0x6c,0x52,0x4b,0x39,0x1f,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x1d,0x37,0x4b,0x53,0x73,0x93,0xa2,0x82,0x62,0x50,0x42,0x2a,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x28,0x43,0x5e,0x7a,0x94,0xa0,0x85,0x6b,0x56,0x56,0x65,0x84,0x90,0x70,0x50,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x25,0x3a,0x4b,0x55,0x56,0x53,0x4a,0x4c,0x50,0x50,0x50,0x50,0x4a,0x35,0x1a,0x0,0x0,0x0,0x0,0x0,0xb,0x20,0x33,0x43,0x4e,0x54,0x55,0x54,0x4e,0x45,0x39,0x2a,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x1f,0x32,0x42,0x4d,0x54,0x56,0x56,0x51,0x49,0x3e,0x30,0x20,0xb,0x0,0x0,0x0,0x0,0x16,0x33,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x21,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x3a,0x5a,0x7a,0x9a,0x94,0x75,0x56,0x4e,0x57,0x77,0x96,0x92,
+0x74,0x55,0x35,0x15,0x0,0x0,0x0,0x0,0x2,0x18,0x37,0x57,0x77,0x97,0x97,0x78,0x58,0x52,0x72,0x91,0x9d,0x7d,0x5d,0x3d,0x1d,0x7,0x0,0x0,0x0,0x0,0x16,0x32,0x52,0x72,0x91,0x9d,0x7e,0x5e,0x3e,0x1e,0xa,0x0,0x0,0x0,0x1,0x17,0x36,0x56,0x76,0x96,0x99,0x79,0x76,0x90,0xa0,0x85,0x6a,0x4f,0x34,0x26,0x15,0x0,0x0,0x0,0x0,0x2,0x18,0x33,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x3c,0x1d,0x8,0x0,0x0,0x0,0x12,0x2d,0x44,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,
+0x49,0x34,0x1a,0x0,0x0,0x0,0x12,0x2d,0x44,0x50,0x50,0x50,0x50,0x50,0x50,0x4e,0x50,0x50,0x50,0x50,0x50,0x4c,0x39,0x1f,0x2,0x0,0x0,0x0,0x0,0x8,0x1e,0x31,0x40,0x4c,0x53,0x55,0x55,0x50,0x48,0x3b,0x2a,0x16,0x0,0x0,0x0,0x0,0x0,0xf,0x28,0x3b,0x56,0x76,0x96,0x98,0x79,0x59,0x51,0x4d,0x44,0x39,0x29,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x2e,0x45,0x50,0x50,0x50,0x50,0x50,0x50,0x4f,0x3f,0x26,0x9,0x0,0x0,0x0,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x8a,0x91,0x7a,0x73,0x74,0x7c,0x8f,0x96,0x80,0x66,0x4a,
+0x2d,0xf,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4b,0x67,0x71,0x79,0x98,0x9e,0x7e,0x71,0x6b,0x50,0x31,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x24,0x42,0x5f,0x7b,0x93,0xa3,0x8d,0x80,0x7b,0x7c,0x7c,0x97,0x7f,0x65,0x48,0x2b,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x3a,0x58,0x76,0x93,0xad,0x8f,0x72,0x54,0x36,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2f,0x4e,0x6d,0x8a,0xa9,0x8d,0x6f,0x50,0x32,0x4d,0x6c,0x8a,0xa8,0x8d,0x6f,0x50,0x31,0x12,0x0,0x0,0x0,0x0,0x0,0xf,
+0x2f,0x4d,0x69,0x72,0x80,0x96,0x7a,0x6f,0x5f,0x67,0x71,0x82,0xa0,0x97,0x7d,0x72,0x66,0x4a,0x2b,0xb,0x0,0x0,0x0,0x0,0x0,0x8,0x28,0x47,0x64,0x71,0x75,0x93,0xa2,0x82,0x72,0x6e,0x55,0x36,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x33,0x53,0x6f,0x8a,0xa5,0x8f,0x76,0x76,0x76,0x76,0x76,0x89,0x90,0x70,0x50,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x1f,0x2d,0x35,0x36,0x34,0x2c,0x2e,0x30,0x30,0x30,0x30,0x2c,0x1e,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x18,0x25,0x2f,0x34,0x35,0x34,0x2f,0x26,0x1b,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x17,0x24,0x2e,0x35,0x36,0x36,0x32,0x2a,0x20,0x13,0x5,0x0,0x0,0x0,0x0,0x10,0x2c,0x42,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x4c,0x3b,0x22,0x6,0x0,0x0,0x0,0x0,0x0,0x19,0x38,0x57,0x77,0x92,0x9c,
+0x7f,0x6e,0x67,0x6e,0x7e,0x98,0x7e,0x68,0x4b,0x2d,0xf,0x0,0x0,0x0,0x0,0x14,0x2f,0x45,0x57,0x77,0x97,0x97,0x78,0x58,0x52,0x72,0x91,0x9d,0x7d,0x5d,0x48,0x34,0x1a,0x0,0x0,0x0,0x11,0x2c,0x43,0x52,0x72,0x91,0x9d,0x7e,0x5e,0x49,0x37,0x1d,0x1,0x0,0x0,0x13,0x2e,0x43,0x56,0x76,0x96,0x99,0x79,0x65,0x80,0x9a,0x95,0x7b,0x60,0x4c,0x42,0x2c,0x11,0x0,0x0,0x0,0x15,0x2f,0x44,0x53,0x73,0x93,0x9b,0x7c,0x5c,0x48,0x36,0x1c,0x0,0x0,0x0,0x0,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2c,0x1d,0x7,0x0,0x0,0x0,0x0,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x2f,0x30,0x30,0x30,0x30,0x30,0x2e,0x21,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x15,0x23,0x2d,0x33,0x35,0x35,0x31,0x29,0x1e,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x1d,0x3b,0x55,0x62,0x76,0x96,0x98,0x79,0x63,0x5b,0x42,0x26,0x1b,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x2f,0x25,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x85,0x8e,0x94,0x93,
+0x92,0x93,0x8a,0x7d,0x69,0x53,0x3a,0x1f,0x3,0x0,0x0,0x0,0x0,0x0,0xd,0x2d,0x4d,0x6d,0x8d,0x90,0x90,0x90,0x90,0x90,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x34,0x4e,0x66,0x7b,0x89,0x93,0x97,0x97,0x94,0x8d,0x80,0x6c,0x55,0x3a,0x1e,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2e,0x4c,0x6a,0x87,0x91,0x84,0x67,0x49,0x2b,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x26,0x45,0x64,0x82,0x90,0x84,0x66,0x47,0x29,0x44,0x63,0x80,0x90,0x85,0x67,0x48,0x29,
+0xa,0x0,0x0,0x0,0x0,0x0,0x10,0x30,0x50,0x70,0x90,0x90,0x90,0x90,0x84,0x64,0x6e,0x8d,0x90,0x90,0x90,0x90,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x0,0x9,0x29,0x49,0x69,0x88,0x90,0x90,0x90,0x90,0x90,0x78,0x58,0x38,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x34,0x54,0x74,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x70,0x50,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0xf,0x15,0x16,0x14,0xd,0xf,0x10,0x10,0x10,0x10,0xe,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x10,0x14,0x15,0x14,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0xf,0x15,0x16,0x16,0x12,0xb,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x3a,0x58,0x6e,0x73,0x93,0x9b,0x7c,0x6f,0x68,0x4e,0x2f,0xf,0x0,0x0,0x0,0x0,
+0x0,0x11,0x2f,0x4c,0x67,0x7e,0x8e,0x97,0x8a,0x87,0x8b,0x8d,0x7f,0x6c,0x56,0x3c,0x21,0x4,0x0,0x0,0x0,0x0,0x1f,0x3e,0x5c,0x6e,0x77,0x97,0x97,0x78,0x6d,0x6b,0x72,0x91,0x9d,0x7d,0x6e,0x61,0x44,0x25,0x6,0x0,0x0,0x1c,0x3b,0x59,0x6d,0x72,0x91,0x9d,0x7e,0x6e,0x64,0x48,0x29,0xa,0x0,0x0,0x1e,0x3d,0x5b,0x6d,0x76,0x96,0x99,0x79,0x6d,0x6f,0x89,0xa5,0x8b,0x71,0x6c,0x59,0x3b,0x1c,0x0,0x0,0x0,0x20,0x3f,0x5c,0x6d,0x73,0x93,0x9b,0x7c,0x6e,0x63,0x47,0x28,0x9,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,
+0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xd,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xf,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xe,0x14,0x15,0x15,0x11,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x22,0x42,0x62,0x81,0x84,0x9a,0x9b,0x84,0x82,0x6a,0x4a,0x2a,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,
+0x25,0x43,0x5b,0x68,0x70,0x75,0x77,0x77,0x74,0x6d,0x61,0x51,0x3c,0x26,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4b,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x6c,0x50,0x31,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x21,0x39,0x4e,0x60,0x6c,0x74,0x78,0x78,0x75,0x6f,0x64,0x54,0x3f,0x28,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x23,0x41,0x5f,0x72,0x72,0x72,0x5c,0x3e,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3d,0x5b,0x70,0x70,0x70,0x5c,0x3e,0x1f,0x3b,
+0x59,0x70,0x70,0x70,0x5e,0x40,0x21,0x2,0x0,0x0,0x0,0x0,0x0,0xf,0x2f,0x4e,0x6a,0x70,0x70,0x70,0x70,0x70,0x60,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x67,0x4a,0x2b,0xb,0x0,0x0,0x0,0x0,0x0,0x8,0x28,0x47,0x64,0x70,0x70,0x70,0x70,0x70,0x70,0x6e,0x55,0x36,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x33,0x52,0x6c,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x6a,0x4e,0x2f,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x90,0x90,0x90,0x90,0x8e,0x71,
+0x51,0x31,0x11,0x0,0x0,0x0,0x0,0x0,0x5,0x20,0x3a,0x51,0x64,0x71,0x79,0x7b,0x7b,0x77,0x6f,0x63,0x52,0x3f,0x29,0xf,0x0,0x0,0x0,0x0,0x1,0x21,0x41,0x61,0x80,0x8f,0x90,0x90,0x8f,0x7e,0x76,0x8e,0x90,0x90,0x90,0x87,0x67,0x47,0x27,0x7,0x0,0x0,0x1d,0x3d,0x5d,0x7d,0x8f,0x90,0x90,0x90,0x8b,0x6b,0x4b,0x2b,0xb,0x0,0x0,0x20,0x40,0x60,0x80,0x8f,0x90,0x90,0x8e,0x81,0x62,0x7e,0x90,0x90,0x8e,0x7e,0x5e,0x3e,0x1e,0x0,0x0,0x2,0x22,0x42,0x62,0x81,0x8f,0x90,0x90,0x90,0x8a,0x6a,0x4a,0x2a,0xa,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x22,0x42,0x62,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x6a,0x4a,0x2a,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x2e,0x3f,0x49,0x51,0x55,0x57,0x57,0x55,0x4e,0x44,0x36,0x24,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x21,0x3a,0x4d,0x50,0x50,0x50,0x50,0x50,0x50,0x4f,0x3e,0x25,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x21,0x34,0x43,0x4e,0x55,0x58,0x58,0x56,0x50,0x46,0x38,0x27,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x33,0x49,0x52,0x52,0x52,0x47,0x30,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2f,0x46,
+0x50,0x50,0x50,0x47,0x30,0x15,0x2d,0x44,0x50,0x50,0x50,0x48,0x32,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x23,0x3d,0x4e,0x50,0x50,0x50,0x50,0x50,0x49,0x4d,0x50,0x50,0x50,0x50,0x50,0x50,0x4c,0x3a,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x1d,0x37,0x4b,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x42,0x2a,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x27,0x3f,0x4f,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x4e,0x3d,0x23,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x3b,0x59,
+0x70,0x70,0x70,0x70,0x70,0x70,0x6a,0x4e,0x2f,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x24,0x37,0x48,0x53,0x59,0x5b,0x5b,0x58,0x51,0x46,0x38,0x26,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x3f,0x5d,0x70,0x70,0x70,0x70,0x70,0x70,0x6e,0x70,0x70,0x70,0x70,0x70,0x63,0x45,0x26,0x6,0x0,0x0,0x1c,0x3c,0x5a,0x70,0x70,0x70,0x70,0x70,0x70,0x66,0x49,0x2a,0xa,0x0,0x0,0x1f,0x3f,0x5d,0x70,0x70,0x70,0x70,0x70,0x70,0x5e,0x70,0x70,0x70,0x70,0x70,0x5a,0x3c,0x1d,0x0,0x0,0x1,0x21,0x40,0x5e,0x70,0x70,0x70,0x70,0x70,
+0x70,0x65,0x48,0x29,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x38,0x51,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x56,0x3f,0x23,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x14,0x21,0x2a,0x31,0x35,0x37,0x37,0x35,0x2f,0x26,0x1a,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x22,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x2f,0x24,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x18,0x25,0x2f,0x35,0x38,0x38,0x36,0x31,0x28,0x1c,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x1c,0x2c,0x32,0x32,0x32,0x2b,0x1a,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x2,0x19,0x2a,0x30,0x30,0x30,0x2a,0x1a,0x3,0x18,0x29,0x30,0x30,0x30,0x2b,0x1b,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x23,0x2f,0x30,0x30,0x30,0x30,0x30,0x2c,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x2e,0x21,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x1f,0x2d,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x27,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x25,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2f,0x23,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x12,0x2d,0x44,0x50,0x50,0x50,0x50,0x50,0x50,0x4e,0x3d,0x24,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x1d,0x2a,0x34,0x39,0x3b,0x3b,0x38,0x32,0x29,0x1b,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x31,0x47,0x50,0x50,0x50,0x50,0x50,0x50,0x4f,0x50,0x50,0x50,0x50,0x50,0x4a,0x36,0x1b,0x0,0x0,0x0,0x12,0x2e,0x45,0x50,0x50,0x50,0x50,0x50,0x50,0x4c,0x39,0x1f,0x2,0x0,0x0,0x15,0x30,0x47,0x50,0x50,0x50,0x50,0x50,0x50,0x48,0x50,0x50,0x50,0x50,0x50,0x45,0x2e,0x13,0x0,0x0,0x0,0x17,
+0x32,0x48,0x50,0x50,0x50,0x50,0x50,0x50,0x4c,0x38,0x1e,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x24,0x36,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x39,0x29,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0xb,0x11,0x16,0x17,0x17,0x15,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xf,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x10,0x15,0x18,0x18,0x16,0x11,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xe,0x12,0x12,0x12,0xd,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x10,0x10,0x10,0xc,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0xf,0x10,0x10,0x10,0x10,0x10,0xd,0xf,0x10,0x10,0x10,0x10,0x10,0x10,0xf,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xe,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xf,0x7,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x2f,0x23,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x15,0x1a,0x1b,0x1b,0x18,0x13,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x1a,0x2b,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x2d,0x1e,0x9,0x0,0x0,0x0,0x1,0x18,0x29,0x30,0x30,0x30,0x30,0x30,0x30,0x2e,0x21,0xc,0x0,0x0,0x0,0x4,0x1a,0x2a,0x30,0x30,0x30,0x30,0x30,0x30,0x2b,0x30,0x30,0x30,0x30,0x30,
+0x29,0x18,0x2,0x0,0x0,0x0,0x5,0x1b,0x2b,0x30,0x30,0x30,0x30,0x30,0x30,0x2e,0x20,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x18,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x1a,0xf,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,0x10,0x10,0xf,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xe,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x10,0x10,0x10,0x10,0x10,0x10,0xf,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x10,0x10,0x10,0x10,0x10,
+0x10,0xc,0x10,0x10,0x10,0x10,0x10,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x10,0x10,0x10,0x10,0x10,0x10,0xe,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x6,0x6,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x8,0x9,0x9,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x9,0x9,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x8,0xd,0xf,0xf,0xd,0xb,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0xd,0x10,0x10,0xd,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xd,0x10,0x10,0x9,0x0,
+0x2,0xc,0x10,0x10,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x8,0x8,0x8,0x8,0x8,0x7,0x7,0x8,0x8,0x8,0x8,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x8,0x8,0x8,0x8,0x8,0x7,0x2,0x8,0x8,0x8,0x5,0x4,0x8,0x8,0x8,0x8,0x8,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x8,0x8,0x8,0x8,0x8,0x7,0x8,0x8,0x8,0x8,0x8,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x7,0x7,0x7,0x7,0x7,0x6,0x7,0x7,0x7,0x7,0x7,0x5,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x6,0x7,0x7,0x7,0x7,0x7,0x7,0x7,0x7,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x10,0x12,0x12,0x12,0x12,0x12,0x12,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x1e,0x23,0x26,0x26,0x24,0x1e,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x12,0x12,0x12,0x12,0x12,0x12,0xd,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0xa,0x14,0x1e,0x27,0x29,0x29,0x1f,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x13,0x1c,0x26,0x29,0x29,0x20,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x15,0x1d,0x20,0x1b,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x15,0x20,0x28,0x2d,0x2f,0x2f,0x2d,0x2b,0x27,0x1e,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x1b,0x26,0x2d,0x30,0x30,0x2c,0x27,0x1f,0x14,0x2,0x0,0x0,0x0,0x0,0x0,0x1,0xd,
+0x18,0x22,0x2c,0x30,0x30,0x26,0x16,0x21,0x2b,0x30,0x30,0x27,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x1e,0x27,0x28,0x28,0x28,0x28,0x28,0x26,0x27,0x28,0x28,0x28,0x28,0x24,0x17,0x2,0x0,0x0,0x0,0x0,0xa,0x1c,0x27,0x28,0x28,0x28,0x28,0x28,0x26,0x20,0x28,0x28,0x28,0x24,0x23,0x28,0x28,0x28,0x28,0x28,0x1f,0xe,0x0,0x0,0x0,0x0,0x3,0x17,0x25,0x28,0x28,0x28,0x28,0x28,0x27,0x28,0x28,0x28,0x28,0x28,0x1f,0xe,0x0,0x0,0x0,0x0,0x0,0xa,0x1d,0x26,0x27,0x27,0x27,0x27,0x27,0x26,0x27,0x27,0x27,0x27,0x27,
+0x24,0x17,0x3,0x0,0x0,0x0,0x0,0x7,0x1a,0x26,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x26,0x1b,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xc,0x11,0x13,0x13,0xe,0x1,0x0,0x0,0x0,0x0,0x0,0xd,0x17,0x19,0x19,0x18,0xd,0x0,0x0,0x0,0x0,0x0,0x6,0x11,0x13,0x13,0xf,0xa,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0xd,0x16,0x1c,0x1f,0x1d,0x18,0x10,0x7,0x0,0x0,0x9,0x1b,0x24,0x24,0x19,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x20,0x2f,0x32,0x32,0x32,0x32,0x32,0x32,0x29,0x17,0x0,0x0,0x0,0x0,0x10,0x29,0x3c,0x43,0x46,0x46,0x43,0x3c,0x2a,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x18,0x2a,0x32,0x32,0x32,
+0x32,0x32,0x32,0x2b,0x19,0x2,0x0,0x0,0x0,0x8,0x1c,0x29,0x33,0x3c,0x46,0x49,0x48,0x39,0x22,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x1a,0x28,0x31,0x3b,0x44,0x49,0x49,0x3c,0x25,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x20,0x31,0x3d,0x40,0x3a,0x2d,0x1a,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x23,0x32,0x3e,0x47,0x4d,0x4f,0x4f,0x4d,0x4a,0x47,0x3a,0x23,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x28,0x38,0x45,0x4d,0x50,0x4f,0x4c,0x46,0x3e,0x2f,0x18,
+0x0,0x0,0x0,0x0,0x5,0x1b,0x2b,0x36,0x40,0x4b,0x50,0x4f,0x41,0x35,0x3f,0x49,0x50,0x50,0x43,0x2b,0x10,0x0,0x0,0x0,0x0,0x7,0x22,0x39,0x47,0x48,0x48,0x48,0x48,0x48,0x45,0x47,0x48,0x48,0x48,0x48,0x42,0x30,0x16,0x0,0x0,0x0,0x4,0x1f,0x37,0x46,0x48,0x48,0x48,0x48,0x48,0x45,0x3c,0x48,0x48,0x48,0x43,0x41,0x48,0x48,0x48,0x48,0x47,0x3b,0x24,0x9,0x0,0x0,0x0,0x17,0x30,0x43,0x48,0x48,0x48,0x48,0x48,0x47,0x48,0x48,0x48,0x48,0x47,0x3b,0x25,0xa,0x0,0x0,0x0,0x5,0x20,0x38,0x46,0x47,0x47,0x47,0x47,
+0x47,0x45,0x46,0x47,0x47,0x47,0x47,0x42,0x30,0x17,0x0,0x0,0x0,0x1,0x1c,0x34,0x45,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x47,0x45,0x36,0x1e,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x16,0x23,0x2c,0x30,0x33,0x33,0x2c,0x1b,0x3,0x0,0x0,0x0,0x12,0x28,0x37,0x39,0x39,0x37,0x28,0x13,0x0,0x0,0x0,0xc,0x22,0x30,0x33,0x32,0x2f,0x29,0x1f,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x1d,0x2a,0x35,0x3c,0x3f,0x3c,0x37,0x2f,0x25,0x1b,0x17,0x24,0x36,0x44,0x43,0x33,0x1b,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x1e,0x38,0x4c,0x52,0x52,0x52,0x52,0x52,0x52,0x44,0x2c,0x10,0x0,0x0,0x0,0x1e,0x3c,0x56,0x63,0x66,0x66,0x63,0x57,0x3d,0x20,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x14,0x2e,0x45,0x52,0x52,0x52,0x52,0x52,0x52,0x46,0x2f,0x13,0x0,0x0,0x0,0x1b,0x35,0x47,0x51,0x5b,0x64,0x69,0x66,0x4e,0x30,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x32,0x45,0x50,0x59,0x63,0x69,0x68,0x51,0x34,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x1e,0x38,0x4d,0x5c,0x60,0x58,0x47,0x2f,0x15,0x0,0x0,0x0,0x0,0x0,0x14,0x2a,0x3e,0x4f,0x5c,0x66,0x6d,0x6f,0x6f,0x6d,0x6a,0x66,0x50,0x32,0x14,0x0,0x0,0x0,0x0,0x0,0x11,0x2a,0x41,0x55,0x63,0x6c,
+0x70,0x6f,0x6c,0x65,0x5b,0x44,0x28,0x9,0x0,0x0,0x0,0x17,0x32,0x48,0x54,0x5e,0x69,0x70,0x6e,0x55,0x53,0x5d,0x68,0x70,0x6f,0x57,0x39,0x19,0x0,0x0,0x0,0x0,0x12,0x31,0x4e,0x65,0x68,0x68,0x68,0x68,0x68,0x62,0x65,0x68,0x68,0x68,0x68,0x5d,0x42,0x23,0x4,0x0,0x0,0xe,0x2d,0x4b,0x64,0x68,0x68,0x68,0x68,0x68,0x62,0x53,0x67,0x68,0x68,0x5d,0x5a,0x68,0x68,0x68,0x68,0x66,0x51,0x33,0x15,0x0,0x0,0x5,0x24,0x42,0x5d,0x68,0x68,0x68,0x68,0x68,0x65,0x68,0x68,0x68,0x68,0x67,0x51,0x34,0x15,0x0,0x0,0x0,0x10,
+0x2f,0x4d,0x64,0x67,0x67,0x67,0x67,0x67,0x63,0x65,0x67,0x67,0x67,0x67,0x5d,0x42,0x24,0x5,0x0,0x0,0xb,0x2a,0x48,0x61,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x63,0x4a,0x2d,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x1e,0x32,0x41,0x4b,0x50,0x53,0x53,0x48,0x30,0x14,0x0,0x0,0x6,0x23,0x3f,0x54,0x59,0x59,0x55,0x3f,0x24,0x6,0x0,0x1,0x1e,0x39,0x4e,0x53,0x52,0x4f,0x48,0x3d,0x2d,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x29,0x3a,0x48,0x53,0x5c,0x5f,0x5c,0x56,0x4d,0x44,0x39,0x36,0x41,0x50,
+0x62,0x60,0x48,0x2a,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x30,0x4b,0x65,0x72,0x72,0x72,0x72,0x72,0x71,0x57,0x39,0x19,0x0,0x0,0x2,0x22,0x42,0x62,0x7f,0x85,0x85,0x7e,0x67,0x49,0x2b,0xd,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x25,0x40,0x5a,0x71,0x72,0x72,0x72,0x72,0x72,0x5b,0x3c,0x1c,0x0,0x0,0x9,0x28,0x47,0x62,0x70,0x79,0x82,0x89,0x73,0x53,0x33,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x24,0x43,0x5f,0x6e,0x78,0x80,0x89,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2d,0x4a,0x65,0x79,0x7f,0x73,0x5c,0x41,0x23,0x4,0x0,0x0,0x0,0xe,0x28,0x41,0x57,0x6a,0x79,0x85,0x8b,0x8e,0x8e,0x8c,0x89,0x76,0x56,0x36,0x16,0x0,0x0,0x0,0x0,
+0x3,0x21,0x3d,0x57,0x6e,0x7f,0x8a,0x8f,0x8f,0x8a,0x83,0x6d,0x4d,0x2d,0xd,0x0,0x0,0x1,0x21,0x40,0x5e,0x72,0x7d,0x86,0x8f,0x78,0x5b,0x71,0x7b,0x85,0x8f,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x14,0x34,0x54,0x74,0x87,0x87,0x87,0x87,0x87,0x6f,0x74,0x87,0x87,0x87,0x86,0x66,0x46,0x26,0x6,0x0,0x0,0x11,0x31,0x51,0x71,0x87,0x87,0x87,0x87,0x87,0x6e,0x5e,0x7d,0x87,0x87,0x6a,0x62,0x82,0x87,0x87,0x87,0x77,0x57,0x37,0x17,0x0,0x0,0x7,0x27,0x47,0x67,0x87,0x87,0x87,0x87,0x87,0x73,0x7e,0x87,0x87,0x87,0x78,
+0x58,0x38,0x18,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x87,0x87,0x87,0x87,0x87,0x70,0x74,0x87,0x87,0x87,0x87,0x67,0x47,0x27,0x7,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x70,0x50,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x35,0x4b,0x5e,0x69,0x70,0x73,0x73,0x5c,0x3d,0x1d,0x0,0x0,0xc,0x2c,0x4c,0x6b,0x79,0x79,0x6b,0x4c,0x2c,0xc,0x0,0x8,0x28,0x47,0x66,0x73,0x72,0x6e,0x66,0x58,0x45,0x2d,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0xf,0x2b,0x44,0x56,0x65,0x72,0x7b,0x7d,0x7c,
+0x75,0x6c,0x62,0x58,0x56,0x5e,0x6c,0x7c,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x23,0x40,0x5d,0x77,0x91,0x91,0x91,0x91,0x91,0x75,0x57,0x38,0x19,0x0,0x0,0x0,0x1d,0x3a,0x56,0x73,0x8f,0xa5,0x8f,
+0x72,0x54,0x37,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x34,0x50,0x6c,0x86,0x91,0x91,0x91,0x91,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x8a,0x8e,0x9f,0x93,0x73,0x53,0x33,0x13,0xa,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x26,0x46,0x66,0x86,0x8e,0x9b,0x97,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x34,0x54,0x73,0x70,0x9e,0x79,0x69,0x4a,0x2a,0xa,0x0,0x0,0x1,0x1e,0x3a,0x55,0x6e,0x84,0x95,0x89,0x7a,0x75,0x7b,0x9b,0x94,0x74,
+0x54,0x34,0x14,0x0,0x0,0x0,0x0,0xd,0x2c,0x4a,0x68,0x7d,0x9a,0x7b,0x76,0x77,0x83,0x8d,0x6d,0x4d,0x2d,0xd,0x0,0x0,0x2,0x22,0x42,0x62,0x81,0x88,0x98,0x97,0x78,0x5e,0x7e,0x88,0x96,0x9a,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x14,0x34,0x53,0x71,0x78,0x8a,0xa6,0x86,0x78,0x6c,0x71,0x78,0x8e,0x7f,0x77,0x65,0x46,0x26,0x6,0x0,0x0,0x11,0x30,0x50,0x6e,0x78,0x87,0xa6,0x88,0x78,0x6c,0x68,0x86,0xa4,0x91,0x74,0x61,0x77,0x7d,0x90,0x79,0x73,0x56,0x37,0x17,0x0,0x0,0x7,0x27,0x47,0x66,0x78,0x80,0x99,0x97,
+0x7b,0x6e,0x75,0x81,0x8c,0x79,0x73,0x57,0x37,0x18,0x0,0x0,0x0,0x12,0x32,0x52,0x6f,0x78,0x88,0xa6,0x89,0x77,0x6d,0x70,0x77,0x8c,0x81,0x76,0x65,0x46,0x27,0x7,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0x85,0x7c,0x7c,0x7c,0x8e,0xa3,0x89,0x6f,0x50,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2a,0x47,0x61,0x79,0x87,0x8f,0x90,0x7e,0x5e,0x3e,0x1e,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x9,0x29,0x49,0x69,0x88,0x91,0x8d,0x83,0x72,0x59,0x3e,0x20,0x3,0x0,0x0,0x0,0x0,0x0,0x18,0x38,
+0x57,0x71,0x80,0x8f,0x99,0x96,0x99,0x93,0x77,0x7f,0x77,0x75,0x7c,0x87,0x8e,0x6e,0x4e,0x2e,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x30,0x4e,0x6b,0x87,0xa3,0xab,0xab,0xa0,0x85,0x69,0x4c,0x2e,0x10,0x0,0x0,0x0,
+0xf,0x2c,0x48,0x65,0x80,0x9d,0x9b,0x7e,0x61,0x42,0x25,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x23,0x41,0x5f,0x7b,0x97,0xab,0xab,0xad,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x9,0x29,0x48,0x64,0x6e,0x7c,0x9c,0x93,0x73,0x53,0x33,0x2e,0x29,0x20,0x12,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x1b,0x26,0x44,0x61,0x6f,0x77,0x97,0x97,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x34,0x54,0x73,0x91,0x9f,0x79,0x6a,0x4a,0x2a,0xb,0x0,0x0,0xc,0x2a,0x48,0x65,0x7f,0x9a,0x8d,
+0x73,0x5d,0x5b,0x7b,0x9b,0x94,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0x12,0x32,0x51,0x71,0x90,0x9d,0x7e,0x60,0x5d,0x7d,0x8d,0x6d,0x4d,0x2d,0xd,0x0,0x0,0x0,0x1f,0x3e,0x5a,0x69,0x78,0x97,0x97,0x78,0x58,0x69,0x75,0x94,0x9a,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0xd,0x2a,0x44,0x55,0x62,0x80,0x9d,0x90,0x73,0x55,0x5d,0x7b,0x90,0x73,0x57,0x4f,0x39,0x1d,0x0,0x0,0x0,0x9,0x27,0x41,0x54,0x60,0x7f,0x9d,0x8f,0x71,0x54,0x72,0x90,0x8f,0x9b,0x7d,0x5e,0x66,0x84,0x86,0x69,0x56,0x46,0x2c,0xf,0x0,0x0,0x0,
+0x1e,0x3a,0x50,0x58,0x6d,0x87,0xa1,0x8c,0x72,0x7a,0x92,0x7a,0x60,0x56,0x46,0x2d,0x10,0x0,0x0,0x0,0xb,0x28,0x42,0x53,0x60,0x7e,0x9a,0x93,0x76,0x58,0x5b,0x79,0x93,0x76,0x59,0x4e,0x39,0x1d,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x8d,0x80,0x60,0x6c,0x85,0x9f,0x91,0x78,0x5e,0x43,0x28,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x35,0x53,0x71,0x8d,0x99,0x80,0x71,0x6e,0x59,0x3b,0x1c,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x8,0x27,0x46,0x63,0x6f,0x75,0x87,0x9e,0x84,0x68,0x49,0x2a,0xb,
+0x0,0x0,0x0,0x0,0x0,0x19,0x39,0x59,0x79,0x95,0x87,0x7c,0x77,0x7b,0x7e,0x8c,0x96,0x96,0x95,0x99,0x8d,0x7e,0x6b,0x4d,0x2e,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x3b,0x5a,0x78,0x94,0x90,0x8b,0x8b,0x8b,0x75,
+0x5a,0x3f,0x22,0x5,0x0,0x0,0x0,0x1,0x1d,0x3a,0x56,0x73,0x8f,0xa6,0x89,0x6c,0x4e,0x31,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x2b,0xb6,0x6a,0x87,0x8b,0x8b,0x8b,0x90,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x1d,0x37,0x4a,0x5c,0x7c,0x9c,0x93,0x73,0x53,0x4e,0x4e,0x48,0x3d,0x2d,0x1a,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x16,0x29,0x38,0x44,0x4d,0x50,0x57,0x77,0x97,0x97,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x2d,0x4a,0x65,0x7b,0x80,0x74,0x5d,0x41,0x23,0x5,0x0,0x0,
+0x14,0x33,0x52,0x71,0x8e,0xa2,0x7e,0x65,0x47,0x5b,0x7b,0x9b,0x94,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0x12,0x32,0x51,0x71,0x8f,0xa6,0x74,0x7b,0x6d,0x74,0x75,0x6b,0x4c,0x2d,0xd,0x0,0x0,0x0,0x13,0x2d,0x41,0x58,0x78,0x97,0x97,0x78,0x58,0x55,0x75,0x94,0x9a,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x0,0x16,0x2a,0x39,0x57,0x75,0x92,0x9b,0x7d,0x5f,0x69,0x85,0x84,0x67,0x49,0x32,0x22,0xc,0x0,0x0,0x0,0x0,0x14,0x29,0x39,0x57,0x76,0x94,0x97,0x79,0x5e,0x7c,0x8c,0x84,0xa3,0x85,0x68,0x70,0x8d,0x7e,0x5f,
+0x41,0x2c,0x19,0x0,0x0,0x0,0x0,0xd,0x23,0x32,0x41,0x5b,0x75,0x8e,0x9d,0x83,0x8b,0x7f,0x66,0x4d,0x36,0x2c,0x19,0x0,0x0,0x0,0x0,0x0,0x14,0x28,0x36,0x54,0x72,0x8e,0x9e,0x80,0x63,0x66,0x83,0x87,0x6a,0x4c,0x31,0x22,0xc,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6d,0x7a,0x79,0x64,0x7e,0x97,0x99,0x80,0x65,0x4b,0x31,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x3a,0x5a,0x79,0x98,0x90,0x72,0x53,0x4e,0x43,0x2d,0x12,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x1b,0x35,0x49,0x4f,0x5e,
+0x7d,0x9b,0x8d,0x6f,0x4f,0x2f,0x10,0x0,0x0,0x0,0x0,0x0,0x19,0x39,0x59,0x79,0x7a,0x6b,0x5e,0x57,0x5c,0x64,0x6e,0x79,0x7f,0x7f,0x7b,0x71,0x63,0x52,0x3e,0x24,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,
+0x7e,0x9d,0x8b,0x6c,0x6c,0x6c,0x61,0x48,0x2e,0x13,0x0,0x0,0x0,0x0,0x0,0xf,0x2c,0x48,0x65,0x7f,0x9e,0x95,0x78,0x5b,0x3d,0x1f,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x29,0x48,0x63,0x6c,0x6c,0x6c,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0xa,0x1e,0x3c,0x5c,0x7c,0x9c,0x93,0x73,0x67,0x6e,0x6e,0x67,0x59,0x47,0x32,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x2e,0x43,0x55,0x63,0x6c,0x70,0x6f,0x77,0x97,0x97,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x29,0x41,0x4f,0x59,0x62,0x6c,
+0x6e,0x5f,0x42,0x23,0x3,0x0,0x0,0x18,0x38,0x58,0x77,0x96,0x9e,0x7e,0x5f,0x3f,0x5b,0x7b,0x9b,0x94,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0xd,0x2b,0x49,0x66,0x7f,0x94,0xa4,0x96,0x78,0x7b,0x6a,0x56,0x3e,0x23,0x6,0x0,0x0,0x0,0x0,0x18,0x38,0x58,0x78,0x97,0x97,0x78,0x58,0x55,0x75,0x94,0x9a,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2e,0x4c,0x6a,0x87,0xa5,0x87,0x6a,0x74,0x91,0x79,0x5b,0x3e,0x20,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x30,0x4e,0x6d,0x8b,0xa0,0x81,0x68,0x85,0x82,0x7c,
+0x99,0x8f,0x71,0x79,0x92,0x74,0x56,0x37,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x14,0x2e,0x49,0x63,0x7d,0x96,0x98,0x84,0x6c,0x53,0x39,0x20,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x2a,0x48,0x66,0x83,0xa0,0x8c,0x6f,0x72,0x8f,0x7b,0x5e,0x40,0x23,0x7,0x0,0x0,0x0,0x0,0x8,0x25,0x41,0x56,0x5a,0x5c,0x76,0x8f,0xa1,0x87,0x6d,0x53,0x39,0x30,0x1c,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x3b,0x5b,0x7b,0x9b,0x8e,0x6f,0x4f,0x2f,0x27,0x17,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,
+0x0,0x0,0x8,0x1d,0x2b,0x3a,0x5a,0x79,0x99,0x90,0x71,0x51,0x31,0x11,0x0,0x0,0x0,0x0,0x0,0x16,0x35,0x53,0x68,0x5f,0x4e,0x40,0x37,0x3d,0x46,0x50,0x5a,0x60,0x61,0x5d,0x53,0x47,0x37,0x26,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x4c,0x4c,0x47,0x33,0x1b,0x1,0x0,0x0,0x0,0x0,0x0,0x1,0x1d,0x3a,0x57,0x74,0x8f,0xa1,0x83,0x67,0x49,0x2b,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1d,0x36,0x48,0x4c,0x4c,0x4c,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x9c,0x93,0x7a,0x85,0x8c,0x8c,0x84,0x74,0x5f,0x46,0x2b,0xf,0x0,0x0,0x0,0x0,0x11,0x2b,0x44,0x5b,0x70,0x7e,0x8a,0x8f,0x8e,0x8a,0x98,0x97,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x0,0x0,
+0x17,0x36,0x54,0x6d,0x77,0x80,0x8a,0x84,0x64,0x44,0x24,0x4,0x0,0x0,0x19,0x39,0x59,0x79,0x98,0x9e,0x7e,0x5f,0x3f,0x5b,0x7b,0x9b,0x94,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0xf,0x2c,0x46,0x57,0x68,0x7a,0x78,0x95,0xa3,0x95,0x7e,0x6a,0x4d,0x2f,0x11,0x0,0x0,0x0,0x0,0x18,0x38,0x58,0x78,0x97,0x97,0x78,0x58,0x55,0x75,0x94,0x9a,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x23,0x41,0x5f,0x7d,0x9a,0x92,0x75,0x80,0x8a,0x6d,0x50,0x32,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x27,0x45,0x64,
+0x82,0xa0,0x8a,0x72,0x8f,0x79,0x72,0x90,0x98,0x7b,0x81,0x88,0x6b,0x4c,0x2e,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x27,0x40,0x59,0x72,0x8b,0x9b,0x91,0x78,0x5e,0x43,0x29,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1f,0x3c,0x5a,0x78,0x94,0x97,0x7a,0x7e,0x8c,0x6f,0x52,0x34,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x2a,0x3a,0x54,0x6e,0x88,0xa2,0x8e,0x75,0x5b,0x59,0x59,0x4a,0x30,0x13,0x0,0x0,0x0,0x0,0x3,0x14,0x1d,0x3b,0x5b,0x7b,0x9b,0x8e,0x6f,0x4f,0x2f,0xf,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,
+0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x1,0x19,0x39,0x59,0x79,0x99,0x90,0x71,0x51,0x31,0x1b,0xf,0x0,0x0,0x0,0x0,0xb,0x26,0x3c,0x48,0x44,0x33,0x23,0x18,0x1e,0x28,0x32,0x3b,0x40,0x41,0x3d,0x35,0x2a,0x1c,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x4c,0x2c,0x29,0x1b,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2d,0x49,0x67,0x7d,0xa0,0x8f,0x73,0x55,0x38,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x1d,0x29,0x2c,0x2c,0x4c,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x9c,0x94,0x7a,0x83,0x89,0x98,0x9f,0x8b,0x72,0x57,0x3a,0x1d,0x0,0x0,0x0,0x3,0x20,0x3c,0x58,0x71,0x87,0x9b,0x88,0x79,0x75,0x7c,0x97,0x97,0x77,0x57,0x37,
+0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x38,0x58,0x78,0x8a,0x8e,0xa4,0x84,0x64,0x44,0x24,0x4,0x0,0x0,0x18,0x37,0x57,0x76,0x95,0xa2,0x7d,0x66,0x4a,0x5b,0x7b,0x9b,0x94,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x73,0x78,0x70,0x6c,0x7a,0x78,0x9f,0x93,0x75,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x18,0x38,0x58,0x78,0x97,0x97,0x78,0x58,0x55,0x75,0x94,0x9a,0x7a,0x5a,0x3a,0x1a,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x36,0x54,0x72,0x8f,0x9d,0x80,0x8b,0x7f,0x62,0x44,0x26,0x8,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x1d,0x3c,0x5b,0x79,0x97,0x93,0x7c,0x8c,0x6f,0x69,0x86,0xa2,0x83,0x8b,0x80,0x61,0x43,0x24,0x5,0x0,0x0,0x0,0x0,0x0,0x8,0x1c,0x29,0x3a,0x54,0x6d,0x85,0x85,0x88,0xa3,0x89,0x70,0x56,0x3b,0x28,0x19,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x30,0x4e,0x6c,0x89,0xa2,0x85,0x88,0x80,0x63,0x46,0x28,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x17,0x32,0x4c,0x66,0x80,0x9a,0x96,0x7d,0x63,0x71,0x79,0x77,0x59,0x3a,0x1a,0x0,0x0,0x0,0x0,0x1a,0x30,0x3c,0x3d,0x5c,0x7c,0x9b,0x8c,0x6d,0x4d,0x2e,0xe,
+0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x19,0x39,0x59,0x78,0x97,0x90,0x71,0x52,0x3d,0x39,0x29,0x11,0x0,0x0,0x0,0x0,0x10,0x20,0x29,0x26,0x18,0x7,0x0,0x0,0x9,0x14,0x1c,0x20,0x21,0x1e,0x16,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x1f,0x3c,0x59,0x76,0x93,0x9c,0x7f,0x62,0x45,0x28,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0xa,0xc,0x2c,0x4c,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x9c,0x93,0x73,0x64,0x6c,0x80,0x9b,0x9d,0x80,0x64,0x45,0x26,0x7,0x0,0x0,0xd,0x2c,0x4a,0x67,0x84,0x9d,0x8d,0x72,0x5c,
+0x57,0x77,0x97,0x97,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x35,0x52,0x69,0x6a,0x8a,0xa4,0x84,0x64,0x44,0x24,0x4,0x0,0x0,0x13,0x32,0x51,0x6f,0x8d,0xa9,0x8f,0x77,0x64,0x60,0x7b,0x9b,0x94,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x94,0x75,0x55,0x5d,0x76,0x95,0x94,0x75,0x56,0x36,0x16,0x0,0x0,0x0,0x0,0x18,0x37,0x57,0x77,0x96,0x9b,0x7d,0x65,0x62,0x75,0x94,0x9a,0x7a,0x5a,0x47,0x32,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x2b,0x49,0x67,0x84,0xa2,0x89,0x90,0x74,0x56,
+0x38,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x14,0x33,0x52,0x70,0x8e,0x9b,0x86,0x82,0x65,0x5f,0x7e,0x9b,0x8c,0x94,0x76,0x57,0x39,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x35,0x48,0x4f,0x67,0x80,0x8e,0x74,0x78,0x91,0x9b,0x81,0x68,0x4e,0x45,0x31,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x25,0x42,0x60,0x7e,0x9a,0x90,0x91,0x75,0x57,0x39,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x29,0x44,0x5e,0x79,0x92,0x9e,0x84,0x6b,0x56,0x76,0x95,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0xe,0x2b,0x47,0x5b,0x5d,0x66,
+0x7f,0x9e,0x7d,0x66,0x48,0x29,0x9,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x15,0x34,0x53,0x72,0x8e,0x95,0x78,0x60,0x5d,0x56,0x3e,0x21,0x3,0x0,0x0,0x0,0x0,0x3,0x9,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x2f,0x4d,0x6a,0x7a,0xa4,0x8c,0x6f,0x52,0x34,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x9c,0x93,0x73,0x53,0x54,0x71,0x8e,0xa9,0x8a,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x14,0x34,
+0x53,0x72,0x90,0xa1,0x7e,0x64,0x46,0x57,0x77,0x97,0x97,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x26,0x3d,0x4a,0x6a,0x8a,0xa4,0x84,0x64,0x44,0x24,0x4,0x0,0x0,0xa,0x29,0x46,0x63,0x7e,0x96,0xa3,0x8e,0x7e,0x80,0x7d,0x9b,0x94,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x96,0x7b,0x6e,0x6d,0x7e,0x99,0x88,0x6d,0x4f,0x30,0x11,0x0,0x0,0x0,0x0,0x14,0x34,0x53,0x72,0x90,0xa8,0x90,0x7d,0x7e,0x88,0x97,0x9a,0x7a,0x6e,0x5f,0x42,0x23,0x4,0x0,0x0,0x0,0x0,0x0,0x1,0x20,0x3e,
+0x5c,0x7a,0x97,0xa2,0x85,0x68,0x4a,0x2c,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb,0x2a,0x49,0x67,0x85,0xa4,0x97,0x79,0x5b,0x56,0x74,0x92,0xa6,0x8a,0x6c,0x4e,0x2f,0x11,0x0,0x0,0x0,0x0,0x0,0x8,0x27,0x46,0x62,0x6e,0x7b,0x93,0x7d,0x69,0x66,0x80,0x9b,0x93,0x7a,0x6d,0x5e,0x41,0x22,0x3,0x0,0x0,0x0,0x0,0x0,0x10,0x1d,0x36,0x54,0x72,0x8f,0xa3,0x85,0x68,0x4b,0x2d,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x33,0x52,0x71,0x8a,0xa4,0x8c,0x74,0x74,0x74,0x7a,0x99,0x7a,0x5a,0x3a,0x1a,0x0,0x0,
+0x0,0x13,0x33,0x53,0x73,0x7d,0x7e,0x92,0x86,0x72,0x59,0x3d,0x1f,0x1,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0xd,0x2a,0x47,0x63,0x7b,0x8b,0x8a,0x7e,0x7d,0x68,0x48,0x28,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x23,0x40,0x5d,0x7b,0x97,0x98,0x7c,0x5e,0x42,0x24,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x9c,0x93,0x73,0x53,0x4a,0x6a,0x89,0xa8,0x8d,0x6e,
+0x4e,0x2e,0xe,0x0,0x0,0x18,0x38,0x58,0x78,0x97,0x9d,0x7e,0x5e,0x3e,0x57,0x77,0x97,0x97,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x2a,0x4a,0x6a,0x8a,0xa4,0x84,0x64,0x44,0x24,0x4,0x0,0x0,0x0,0x1b,0x37,0x51,0x6a,0x7e,0x8c,0x92,0x8f,0x86,0x7b,0x9b,0x94,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0x16,0x36,0x56,0x76,0x8c,0x92,0x8d,0x8c,0x92,0x87,0x74,0x5d,0x42,0x25,0x8,0x0,0x0,0x0,0x0,0xd,0x2b,0x49,0x66,0x7f,0x90,0x96,0x90,0x85,0x76,0x90,0x90,0x8f,0x84,0x65,0x45,0x25,0x5,0x0,
+0x0,0x0,0x0,0x0,0x0,0x14,0x33,0x51,0x6f,0x8c,0x90,0x7a,0x5c,0x3e,0x21,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x21,0x40,0x5e,0x7d,0x90,0x8d,0x6f,0x51,0x4c,0x6b,0x89,0x90,0x80,0x63,0x44,0x26,0x7,0x0,0x0,0x0,0x0,0x0,0x9,0x29,0x49,0x69,0x89,0x90,0x90,0x8f,0x73,0x72,0x8d,0x90,0x90,0x90,0x84,0x64,0x44,0x24,0x4,0x0,0x0,0x0,0x0,0x16,0x2b,0x3b,0x41,0x48,0x66,0x83,0x96,0x7a,0x5c,0x3f,0x21,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x90,0x90,0x90,0x90,0x90,0x90,0x90,
+0x90,0x7a,0x5a,0x3a,0x1a,0x0,0x0,0x0,0x13,0x33,0x53,0x73,0x88,0x8c,0x86,0x7c,0x69,0x52,0x37,0x1b,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x8,0x25,0x41,0x5b,0x71,0x80,0x89,0x8a,0x87,0x68,0x48,0x28,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x34,0x51,0x6e,0x8b,0xa5,0x88,0x6c,0x4f,0x32,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x9c,0x93,0x73,
+0x53,0x49,0x68,0x88,0xa8,0x8c,0x6c,0x4c,0x2d,0xd,0x0,0x0,0x19,0x39,0x59,0x79,0x98,0x9d,0x7e,0x5e,0x3f,0x57,0x77,0x97,0x97,0x77,0x57,0x37,0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x8a,0xa4,0x84,0x64,0x44,0x24,0x4,0x0,0x0,0x0,0xa,0x24,0x3d,0x52,0x63,0x6f,0x73,0x71,0x68,0x7b,0x9b,0x94,0x74,0x54,0x34,0x14,0x0,0x0,0x0,0x0,0x14,0x32,0x50,0x66,0x6e,0x73,0x77,0x77,0x74,0x6b,0x5b,0x47,0x30,0x16,0x0,0x0,0x0,0x0,0x0,0x1,0x1e,0x39,0x52,0x66,0x73,0x76,0x73,0x68,0x6d,0x70,0x70,
+0x70,0x70,0x61,0x43,0x24,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x27,0x45,0x63,0x70,0x70,0x6c,0x50,0x33,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x36,0x55,0x6e,0x70,0x70,0x64,0x47,0x43,0x61,0x70,0x70,0x70,0x59,0x3b,0x1c,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x28,0x47,0x64,0x70,0x70,0x70,0x70,0x6c,0x6b,0x70,0x70,0x70,0x70,0x70,0x60,0x42,0x23,0x3,0x0,0x0,0x0,0x11,0x2c,0x44,0x57,0x61,0x52,0x62,0x7e,0x8a,0x6e,0x50,0x33,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x31,0x50,0x6c,
+0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x6f,0x57,0x38,0x19,0x0,0x0,0x0,0x10,0x2f,0x4d,0x65,0x68,0x70,0x87,0x95,0x7e,0x62,0x45,0x26,0x7,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x12,0x31,0x50,0x6d,0x87,0x99,0x7d,0x6b,0x68,0x5e,0x43,0x25,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x27,0x45,0x62,0x7f,0x9c,0x96,0x7a,0x5d,0x40,0x23,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,
+0x1c,0x3c,0x5c,0x7c,0x9c,0x93,0x73,0x53,0x4e,0x6d,0x8b,0xa2,0x84,0x67,0x47,0x28,0x9,0x0,0x0,0x17,0x37,0x57,0x76,0x95,0xa1,0x7d,0x65,0x49,0x57,0x77,0x97,0x97,0x77,0x57,0x37,0x17,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x8a,0xa4,0x84,0x64,0x44,0x24,0x4,0x0,0x0,0x0,0x0,0xf,0x25,0x38,0x46,0x4f,0x53,0x51,0x5b,0x7b,0x9b,0x94,0x74,0x54,0x39,0x25,0xc,0x0,0x0,0x0,0x8,0x23,0x3a,0x47,0x4f,0x54,0x57,0x57,0x54,0x4c,0x40,0x2f,0x1a,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x25,0x3a,0x4a,
+0x54,0x56,0x53,0x4b,0x4f,0x50,0x50,0x50,0x50,0x49,0x34,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x36,0x4a,0x50,0x50,0x4f,0x3e,0x25,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2a,0x42,0x50,0x50,0x50,0x4b,0x37,0x34,0x49,0x50,0x50,0x50,0x44,0x2d,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1d,0x37,0x4b,0x50,0x50,0x50,0x50,0x4f,0x4e,0x50,0x50,0x50,0x50,0x50,0x49,0x34,0x19,0x0,0x0,0x0,0x0,0x1e,0x3c,0x58,0x71,0x7f,0x6d,0x71,0x8c,0x7e,0x61,0x44,0x26,0x9,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x9,0x25,0x3e,0x4f,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x50,0x43,0x2b,0xf,0x0,0x0,0x0,0x5,0x21,0x38,0x46,0x49,0x5f,0x7e,0x9d,0x8a,0x6c,0x4d,0x2d,0xe,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x18,0x38,0x58,0x77,0x95,0x91,0x72,0x53,0x48,0x43,0x31,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x39,0x56,0x74,0x90,0xa4,0x87,0x6b,0x4e,0x31,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8c,0x9d,0x7d,
+0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x9c,0x93,0x73,0x54,0x61,0x7a,0x95,0x92,0x78,0x5c,0x3e,0x20,0x1,0x0,0x0,0x13,0x32,0x51,0x6f,0x8d,0xaa,0x8f,0x75,0x63,0x62,0x77,0x97,0x97,0x77,0x57,0x44,0x2e,0x14,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x2a,0x4a,0x6a,0x8a,0xa4,0x84,0x64,0x44,0x24,0x4,0x0,0x0,0x0,0x0,0x0,0xb,0x1c,0x28,0x30,0x46,0x5d,0x63,0x7b,0x9b,0x94,0x74,0x62,0x52,0x37,0x19,0x0,0x0,0x0,0x0,0xd,0x1e,0x28,0x2f,0x34,0x37,0x37,0x34,0x2e,0x23,0x14,0x2,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0xd,0x1f,0x2d,0x34,0x36,0x34,0x2c,0x30,0x30,0x30,0x30,0x30,0x2c,0x1d,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x1e,0x2d,0x30,0x30,0x2f,0x24,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x27,0x30,0x30,0x30,0x2d,0x1f,0x1d,0x2c,0x30,0x30,0x30,0x29,0x18,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x1f,0x2d,0x30,0x30,0x30,0x30,0x2f,0x2f,0x30,0x30,0x30,0x30,0x30,0x2c,0x1c,0x7,0x0,0x0,0x0,0x5,0x25,0x45,0x65,0x7e,0x98,0x86,0x7d,0x87,0x6e,0x53,
+0x36,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x24,0x2f,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x28,0x16,0x0,0x0,0x0,0x0,0x0,0xb,0x1d,0x27,0x3c,0x5b,0x7b,0x9b,0x8f,0x70,0x50,0x30,0x10,0x0,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x1a,0x3a,0x5a,0x7a,0x99,0x90,0x70,0x50,0x30,0x25,0x18,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2d,0x4a,0x68,0x85,0xa2,0x95,0x79,0x5c,0x40,0x24,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0xc,0x2c,0x4c,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x9c,0x93,0x73,0x74,0x7c,0x8d,0x92,0x7e,0x66,0x4c,0x31,0x14,0x0,0x0,0x0,0xa,0x29,0x47,0x63,0x7e,0x98,0xa1,0x8d,0x7e,0x7f,0x88,0x99,0x97,0x77,0x6d,0x5b,0x3e,0x1f,0x0,0x0,0x0,0x0,0x0,0xe,0x19,0x2a,0x4a,0x6a,0x8a,0xa3,0x83,0x64,0x44,0x24,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6e,0x82,0x86,0x9b,0x97,0x83,0x7e,0x5e,0x3e,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x10,0x15,0x17,0x17,0x15,0xf,
+0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0xe,0x15,0x16,0x14,0xe,0x10,0x10,0x10,0x10,0x10,0xd,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0xe,0x10,0x10,0x10,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x10,0x10,0x10,0xe,0x4,0x2,0xd,0x10,0x10,0x10,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xe,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xd,0x1,0x0,0x0,0x0,0x0,0x5,0x25,0x44,0x63,
+0x80,0x98,0x9a,0x8a,0x74,0x5c,0x42,0x27,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x3b,0x5b,0x7b,0x9b,0x8f,0x70,0x50,0x30,0x17,0x8,0x0,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x0,0xe,0x1a,0x3a,0x5a,0x7a,0x99,0x90,0x70,0x50,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x4c,0x2c,0x20,0x1e,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x20,0x3e,0x5c,0x7a,0x96,0xa3,0x87,0x6b,0x4f,0x33,0x16,
+0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x1e,0x2c,0x4c,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x1c,0x3c,0x5c,0x7c,0x8f,0x90,0x90,0x90,0x8c,0x84,0x78,0x66,0x51,0x39,0x20,0x5,0x0,0x0,0x0,0x0,0x1c,0x38,0x52,0x6b,0x80,0x90,0x96,0x91,0x85,0x77,0x90,0x90,0x8e,0x80,0x61,0x41,0x21,0x1,0x0,0x0,0x0,0x15,0x29,0x37,0x3e,0x4b,0x6b,0x8a,0xa1,0x7e,0x62,0x42,0x23,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x2e,0x4e,0x6d,0x7c,0x7c,0x7c,0x7c,0x7c,0x7b,0x5e,0x3e,0x1e,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x1c,0x39,0x55,0x6c,0x7b,0x7c,0x70,0x5d,0x47,0x2f,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x3b,0x5b,0x7b,0x9b,0x8f,0x70,0x50,0x3c,0x34,0x21,0x9,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x12,0x29,0x39,0x3d,0x5b,0x7b,0x9a,0x8f,0x70,0x50,0x30,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x4c,0x40,0x40,0x3d,0x2d,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x33,0x50,0x6e,
+0x88,0x8b,0x8a,0x7b,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x0,0x15,0x2c,0x3c,0x40,0x4c,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x1b,0x3b,0x59,0x70,0x70,0x71,0x71,0x70,0x6d,0x67,0x5b,0x4c,0x39,0x24,0xc,0x0,0x0,0x0,0x0,0x0,0xc,0x26,0x3e,0x54,0x66,0x73,0x76,0x73,0x69,0x6e,0x70,0x70,0x70,0x70,0x5d,0x3f,0x20,0x0,0x0,0x0,0x10,0x2b,0x43,0x55,0x5e,0x53,0x6b,0x8b,0x9d,0x7f,0x5f,0x40,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x26,0x42,0x58,0x5c,0x5c,0x5c,0x5c,0x5c,0x5c,0x4e,0x35,
+0x17,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x28,0x3f,0x52,0x5c,0x5c,0x53,0x44,0x30,0x1a,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x19,0x38,0x58,0x77,0x95,0x93,0x75,0x5f,0x5c,0x4f,0x35,0x18,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x4,0x22,0x3e,0x56,0x5c,0x64,0x80,0x9e,0x8a,0x6c,0x4c,0x2d,0xd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x6c,0x60,0x60,0x60,0x5a,0x42,0x25,0x6,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x9,0x27,0x44,0x5e,0x69,0x6b,0x6b,0x67,0x55,0x39,0x1a,0x0,0x0,0x0,0x0,0xe,0x28,0x42,0x59,0x60,0x60,0x6c,0x8c,0x9d,0x7d,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x11,0x2d,0x44,0x50,0x50,0x51,0x51,0x51,0x4d,0x48,0x3e,0x30,0x20,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,0x27,0x3a,0x4a,0x53,0x56,0x54,0x4b,0x50,0x50,0x50,0x50,0x50,0x47,0x31,0x16,0x0,0x0,0x0,0x1d,0x3b,0x57,0x70,0x7e,0x6b,0x6e,0x8d,0x94,0x77,0x59,0x3a,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x2b,0x3a,0x3c,
+0x3c,0x3c,0x3c,0x3c,0x3c,0x34,0x21,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x12,0x26,0x34,0x3c,0x3c,0x36,0x28,0x17,0x3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13,0x31,0x50,0x6d,0x87,0x9a,0x88,0x7e,0x7c,0x5e,0x3e,0x1e,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x9,0x29,0x49,0x69,0x7c,0x7f,0x90,0x94,0x7e,0x62,0x44,0x26,0x7,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x8b,0x80,0x80,0x80,0x80,0x6a,0x4a,0x2a,
+0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x31,0x42,0x4a,0x4b,0x4b,0x48,0x3d,0x28,0xe,0x0,0x0,0x0,0x1,0x1e,0x3a,0x55,0x6f,0x80,0x80,0x80,0x8c,0x98,0x7b,0x5d,0x3d,0x1d,0x0,0x0,0x0,0x0,0x0,0x17,0x28,0x30,0x30,0x31,0x31,0x31,0x2e,0x29,0x20,0x14,0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe,0x1f,0x2c,0x34,0x36,0x35,0x2d,0x30,0x30,0x30,0x30,0x30,0x2b,0x1a,0x4,0x0,0x0,0x3,0x23,0x43,0x63,0x7f,0x97,0x81,0x75,0x93,0x7c,0x6a,0x4e,0x30,0x12,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x10,0x1a,0x1c,0x1c,0x1c,0x1c,0x1c,0x1c,0x16,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x16,0x1c,0x1c,0x17,0xc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x25,0x41,0x5b,0x70,0x7e,0x85,0x86,0x7e,0x5e,0x3e,0x1e,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x9,0x29,0x49,0x69,0x7a,0x86,0x82,0x79,0x68,
+0x51,0x37,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0xa2,
+0xa0,0xa0,0x9b,0x7f,0x62,0x43,0x25,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x17,0x24,0x2a,0x2b,0x2b,0x28,0x20,0x11,0x0,0x0,0x0,0x0,0xd,0x2b,0x49,0x65,0x7f,0x9a,0xa0,0xa0,0xa2,0x8a,0x6e,0x51,0x34,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0xa,0x10,0x10,0x11,0x11,0x11,0xe,0x9,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xe,0x14,0x16,0x15,0xf,0x10,0x10,0x10,0x10,0x10,0xc,0x0,0x0,0x0,0x0,0x3,0x23,0x42,0x61,0x7f,0x95,0x99,0x84,0x7d,0x70,0x58,0x3e,0x23,
+0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x2e,0x43,0x54,0x5f,0x65,0x67,0x67,0x55,0x39,0x1b,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,0x6c,0x4c,0x2c,0xc,0x0,0x6,0x25,
+0x43,0x5e,0x67,0x67,0x63,0x5b,0x4e,0x3b,0x25,0xb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x1e,0x3e,0x5e,0x7e,0x9d,0x9d,0x9d,0x9d,0x8b,0x71,0x55,0x38,0x1a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0xa,0xb,0xb,0x8,0xfe,0xff,0xff,0xff,0x0,0x0,0x17,0x36,0x54,0x72,0x8f,0x9d,0x9d,0x9d,0x96,0x7c,0x60,0x44,0x27,0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x37,0x53,0x6a,0x77,
+0x79,0x74,0x68,0x57,0x43,0x2b,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x16,0x29,0x37,0x40,0x45,0x47,0x47,0x3d,0x28,0xe,0x0,0x0,0xc,0x2c,0x4c,0x6c,0x8b,0x8c,
+0x6c,0x4c,0x2c,0xc,0x0,0x0,0x18,0x31,0x42,0x47,0x47,0x44,0x3d,0x32,0x22,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1e,0x3e,0x5e,0x7d,0x7d,0x7d,0x7d,0x7d,0x7a,0x60,0x45,0x2a,0xe,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1a,0x3a,0x5a,0x7a,0x7d,0x7d,0x7d,0x7d,0x7d,0x6b,0x50,0x35,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0xc,0x26,0x3c,0x4e,0x58,0x59,0x55,0x4b,0x3c,0x2a,0x15,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc,0x18,0x21,0x25,0x27,0x27,0x20,0x11,0x0,0x0,
+0x0,0xc,0x2c,0x4c,0x6c,0x87,0x87,0x6c,0x4c,0x2c,0xc,0x0,0x0,0x3,0x17,0x24,0x27,0x27,0x24,0x1e,0x14,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18,0x35,0x4f,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x4d,0x33,0x19,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x32,0x4d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x56,0x3e,0x24,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x23,0x31,0x38,0x39,0x36,0x2e,0x21,0x10,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,
+0x6,0x7,0x7,0x2,0x0,0x0,0x0,0x0,0x9,0x28,0x46,0x60,0x67,0x67,0x60,0x47,0x29,0xa,0x0,0x0,0x0,0x0,0x5,0x7,0x7,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x22,0x35,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x33,0x20,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x20,0x33,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x39,0x29,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x12,0x19,0x19,0x17,0xf,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x33,0x44,0x47,0x47,0x44,0x33,0x1b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x18,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x16,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x16,0x1d,0x1d,0x1d,0x1d,0x1d,0x1d,0x1b,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x19,0x25,0x27,0x27,0x25,0x19,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x7,0x7,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,};}
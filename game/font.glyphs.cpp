@@ -0,0 +1,20 @@
+namespace res {unsigned long font_glyphs_len=1932; unsigned char font_glyphs_data[]={0x47,0x4c,0x59,0x46,0x1,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x18,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x6c,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,0x0,0x19,0x0,0xfd,0xff,0x14,0x0,0x7,0x0,0x0,0x0,0x22,0x0,0x0,0x0,0xe,0x0,0x0,0x0,0x12,0x0,0x11,0x0,0xfc,0xff,0x14,0x0,0xa,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x21,0x0,0x0,0x0,0x16,
+0x0,0x18,0x0,0xfd,0xff,0x13,0x0,0xf,0x0,0x0,0x0,0x24,0x0,0x0,0x0,0x0,0x0,0x1a,0x0,0x13,0x0,0x1b,0x0,0xfd,0xff,0x14,0x0,0xd,0x0,0x0,0x0,0x25,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x16,0x0,0x18,0x0,0xfd,0xff,0x13,0x0,0x10,0x0,0x0,0x0,0x26,0x0,0x0,0x0,0x4f,0x0,0x0,0x0,0x16,0x0,0x17,0x0,0xfd,0xff,0x12,0x0,0xf,0x0,0x0,0x0,0x27,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0xd,0x0,0x11,0x0,0xfc,0xff,0x14,0x0,0x5,0x0,0x0,0x0,0x28,0x0,0x0,0x0,0x14,0x0,0x1a,0x0,0x10,0x0,
+0x1a,0x0,0xfd,0xff,0x13,0x0,0x9,0x0,0x0,0x0,0x29,0x0,0x0,0x0,0x25,0x0,0x1a,0x0,0xf,0x0,0x1a,0x0,0xfc,0xff,0x13,0x0,0x8,0x0,0x0,0x0,0x2a,0x0,0x0,0x0,0x74,0x0,0x0,0x0,0x13,0x0,0x13,0x0,0xfc,0xff,0x11,0x0,0xb,0x0,0x0,0x0,0x2b,0x0,0x0,0x0,0x88,0x0,0x0,0x0,0x14,0x0,0x13,0x0,0xfd,0xff,0x10,0x0,0xe,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x9d,0x0,0x0,0x0,0xc,0x0,0x12,0x0,0xfd,0xff,0x9,0x0,0x6,0x0,0x0,0x0,0x2d,0x0,0x0,0x0,0xaa,0x0,0x0,0x0,0x11,0x0,0xc,
+0x0,0xfd,0xff,0xc,0x0,0xa,0x0,0x0,0x0,0x2e,0x0,0x0,0x0,0xbc,0x0,0x0,0x0,0xd,0x0,0xe,0x0,0xfd,0xff,0x9,0x0,0x7,0x0,0x0,0x0,0x2f,0x0,0x0,0x0,0xca,0x0,0x0,0x0,0x13,0x0,0x18,0x0,0xfc,0xff,0x13,0x0,0xb,0x0,0x0,0x0,0x30,0x0,0x0,0x0,0xde,0x0,0x0,0x0,0x12,0x0,0x18,0x0,0xfd,0xff,0x13,0x0,0xc,0x0,0x0,0x0,0x31,0x0,0x0,0x0,0xf1,0x0,0x0,0x0,0x12,0x0,0x17,0x0,0xfd,0xff,0x13,0x0,0xb,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x4,0x1,0x0,0x0,0x11,0x0,0x17,0x0,
+0xfd,0xff,0x13,0x0,0xa,0x0,0x0,0x0,0x33,0x0,0x0,0x0,0x16,0x1,0x0,0x0,0x13,0x0,0x18,0x0,0xfc,0xff,0x13,0x0,0xb,0x0,0x0,0x0,0x34,0x0,0x0,0x0,0x2a,0x1,0x0,0x0,0x13,0x0,0x18,0x0,0xfd,0xff,0x13,0x0,0xc,0x0,0x0,0x0,0x35,0x0,0x0,0x0,0x3e,0x1,0x0,0x0,0x11,0x0,0x18,0x0,0xfd,0xff,0x13,0x0,0xb,0x0,0x0,0x0,0x36,0x0,0x0,0x0,0x50,0x1,0x0,0x0,0x12,0x0,0x18,0x0,0xfd,0xff,0x13,0x0,0xc,0x0,0x0,0x0,0x37,0x0,0x0,0x0,0x63,0x1,0x0,0x0,0x13,0x0,0x19,0x0,0xfc,
+0xff,0x14,0x0,0xb,0x0,0x0,0x0,0x38,0x0,0x0,0x0,0x77,0x1,0x0,0x0,0x12,0x0,0x18,0x0,0xfd,0xff,0x13,0x0,0xb,0x0,0x0,0x0,0x39,0x0,0x0,0x0,0x8a,0x1,0x0,0x0,0x12,0x0,0x18,0x0,0xfd,0xff,0x13,0x0,0xc,0x0,0x0,0x0,0x3a,0x0,0x0,0x0,0x9d,0x1,0x0,0x0,0xd,0x0,0x15,0x0,0xfd,0xff,0x10,0x0,0x7,0x0,0x0,0x0,0x3b,0x0,0x0,0x0,0xab,0x1,0x0,0x0,0xd,0x0,0x19,0x0,0xfd,0xff,0x10,0x0,0x7,0x0,0x0,0x0,0x3c,0x0,0x0,0x0,0xb9,0x1,0x0,0x0,0x12,0x0,0x15,0x0,0xfc,0xff,
+0x11,0x0,0xa,0x0,0x0,0x0,0x3d,0x0,0x0,0x0,0xcc,0x1,0x0,0x0,0x14,0x0,0xf,0x0,0xfe,0xff,0xe,0x0,0xf,0x0,0x0,0x0,0x3e,0x0,0x0,0x0,0xe1,0x1,0x0,0x0,0x11,0x0,0x15,0x0,0xfd,0xff,0x11,0x0,0xa,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0x35,0x0,0x1a,0x0,0x10,0x0,0x19,0x0,0xfd,0xff,0x14,0x0,0xa,0x0,0x0,0x0,0x40,0x0,0x0,0x0,0x46,0x0,0x1a,0x0,0x19,0x0,0x1a,0x0,0xfd,0xff,0x12,0x0,0x12,0x0,0x0,0x0,0x41,0x0,0x0,0x0,0x60,0x0,0x1a,0x0,0x17,0x0,0x16,0x0,0xfb,0xff,0x12,
+0x0,0xd,0x0,0x0,0x0,0x42,0x0,0x0,0x0,0x78,0x0,0x1a,0x0,0x14,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0xd,0x0,0x0,0x0,0x43,0x0,0x0,0x0,0x8d,0x0,0x1a,0x0,0x15,0x0,0x17,0x0,0xfc,0xff,0x12,0x0,0xd,0x0,0x0,0x0,0x44,0x0,0x0,0x0,0xa3,0x0,0x1a,0x0,0x16,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0xe,0x0,0x0,0x0,0x45,0x0,0x0,0x0,0xba,0x0,0x1a,0x0,0x14,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0xc,0x0,0x0,0x0,0x46,0x0,0x0,0x0,0xcf,0x0,0x1a,0x0,0x13,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,
+0xb,0x0,0x0,0x0,0x47,0x0,0x0,0x0,0xe3,0x0,0x1a,0x0,0x16,0x0,0x17,0x0,0xfc,0xff,0x12,0x0,0xe,0x0,0x0,0x0,0x48,0x0,0x0,0x0,0xfa,0x0,0x1a,0x0,0x17,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0xf,0x0,0x0,0x0,0x49,0x0,0x0,0x0,0x12,0x1,0x1a,0x0,0xf,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0x7,0x0,0x0,0x0,0x4a,0x0,0x0,0x0,0x22,0x1,0x1a,0x0,0x12,0x0,0x17,0x0,0xfc,0xff,0x12,0x0,0x9,0x0,0x0,0x0,0x4b,0x0,0x0,0x0,0x35,0x1,0x1a,0x0,0x16,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0xd,
+0x0,0x0,0x0,0x4c,0x0,0x0,0x0,0x4c,0x1,0x1a,0x0,0x13,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0xb,0x0,0x0,0x0,0x4d,0x0,0x0,0x0,0x60,0x1,0x1a,0x0,0x1a,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0x12,0x0,0x0,0x0,0x4e,0x0,0x0,0x0,0x7b,0x1,0x1a,0x0,0x17,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0xf,0x0,0x0,0x0,0x4f,0x0,0x0,0x0,0x93,0x1,0x1a,0x0,0x17,0x0,0x17,0x0,0xfc,0xff,0x12,0x0,0xf,0x0,0x0,0x0,0x50,0x0,0x0,0x0,0xab,0x1,0x1a,0x0,0x14,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0xc,0x0,
+0x0,0x0,0x51,0x0,0x0,0x0,0xc0,0x1,0x1a,0x0,0x17,0x0,0x1a,0x0,0xfc,0xff,0x12,0x0,0xf,0x0,0x0,0x0,0x52,0x0,0x0,0x0,0xd8,0x1,0x1a,0x0,0x16,0x0,0x17,0x0,0xfc,0xff,0x12,0x0,0xd,0x0,0x0,0x0,0x53,0x0,0x0,0x0,0x0,0x0,0x36,0x0,0x12,0x0,0x17,0x0,0xfd,0xff,0x12,0x0,0xb,0x0,0x0,0x0,0x54,0x0,0x0,0x0,0x13,0x0,0x36,0x0,0x14,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0xc,0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x28,0x0,0x36,0x0,0x16,0x0,0x17,0x0,0xfc,0xff,0x12,0x0,0xe,0x0,0x0,
+0x0,0x56,0x0,0x0,0x0,0x3f,0x0,0x36,0x0,0x17,0x0,0x17,0x0,0xfb,0xff,0x12,0x0,0xd,0x0,0x0,0x0,0x57,0x0,0x0,0x0,0x57,0x0,0x36,0x0,0x1b,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0x13,0x0,0x0,0x0,0x58,0x0,0x0,0x0,0x73,0x0,0x36,0x0,0x15,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0xd,0x0,0x0,0x0,0x59,0x0,0x0,0x0,0x89,0x0,0x36,0x0,0x16,0x0,0x16,0x0,0xfb,0xff,0x12,0x0,0xc,0x0,0x0,0x0,0x5a,0x0,0x0,0x0,0xa0,0x0,0x36,0x0,0x13,0x0,0x16,0x0,0xfc,0xff,0x12,0x0,0xc,0x0,0x0,0x0,
+0x5b,0x0,0x0,0x0,0x0,0x0,0x4e,0x0,0x10,0x0,0x1d,0x0,0xfe,0xff,0x15,0x0,0xa,0x0,0x0,0x0,0x5c,0x0,0x0,0x0,0x11,0x0,0x4e,0x0,0x13,0x0,0x18,0x0,0xfc,0xff,0x13,0x0,0xb,0x0,0x0,0x0,0x5d,0x0,0x0,0x0,0x25,0x0,0x4e,0x0,0x10,0x0,0x1d,0x0,0xfc,0xff,0x15,0x0,0xa,0x0,0x0,0x0,0x5e,0x0,0x0,0x0,0xb4,0x0,0x36,0x0,0x14,0x0,0xf,0x0,0x0,0x0,0x13,0x0,0x14,0x0,0x0,0x0,0x5f,0x0,0x0,0x0,0xc9,0x0,0x36,0x0,0x12,0x0,0xa,0x0,0xfc,0xff,0x1,0x0,0xa,0x0,0x0,0x0,0x60,
+0x0,0x0,0x0,0xdc,0x0,0x36,0x0,0xe,0x0,0xc,0x0,0xfd,0xff,0x13,0x0,0xa,0x0,0x0,0x0,0x61,0x0,0x0,0x0,0xeb,0x0,0x36,0x0,0x13,0x0,0x13,0x0,0xfc,0xff,0xe,0x0,0xb,0x0,0x0,0x0,0x62,0x0,0x0,0x0,0x36,0x0,0x4e,0x0,0x13,0x0,0x18,0x0,0xfc,0xff,0x13,0x0,0xc,0x0,0x0,0x0,0x63,0x0,0x0,0x0,0xff,0x0,0x36,0x0,0x12,0x0,0x13,0x0,0xfc,0xff,0xe,0x0,0xa,0x0,0x0,0x0,0x64,0x0,0x0,0x0,0x4a,0x0,0x4e,0x0,0x14,0x0,0x18,0x0,0xfc,0xff,0x13,0x0,0xc,0x0,0x0,0x0,0x65,0x0,
+0x0,0x0,0x12,0x1,0x36,0x0,0x12,0x0,0x13,0x0,0xfc,0xff,0xe,0x0,0xa,0x0,0x0,0x0,0x66,0x0,0x0,0x0,0x25,0x1,0x36,0x0,0x11,0x0,0x17,0x0,0xfc,0xff,0x13,0x0,0x7,0x0,0x0,0x0,0x67,0x0,0x0,0x0,0x37,0x1,0x36,0x0,0x14,0x0,0x17,0x0,0xfc,0xff,0xe,0x0,0xb,0x0,0x0,0x0,0x68,0x0,0x0,0x0,0x4c,0x1,0x36,0x0,0x14,0x0,0x17,0x0,0xfc,0xff,0x13,0x0,0xc,0x0,0x0,0x0,0x69,0x0,0x0,0x0,0x61,0x1,0x36,0x0,0xe,0x0,0x17,0x0,0xfc,0xff,0x13,0x0,0x6,0x0,0x0,0x0,0x6a,0x0,0x0,
+0x0,0x5f,0x0,0x4e,0x0,0xf,0x0,0x1c,0x0,0xfa,0xff,0x13,0x0,0x6,0x0,0x0,0x0,0x6b,0x0,0x0,0x0,0x70,0x1,0x36,0x0,0x14,0x0,0x17,0x0,0xfc,0xff,0x13,0x0,0xb,0x0,0x0,0x0,0x6c,0x0,0x0,0x0,0x85,0x1,0x36,0x0,0xe,0x0,0x17,0x0,0xfc,0xff,0x13,0x0,0x6,0x0,0x0,0x0,0x6d,0x0,0x0,0x0,0x94,0x1,0x36,0x0,0x1a,0x0,0x12,0x0,0xfc,0xff,0xe,0x0,0x12,0x0,0x0,0x0,0x6e,0x0,0x0,0x0,0xaf,0x1,0x36,0x0,0x14,0x0,0x12,0x0,0xfc,0xff,0xe,0x0,0xc,0x0,0x0,0x0,0x6f,0x0,0x0,0x0,
+0xc4,0x1,0x36,0x0,0x13,0x0,0x13,0x0,0xfc,0xff,0xe,0x0,0xc,0x0,0x0,0x0,0x70,0x0,0x0,0x0,0xd8,0x1,0x36,0x0,0x14,0x0,0x17,0x0,0xfc,0xff,0xe,0x0,0xc,0x0,0x0,0x0,0x71,0x0,0x0,0x0,0x6f,0x0,0x4e,0x0,0x14,0x0,0x17,0x0,0xfc,0xff,0xe,0x0,0xc,0x0,0x0,0x0,0x72,0x0,0x0,0x0,0xed,0x1,0x36,0x0,0x11,0x0,0x12,0x0,0xfc,0xff,0xe,0x0,0x8,0x0,0x0,0x0,0x73,0x0,0x0,0x0,0x84,0x0,0x4e,0x0,0x11,0x0,0x13,0x0,0xfc,0xff,0xe,0x0,0x9,0x0,0x0,0x0,0x74,0x0,0x0,0x0,0xef,
+0x1,0x1a,0x0,0x10,0x0,0x15,0x0,0xfc,0xff,0x10,0x0,0x7,0x0,0x0,0x0,0x75,0x0,0x0,0x0,0x96,0x0,0x4e,0x0,0x14,0x0,0x13,0x0,0xfc,0xff,0xe,0x0,0xc,0x0,0x0,0x0,0x76,0x0,0x0,0x0,0xab,0x0,0x4e,0x0,0x14,0x0,0x12,0x0,0xfb,0xff,0xe,0x0,0xa,0x0,0x0,0x0,0x77,0x0,0x0,0x0,0xc0,0x0,0x4e,0x0,0x1a,0x0,0x12,0x0,0xfb,0xff,0xe,0x0,0x10,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0xdb,0x0,0x4e,0x0,0x13,0x0,0x12,0x0,0xfc,0xff,0xe,0x0,0xb,0x0,0x0,0x0,0x79,0x0,0x0,0x0,0xef,0x0,
+0x4e,0x0,0x14,0x0,0x17,0x0,0xfb,0xff,0xe,0x0,0xa,0x0,0x0,0x0,0x7a,0x0,0x0,0x0,0x4,0x1,0x4e,0x0,0x12,0x0,0x12,0x0,0xfc,0xff,0xe,0x0,0xa,0x0,0x0,0x0,0x7b,0x0,0x0,0x0,0x17,0x1,0x4e,0x0,0x11,0x0,0x1a,0x0,0xfc,0xff,0x13,0x0,0xa,0x0,0x0,0x0,0x7c,0x0,0x0,0x0,0x29,0x1,0x4e,0x0,0xa,0x0,0x1d,0x0,0x0,0x0,0x14,0x0,0xa,0x0,0x0,0x0,0x7d,0x0,0x0,0x0,0x34,0x1,0x4e,0x0,0x10,0x0,0x1a,0x0,0xfd,0xff,0x13,0x0,0xa,0x0,0x0,0x0,0x7e,0x0,0x0,0x0,0x45,0x1,0x4e,
+0x0,0x16,0x0,0xc,0x0,0xfd,0xff,0xc,0x0,0x11,0x0,0x0,0x0,};}
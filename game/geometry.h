@@ -31,15 +31,26 @@ bool ptInTriangle(const T &A, const T &B, const T &C, const T &P) {
 };
 
 /**
- * @brief Триангуляция фигур по точкам полигона
+ * @brief Распределитель A для элементов типа T
+ *
+ */
+template <typename A, typename T>
+using Rebind = typename std::allocator_traits<A>::template rebind_alloc<T>;
+
+/**
+ * @brief Триангуляция полигона отсечением ушей
  *
+ * @tparam Points контейнер точек
+ * @tparam Alloc распределитель для рабочего массива
+ * @tparam F void(size_t, size_t, size_t)
  * @param contour Набор точек полигона
- * @param result Коллекция треугольников
+ * @param scratch распределитель для рабочего массива
+ * @param emit получает номера точек каждого треугольника
  * @return true Разбиение успешно
  * @return false Некорректный полигон
  */
-inline bool triangulate2d(const std::vector<Point> &contour,
-                          std::vector<Triangle> &result) {
+template <typename Points, typename Alloc, typename F>
+bool earClipping(const Points &contour, const Alloc &scratch, F emit) {
   auto n = contour.size();
   if (n < 3) return false;
 
@@ -47,7 +58,7 @@ inline bool triangulate2d(const std::vector<Point> &contour,
   for (size_t p = n - 1, q = 0; q < n; p = q++)
     a += contour[p][0] * contour[q][1] - contour[q][0] * contour[p][1];
 
-  std::vector<size_t> indexes(n);
+  std::vector<size_t, Rebind<Alloc, size_t>> indexes(n, scratch);
   for (size_t v = 0; v < n; v++) indexes[v] = a > .0f ? v : (n - 1) - v;
 
   auto select = [&](int u, int v, int w, int n) {
@@ -77,8 +88,7 @@ inline bool triangulate2d(const std::vector<Point> &contour,
     auto w = v + 1;
     if (nv <= w) w = 0;
     if (select(u, v, w, nv)) {
-      result.push_back(Triangle{contour[indexes[u]], contour[indexes[v]],
-                                contour[indexes[w]]});
+      emit(indexes[u], indexes[v], indexes[w]);
       m++;
       for (auto s = v, t = v + 1; t < nv; s++, t++) indexes[s] = indexes[t];
       nv--;
@@ -89,18 +99,75 @@ inline bool triangulate2d(const std::vector<Point> &contour,
   return true;
 }
 
+/**
+ * @brief Триангуляция фигур по точкам полигона
+ *
+ * @tparam Points контейнер точек
+ * @tparam Triangles контейнер треугольников
+ * @tparam Alloc распределитель для рабочего массива
+ * @param contour Набор точек полигона
+ * @param result Коллекция треугольников
+ * @param scratch распределитель для рабочего массива
+ * @return true Разбиение успешно
+ * @return false Некорректный полигон
+ */
+template <typename Points, typename Triangles, typename Alloc>
+bool triangulate2d(const Points &contour, Triangles &result,
+                   const Alloc &scratch) {
+  return earClipping(contour, scratch, [&](size_t u, size_t v, size_t w) {
+    result.push_back(Triangle{contour[u], contour[v], contour[w]});
+  });
+}
+
+/**
+ * @brief Триангуляция фигур в номера точек полигона
+ *
+ * @tparam Points контейнер точек
+ * @tparam Indexes контейнер номеров треугольников
+ * @tparam Alloc распределитель для рабочего массива
+ * @param contour Набор точек полигона
+ * @param result Коллекция номеров точек треугольников
+ * @param scratch распределитель для рабочего массива
+ * @return true Разбиение успешно
+ * @return false Некорректный полигон
+ */
+template <typename Points, typename Indexes, typename Alloc>
+bool triangulate2dIndexes(const Points &contour, Indexes &result,
+                          const Alloc &scratch) {
+  return earClipping(contour, scratch, [&](size_t u, size_t v, size_t w) {
+    result.push_back(TriangleIndexes{uint32_t(u), uint32_t(v), uint32_t(w)});
+  });
+}
+
+/**
+ * @brief Триангуляция фигур по точкам полигона, рабочий массив берется из
+ * распределителя результата
+ *
+ * @param contour Набор точек полигона
+ * @param result Коллекция треугольников
+ * @return true Разбиение успешно
+ * @return false Некорректный полигон
+ */
+template <typename C, typename R>
+bool triangulate2d(const C &contour, R &result) {
+  return triangulate2d(contour, result, result.get_allocator());
+}
+
 /**
  * @brief Проверка нахождения точки в полигоне
  *
+ * @tparam C контейнер точек
  * @tparam T 2d точка
+ * @tparam A распределитель для временных треугольников
  * @param pts Набор точек полигона
  * @param P Точка для проверки
+ * @param scratch распределитель для временных треугольников
  * @return true Точка внутри
  * @return false Точка снаружи
  */
-template <typename T>
-bool ptInPoligon(const std::vector<T> &pts, const T &P) {
-  std::vector<Triangle> v;
+template <typename C, typename T, typename A>
+bool ptInPoligon(const C &pts, const T &P, const A &scratch) {
+  std::vector<std::array<T, 3>, Rebind<A, std::array<T, 3>>> v(scratch);
   if (triangulate2d(pts, v)) {
     for (auto const &t : v) {
       if (ptInTriangle(t[0], t[1], t[2], P)) return true;
@@ -109,6 +176,20 @@ bool ptInPoligon(const std::vector<T> &pts, const T &P) {
   return false;
 }
 
+/**
+ * @brief Проверка нахождения точки в полигоне, временные треугольники
+ * берутся из распределителя точек
+ *
+ * @param pts Набор точек полигона
+ * @param P Точка для проверки
+ * @return true Точка внутри
+ * @return false Точка снаружи
+ */
+template <typename C, typename T>
+bool ptInPoligon(const C &pts, const T &P) {
+  return ptInPoligon(pts, P, pts.get_allocator());
+}
+
 /**
  * @brief Пересечение двух отрезков
  *
@@ -188,43 +269,58 @@ inline bool intersect(const Triangle &t1, const Triangle &t2) {
  * @brief Точки контура треугольника
  *
  * @param t треугольник
- * @return точки полигона
+ * @param pts сюда помещаем точки полигона
  */
-inline auto points(const Triangle &t) {
-  return std::vector<Point>(t.begin(), t.end());
+template <typename C>
+void points(const Triangle &t, C &pts) {
+  pts.assign(t.begin(), t.end());
 }
 
 /**
  * @brief Точки контура прямоугольника
  *
  * @param rc примитив прямоугольника
- * @return точки полигона
+ * @param pts сюда помещаем точки полигона
  */
-inline auto points(const Rect &rc) {
-  std::vector<Point> pts;
+template <typename C>
+void points(const Rect &rc, C &pts) {
+  pts.clear();
   pts.push_back(Point{rc.first[0] - rc.second[0], rc.first[1] - rc.second[1]});
   pts.push_back(Point{rc.first[0] + rc.second[0], rc.first[1] - rc.second[1]});
   pts.push_back(Point{rc.first[0] + rc.second[0], rc.first[1] + rc.second[1]});
   pts.push_back(Point{rc.first[0] - rc.second[0], rc.first[1] + rc.second[1]});
-  return pts;
 }
 
 /**
  * @brief Точки контура окружности
  *
  * @param c примитив круга
- * @return точки полигона
+ * @param pts сюда помещаем точки полигона
  */
-inline auto points(const Circle &c) {
-  std::vector<Point> pts;
+template <typename C>
+void points(const Circle &c, C &pts) {
+  pts.clear();
   const auto angle =
-      std::acos(2.f * std::powf(1.f - circleError / c.second, 2.f) - 1.f);
+      std::acos(2.f * std::pow(1.f - circleError / c.second, 2.f) - 1.f);
   auto phi = 0.f;
   while (phi < 2 * PI) {
     pts.push_back(Point{c.first[0] + c.second * std::cos(phi),
                         c.first[1] + c.second * std::sin(phi)});
     phi += angle;
   }
+}
+
+/**
+ * @brief Точки контура примитива
+ *
+ * @tparam T треугольник, прямоугольник или круг
+ * @param shape примитив
+ * @return точки полигона
+ */
+template <typename T>
+std::vector<Point> points(const T &shape) {
+  std::vector<Point> pts;
+  points(shape, pts);
   return pts;
 }
 
@@ -304,21 +400,39 @@ auto dist(const T &a, const T &b, const T &pt) {
 /**
  * @brief Найти все грани пересекающиеся с отрезком
  *
+ * @tparam C контейнер точек
  * @tparam T
+ * @tparam R контейнер результатов
  * @param pts точки полигона
  * @param a 1ая точка отрезка
  * @param b 2ая точка отрезка
- * @return список пересекающихся сторон полигона и точек пересечения
+ * @param result сюда помещаем пересекающиеся стороны полигона и точки
+ * пересечения
  */
-template <typename T>
-auto intersect(const std::vector<T> &pts, const T &a, const T &b) {
-  std::vector<std::array<T, 3>> result;
+template <typename C, typename T, typename R>
+void intersect(const C &pts, const T &a, const T &b, R &result) {
+  result.clear();
   for (size_t i = 0; i < pts.size(); i++) {
-    auto &c = pts[i];
-    auto &d = pts[i < pts.size() - 1 ? i + 1 : 0];
+    const auto &c = pts[i];
+    const auto &d = pts[i < pts.size() - 1 ? i + 1 : 0];
     T p;
     if (intersect(a, b, c, d, &p)) result.push_back({c, d, p});
   }
+}
+
+/**
+ * @brief Найти все грани пересекающиеся с отрезком
+ *
+ * @tparam T
+ * @param pts точки полигона
+ * @param a 1ая точка отрезка
+ * @param b 2ая точка отрезка
+ * @return список пересекающихся сторон полигона и точек пересечения
+ */
+template <typename T>
+auto intersect(const std::vector<T> &pts, const T &a, const T &b) {
+  std::vector<std::array<T, 3>> result;
+  intersect(pts, a, b, result);
   return result;
 }
 
@@ -384,16 +498,19 @@ auto shorten(const T &v, GLfloat len) {
 
 /**
  * @brief Построение невидимого из точки полигона сзади отрезка с дополнением
- * углами границ игрового поля
+ * углами заданной области размера поля
  *
  * @tparam T
- * @param P точка откуда смотрим
- * @param A 1ая точка отрезка
- * @param B 2ая точка отрезка
+ * @tparam C контейнер точек, временные данные берутся из его распределителя
+ * @param P точка откуда смотрим, внутри области
+ * @param A 1ая точка отрезка, внутри области
+ * @param B 2ая точка отрезка, внутри области
  * @param pts сюда помещаем точки полигона
+ * @param corners углы области по порядку как у поля
  */
-template <typename T>
-void invisiblePoligon(const T &P, const T &A, const T &B, std::vector<T> &pts) {
+template <typename T, typename C>
+void invisiblePoligon(const T &P, const T &A, const T &B, C &pts,
+                      const std::array<T, 4> &corners) {
   // Сделаем лучи из точки через края отрезка длиннее чем область игры
   struct Ray {
     T origin;  // точка на отрезке через которую идет луч
@@ -453,6 +570,90 @@ void invisiblePoligon(const T &P, const T &A, const T &B, std::vector<T> &pts) {
   }
 }
 
+/**
+ * @brief Построение невидимого из точки полигона сзади отрезка с дополнением
+ * углами границ игрового поля
+ *
+ * @tparam T
+ * @tparam C контейнер точек, временные данные берутся из его распределителя
+ * @param P точка откуда смотрим
+ * @param A 1ая точка отрезка
+ * @param B 2ая точка отрезка
+ * @param pts сюда помещаем точки полигона
+ */
+template <typename T, typename C>
+void invisiblePoligon(const T &P, const T &A, const T &B, C &pts) {
+  invisiblePoligon(P, A, B, pts, corners);
+}
+
+/**
+ * @brief Сжимает точку до 16 бит на координату
+ *
+ * @param pt точка в пределах сцены
+ * @return ShortPoint
+ */
+inline ShortPoint quantize(const Point &pt) {
+  auto q = [](GLfloat v) {
+    auto r = std::round(v / gameSize * 32767.f);
+    return int16_t(std::max(std::min(r, 32767.f), -32767.f));
+  };
+  return ShortPoint{q(pt[0]), q(pt[1])};
+}
+
+/**
+ * @brief Распаковывает сжатую точку
+ *
+ * @param pt сжатая точка
+ * @return Point
+ */
+inline Point dequantize(const ShortPoint &pt) {
+  constexpr GLfloat k = gameSize / 32767.f;
+  return Point{pt[0] * k, pt[1] * k};
+}
+
+/**
+ * @brief Обрезает отрезок прямоугольником
+ *
+ * Отрезок внутри прямоугольника не меняется.
+ *
+ * @tparam T
+ * @param lo левый нижний угол
+ * @param hi правый верхний угол
+ * @param A 1ая точка отрезка
+ * @param B 2ая точка отрезка
+ * @return true часть отрезка внутри
+ * @return false отрезок снаружи
+ */
+template <typename T>
+bool clip(const T &lo, const T &hi, T &A, T &B) {
+  auto in = [&](const T &p) {
+    return p[0] >= lo[0] && p[0] <= hi[0] && p[1] >= lo[1] && p[1] <= hi[1];
+  };
+  if (in(A) && in(B)) return true;
+  // Лян - Барски: сужаем параметр t отрезка A + (B - A) * t по границам
+  GLfloat t0 = 0.f, t1 = 1.f;
+  auto d = B - A;
+  for (size_t i = 0; i < 2; i++) {
+    GLfloat p[2] = {-d[i], d[i]}, q[2] = {A[i] - lo[i], hi[i] - A[i]};
+    for (size_t k = 0; k < 2; k++) {
+      if (p[k] == 0.f) {
+        if (q[k] < 0.f) return false;  // Параллельно и снаружи
+        continue;
+      }
+      auto t = q[k] / p[k];
+      if (p[k] < 0.f)
+        t0 = std::max(t0, t);
+      else
+        t1 = std::min(t1, t);
+    }
+  }
+  if (t0 > t1) return false;
+  auto a = A;
+  if (t0 > 0.f) A = a + d * t0;
+  if (t1 < 1.f) B = a + d * t1;
+  return true;
+}
+
 /**
  * @brief Ограничиваем позицию сценой
  * 
@@ -0,0 +1,350 @@
+/**
+ * @file glplatform.cpp
+ * @author Alex Light (dev@3107.ru)
+ * @brief Реализация платформы на GLFW и OpenGL
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#include "glplatform.h"
+
+#include <chrono>
+#include <thread>
+
+#include "glstats.h"
+
+/**
+ * @brief Программа для вертексов полигона
+ * 
+ */
+static const char *vscode = R"(
+      attribute vec2 pos;
+      uniform vec2 camera;
+      void main() {
+        gl_Position = vec4(pos - camera, 0.0, 1.0);
+      }
+    )";
+
+/**
+ * @brief Программа для фрагментов полигона
+ * 
+ */
+static const char *fscode = R"(
+      precision mediump float;
+      uniform vec4 color;
+      void main() {
+        gl_FragColor = color;
+      }
+    )";
+
+/**
+ * @brief Буфер треугольников объектов
+ *
+ */
+struct Mesh : RenderCache {
+  /**
+   * @brief ид буфера
+   *
+   */
+  GLuint vbo;
+  /**
+   * @brief ид буфера номеров вершин
+   *
+   */
+  GLuint ebo;
+  /**
+   * @brief ид контекста
+   *
+   */
+  GLuint vao;
+  /**
+   * @brief количество номеров вершин
+   *
+   */
+  GLsizei cnt = 0;
+  /**
+   * @brief тип номеров вершин
+   *
+   */
+  GLenum type = GL_UNSIGNED_SHORT;
+  /**
+   * @brief номер изменения объектов, с которого собран буфер
+   *
+   */
+  unsigned version;
+  /**
+   * @brief буфер уже загружался, значит объекты меняются
+   *
+   */
+  bool uploaded = false;
+  /**
+   * @brief Construct a new Mesh object
+   *
+   * @param pos адрес позиции вертекса в программе
+   * @param version номер изменения объектов
+   * @param format формат вершин
+   */
+  Mesh(GLuint pos, unsigned version, VertexFormat format) : version(version) {
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    // Сжатые координаты нормализуются в [-1, 1], это и есть поле игры
+    if (format == VertexFormat::Short)
+      glVertexAttribPointer(pos, AXES, GL_SHORT, GL_TRUE, 0, 0);
+    else
+      glVertexAttribPointer(pos, AXES, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(pos);
+    // Буфер номеров запоминается в контексте
+    glGenBuffers(1, &ebo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+  ~Mesh() {
+    glDeleteBuffers(1, &ebo);
+    glDeleteBuffers(1, &vbo);
+    glDeleteVertexArrays(1, &vao);
+  }
+};
+
+/**
+ * @brief Точки объекта в формате хранения
+ *
+ */
+static const Point *data(const PointView &v, Point) { return v.floats; }
+static const ShortPoint *data(const PointView &v, ShortPoint) {
+  return v.shorts;
+}
+
+/**
+ * @brief Текст, разложенный для отрисовки
+ *
+ */
+struct TextCache : RenderCache {
+  /**
+   * @brief текст
+   *
+   */
+  TextLabel label;
+  /**
+   * @brief номер изменения строки, с которого собран текст
+   *
+   */
+  unsigned version;
+  /**
+   * @brief Construct a new Text Cache object
+   *
+   * @param l строка
+   */
+  TextCache(const Label &l)
+      : label(l.color, l.pt, l.height), version(l.version) {
+    label.set(l.text.c_str());
+  }
+};
+
+double GlfwClock::time() { return glfwGetTime(); }
+
+void GlfwClock::wait(double deadline) {
+#ifndef EMSCRIPTEN  // В браузере кадры задает requestAnimationFrame
+  auto dt = deadline - time();
+  if (dt > 0.)
+    std::this_thread::sleep_for(std::chrono::duration<double>(dt));
+#endif
+}
+
+void GlfwInput::push(Event e) {
+  e.time = glfwGetTime();
+  // Очередь разбирается каждый шаг, переполниться она может только если
+  // шаги стоят
+  if (!events.push(e)) std::cout << "Input queue is full!" << std::endl;
+}
+
+void GlfwInput::bind(Scene *s) { scene = s; }
+
+void GlfwInput::key(Scene::Keys key, bool down) {
+  push({0., Key, key, down, {0.f, 0.f}});
+}
+
+void GlfwInput::click(const Point &pt) {
+  push({0., Click, Scene::Keys::Left, false, pt});
+}
+
+void GlfwInput::collect() {
+  glfwPollEvents();
+  // У стика нет обработчика, опрашиваем его каждый кадр и кладем изменения
+  int count;
+  auto a = glfwGetJoystickAxes(GLFW_JOYSTICK_1, &count);
+  if (a && count > 1) {
+    Force v = {a[0], -a[1]};
+    if (!sampled || v != sampledAxes) {
+      sampled = true;
+      sampledAxes = v;
+      push({0., Gamepad, Scene::Keys::Left, false, v});
+    }
+  } else if (sampled) {
+    sampled = false;
+    push({0., NoGamepad, Scene::Keys::Left, false, {0.f, 0.f}});
+  }
+}
+
+void GlfwInput::poll(double until) {
+  while (auto p = events.front()) {
+    if (p->time > until) break;  // Это уже следующим шагам
+    auto e = *p;
+    events.pop();
+    scene->onInput(e.time);
+    switch (e.type) {
+      case Key:
+        scene->onKey(e.key, e.down);
+        break;
+      case Click:
+        scene->onClick(e.pt);
+        break;
+      case Gamepad:
+        connected = true;
+        axes = e.pt;
+        break;
+      case NoGamepad:
+        connected = false;
+        break;
+    }
+  }
+}
+
+bool GlfwInput::gamepad(Force &v) {
+  if (connected) v = axes;
+  return connected;
+}
+
+void GlfwInput::wait(double timeout) {
+#ifndef EMSCRIPTEN  // В браузере ждать нельзя, кадр просто не рисуется
+  if (timeout > 0.) glfwWaitEventsTimeout(timeout);
+#endif
+}
+
+void GlfwInput::wake() { glfwPostEmptyEvent(); }
+
+GLRenderer::Program::Program() {
+  auto vs = glCreateShader(GL_VERTEX_SHADER);
+  glShaderSource(vs, 1, &vscode, NULL);
+  glCompileShader(vs);
+  auto fs = glCreateShader(GL_FRAGMENT_SHADER);
+  glShaderSource(fs, 1, &fscode, NULL);
+  glCompileShader(fs);
+  id = glCreateProgram();
+  glAttachShader(id, vs);
+  glAttachShader(id, fs);
+  glLinkProgram(id);
+  glDetachShader(id, vs);
+  glDetachShader(id, fs);
+  glDeleteShader(vs);
+  glDeleteShader(fs);
+  pos = glGetAttribLocation(id, "pos");
+  color = glGetUniformLocation(id, "color");
+  camera = glGetUniformLocation(id, "camera");
+}
+
+GLRenderer::Program::~Program() { glDeleteProgram(id); }
+
+GLRenderer::Program &GLRenderer::Program::get() {
+  static Program prog;
+  return prog;
+}
+
+GLRenderer::GLRenderer(GLFWwindow *window)
+    : window(window), prog(Program::get()) {
+  // Нужен блендинг так как текстуры для текста с альфой
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void GLRenderer::begin(const Color &back) {
+  glClearColor(back[0], back[1], back[2], back[3]);
+  glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void GLRenderer::draw(const Objects &objects) {
+  if (!objects.cache)
+    objects.cache.reset(
+        new Mesh(prog.pos, objects.getVersion() - 1, objects.getFormat()));
+  auto &mesh = static_cast<Mesh &>(*objects.cache);
+  GLStats::useProgram(prog.id);
+  glUniform4fv(prog.color, 1, objects.getColor().data());
+  glUniform2fv(prog.camera, 1, view.data());
+  glBindVertexArray(mesh.vao);
+  if (mesh.version != objects.getVersion()) {  // Нужно обновить буфер?
+    mesh.version = objects.getVersion();
+    // Вершины объектов подряд, треугольники - номера вершин
+    size_t vertices = 0, cnt = 0;
+    for (size_t k = 0; k < objects.size(); k++) {
+      vertices += objects.getPoints(k).size();
+      cnt += objects.getIndexes(k).size() * 3;
+    }
+    // Препятствия после загрузки не меняются, а перезагружаемые буферы
+    // (темнота) помечаем как часто меняющиеся
+    GLenum usage = mesh.uploaded ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+    mesh.uploaded = true;
+    auto uploadVertices = [&](auto &buf) {
+      using Vertex = typename std::decay_t<decltype(buf)>::value_type;
+      buf.clear();
+      buf.reserve(vertices);
+      for (size_t k = 0; k < objects.size(); k++) {
+        auto v = objects.getPoints(k);
+        auto first = data(v, Vertex());
+        buf.insert(buf.end(), first, first + v.size());
+      }
+      glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+      GLStats::bufferData(GL_ARRAY_BUFFER, buf.size() * sizeof(Vertex),
+                          buf.data(), usage);
+      glBindBuffer(GL_ARRAY_BUFFER, 0);
+    };
+    if (objects.getFormat() == VertexFormat::Short)
+      uploadVertices(shorts);
+    else
+      uploadVertices(points);
+    auto uploadIndexes = [&](auto &idx) {
+      using Index = typename std::decay_t<decltype(idx)>::value_type;
+      idx.clear();
+      idx.reserve(cnt);
+      size_t base = 0;
+      for (size_t k = 0; k < objects.size(); k++) {
+        for (auto const &t : objects.getIndexes(k))
+          for (auto i : t) idx.push_back(Index(base + i));
+        base += objects.getPoints(k).size();
+      }
+      GLStats::bufferData(GL_ELEMENT_ARRAY_BUFFER, idx.size() * sizeof(Index),
+                          idx.data(), usage);
+    };
+    // Короткие номера, если вершин немного
+    mesh.type = vertices <= 0xffff ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    if (mesh.type == GL_UNSIGNED_SHORT)
+      uploadIndexes(shortIndexes);
+    else
+      uploadIndexes(indexes);
+    mesh.cnt = GLsizei(cnt);
+  }
+  GLStats::drawElements(GL_TRIANGLES, mesh.cnt, mesh.type);
+  glBindVertexArray(0);
+  GLStats::useProgram(0);
+}
+
+void GLRenderer::draw(const Label &label) {
+  if (!label.cache) label.cache.reset(new TextCache(label));
+  auto &text = static_cast<TextCache &>(*label.cache);
+  if (text.version != label.version) {  // Строка поменялась
+    text.version = label.version;
+    text.label.set(label.text.c_str());
+  }
+  text.label.setColor(label.color);
+  text.label.setPosition(label.pt, label.height);
+  text.label.draw();
+}
+
+void GLRenderer::pass(RenderPass p) { GLStats::pass(p); }
+
+void GLRenderer::camera(const Point &center) { view = center; }
+
+void GLRenderer::end() {
+  GLStats::endFrame();
+  glfwSwapBuffers(window);
+}
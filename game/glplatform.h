@@ -0,0 +1,224 @@
+/**
+ * @file glplatform.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Платформа игры на GLFW и OpenGL
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#pragma once
+
+#include "objects.h"
+#include "platform.h"
+#include "queue.h"
+#include "scene.h"
+#include "text.h"
+
+#include <GLFW/glfw3.h>
+
+/**
+ * @brief Часы GLFW
+ *
+ */
+class GlfwClock : public Clock {
+ public:
+  double time() override;
+  void wait(double deadline) override;
+};
+
+/**
+ * @brief Ввод из окна GLFW
+ *
+ * Обработчики окна и опрос gamepad кладут события с временем прихода в
+ * очередь, шаг сцены забирает те, что пришли до его начала. Так события
+ * попадают в свой шаг, даже если за кадр выполняется несколько шагов.
+ */
+class GlfwInput : public Input {
+ public:
+  /**
+   * @brief тип события
+   *
+   */
+  enum Type { Key, Click, Gamepad, NoGamepad };
+  /**
+   * @brief событие окна
+   *
+   */
+  struct Event {
+    /**
+     * @brief время прихода в сек.
+     *
+     */
+    double time;
+    /**
+     * @brief тип
+     *
+     */
+    Type type;
+    /**
+     * @brief клавиша
+     *
+     */
+    Scene::Keys key;
+    /**
+     * @brief нажата
+     *
+     */
+    bool down;
+    /**
+     * @brief точка клика или вектор gamepad
+     *
+     */
+    Point pt;
+  };
+
+ private:
+  /**
+   * @brief события, которые еще не забрал шаг
+   *
+   */
+  RingQueue<Event, inputQueueSize> events;
+  /**
+   * @brief сцена, которой отдаем события
+   *
+   */
+  Scene *scene = nullptr;
+  /**
+   * @brief gamepad при последнем опросе
+   *
+   */
+  bool sampled = false;
+  /**
+   * @brief вектор gamepad при последнем опросе
+   *
+   */
+  Force sampledAxes = {0.f, 0.f};
+  /**
+   * @brief gamepad подключен на текущем шаге
+   *
+   */
+  bool connected = false;
+  /**
+   * @brief вектор gamepad на текущем шаге
+   *
+   */
+  Force axes = {0.f, 0.f};
+  /**
+   * @brief Добавляет событие с текущим временем
+   *
+   * @param e событие
+   */
+  void push(Event e);
+
+ public:
+  /**
+   * @brief Задает сцену, которой отдаем события
+   *
+   * @param s сцена
+   */
+  void bind(Scene *s);
+  /**
+   * @brief Клавиша из обработчика окна
+   *
+   * @param key клавиша
+   * @param down нажата
+   */
+  void key(Scene::Keys key, bool down);
+  /**
+   * @brief Клик из обработчика окна
+   *
+   * @param pt точка в координатах игры
+   */
+  void click(const Point &pt);
+  void collect() override;
+  void poll(double until) override;
+  bool gamepad(Force &v) override;
+  void wait(double timeout) override;
+  void wake() override;
+};
+
+/**
+ * @brief Отрисовка в окно GLFW через OpenGL
+ *
+ */
+class GLRenderer : public Renderer {
+  /**
+   * @brief класс программы отрисовки объектов
+   *
+   */
+  struct Program {
+    /**
+     * @brief ид программы
+     *
+     */
+    GLuint id;
+    /**
+     * @brief адрес позиции вертекса в программе
+     *
+     */
+    GLuint pos;
+    /**
+     * @brief адрес цвета в программе
+     *
+     */
+    GLuint color;
+    /**
+     * @brief адрес центра вида в программе
+     *
+     */
+    GLuint camera;
+    /**
+     * @brief Construct a new Program object
+     *
+     */
+    Program();
+    /**
+     * @brief Destroy the Program object
+     *
+     */
+    ~Program();
+    /**
+     * @brief Возвращает ссылку на синглетон программы
+     *
+     * @return Program&
+     */
+    static Program &get();
+  };
+  /**
+   * @brief окно
+   *
+   */
+  GLFWwindow *window;
+  /**
+   * @brief ссылка на программу отрисовки
+   *
+   */
+  Program &prog;
+  /**
+   * @brief центр вида
+   *
+   */
+  Point view{0.f, 0.f};
+  /**
+   * @brief вершины и номера вершин для загрузки в буферы, память
+   * переиспользуется между кадрами
+   *
+   */
+  std::vector<Point> points;
+  std::vector<ShortPoint> shorts;
+  std::vector<GLushort> shortIndexes;
+  std::vector<GLuint> indexes;
+
+ public:
+  /**
+   * @brief Construct a new GLRenderer object
+   *
+   * @param window окно с текущим контекстом OpenGL
+   */
+  GLRenderer(GLFWwindow *window);
+  void begin(const Color &back) override;
+  void draw(const Objects &objects) override;
+  void draw(const Label &label) override;
+  void pass(RenderPass p) override;
+  void camera(const Point &center) override;
+  void end() override;
+};
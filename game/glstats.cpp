@@ -0,0 +1,167 @@
+/**
+ * @file glstats.cpp
+ * @author Alex Light (dev@3107.ru)
+ * @brief Реализация статистики OpenGL
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#include "glstats.h"
+
+#include <deque>
+
+namespace GLStats {
+
+bool on = false;
+Counters current{};
+GLuint program = 0;
+
+namespace {
+
+/**
+ * @brief запрос времени прохода
+ *
+ */
+struct Query {
+  GLuint id;
+  RenderPass pass;
+};
+
+/**
+ * @brief кадр, ждущий результаты запросов
+ *
+ */
+struct Pending {
+  unsigned long number;
+  Counters counters;
+  std::vector<Query> queries;
+};
+
+/**
+ * @brief больше кадров не ждем, драйвер видимо не отдает результаты
+ *
+ */
+constexpr size_t maxPending = 8;
+
+Frame lastFrame{};
+Pending frame{};
+std::deque<Pending> pending;
+std::vector<GLuint> spare;
+bool active = false;
+int timer = -1;
+std::ostream *dump = nullptr;
+
+void endQuery() {
+  if (!active) return;
+  glEndQuery(GL_TIME_ELAPSED);
+  active = false;
+}
+
+void publish(const Frame &f) {
+  lastFrame = f;
+  if (!dump) return;
+  auto &c = f.counters;
+  *dump << f.number << ',' << c.drawCalls << ',' << c.vertices << ','
+        << c.bufferBytes << ',' << c.textureBytes << ',' << c.textureBinds
+        << ',' << c.programSwitches;
+  for (auto ms : f.gpuMs) {
+    *dump << ',';
+    if (f.gpu) *dump << ms;
+  }
+  *dump << '\n';
+}
+
+// Отдаем кадры, для которых готовы все запросы, по порядку
+void collect() {
+  while (!pending.empty()) {
+    auto &p = pending.front();
+    Frame f{p.number, p.counters, true, {}};
+    for (auto const &q : p.queries) {
+      GLuint ready = 0;
+      glGetQueryObjectuiv(q.id, GL_QUERY_RESULT_AVAILABLE, &ready);
+      if (!ready) {
+        if (pending.size() < maxPending) return;
+        f.gpu = false;
+        break;
+      }
+    }
+    for (auto const &q : p.queries) {
+      if (f.gpu) {
+        GLuint64 ns = 0;
+        glGetQueryObjectui64v(q.id, GL_QUERY_RESULT, &ns);
+        f.gpuMs[size_t(q.pass)] += double(ns) * 1e-6;
+      }
+      spare.push_back(q.id);
+    }
+    if (!f.gpu) f.gpuMs.fill(0.);
+    publish(f);
+    pending.pop_front();
+  }
+}
+
+}  // namespace
+
+void enable(bool value) {
+  if (on && !value) {
+    endQuery();
+    // Запросы незаконченного кадра вернем в запас, чтобы не терять их
+    for (auto const &q : frame.queries) spare.push_back(q.id);
+    frame.queries.clear();
+  }
+  on = value;
+  current = Counters{};
+}
+
+bool enabled() { return on; }
+
+bool timerSupported() {
+#ifdef EMSCRIPTEN
+  return false;
+#else
+  if (timer < 0)
+    timer = (GLEW_VERSION_3_3 || GLEW_ARB_timer_query) &&
+            glGetQueryObjectui64v;
+  return timer > 0;
+#endif
+}
+
+void pass(RenderPass p) {
+  if (!on) return;
+  endQuery();
+  if (!timerSupported()) return;
+  GLuint id;
+  if (spare.empty()) {
+    glGenQueries(1, &id);
+  } else {
+    id = spare.back();
+    spare.pop_back();
+  }
+  glBeginQuery(GL_TIME_ELAPSED, id);
+  frame.queries.push_back(Query{id, p});
+  active = true;
+}
+
+void endFrame() {
+  if (!on) return;
+  endQuery();
+  frame.counters = current;
+  current = Counters{};
+  if (timerSupported()) {
+    pending.push_back(std::move(frame));
+    collect();
+  } else {
+    publish(Frame{frame.number, frame.counters, false, {}});
+  }
+  frame = Pending{frame.number + 1, {}, {}};
+}
+
+const Frame &last() { return lastFrame; }
+
+void dumpTo(std::ostream *os) {
+  dump = os;
+  if (dump)
+    *dump << "frame,draw_calls,vertices,buffer_bytes,texture_bytes,"
+             "texture_binds,program_switches,gpu_sprites_ms,gpu_darkness_ms,"
+             "gpu_figures_ms,gpu_text_ms\n";
+}
+
+}  // namespace GLStats
@@ -0,0 +1,221 @@
+/**
+ * @file glstats.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Статистика вызовов OpenGL за кадр
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Отрисовщик и текст вызывают рисование, загрузку буферов и текстур, смену
+ * текстуры и программы через обертки отсюда. Пока статистика выключена,
+ * обертки только вызывают OpenGL. Если драйвер умеет GL_TIME_ELAPSED,
+ * проходы кадра замеряются запросами времени на GPU, результат приходит
+ * через несколько кадров.
+ */
+#pragma once
+
+#include "platform.h"
+
+namespace GLStats {
+
+/**
+ * @brief счетчики кадра
+ *
+ */
+struct Counters {
+  /**
+   * @brief вызовы рисования
+   *
+   */
+  unsigned drawCalls;
+  /**
+   * @brief вершины
+   *
+   */
+  unsigned long vertices;
+  /**
+   * @brief загружено в буферы вершин, байт
+   *
+   */
+  unsigned long bufferBytes;
+  /**
+   * @brief загружено в текстуры, байт
+   *
+   */
+  unsigned long textureBytes;
+  /**
+   * @brief привязки текстур
+   *
+   */
+  unsigned textureBinds;
+  /**
+   * @brief смены программы
+   *
+   */
+  unsigned programSwitches;
+};
+
+/**
+ * @brief статистика кадра
+ *
+ */
+struct Frame {
+  /**
+   * @brief номер кадра
+   *
+   */
+  unsigned long number;
+  /**
+   * @brief счетчики
+   *
+   */
+  Counters counters;
+  /**
+   * @brief есть ли время на GPU
+   *
+   */
+  bool gpu;
+  /**
+   * @brief время проходов на GPU в мс
+   *
+   */
+  std::array<double, size_t(RenderPass::Count)> gpuMs;
+};
+
+/**
+ * @brief включена ли статистика, для оберток
+ *
+ */
+extern bool on;
+/**
+ * @brief счетчики текущего кадра
+ *
+ */
+extern Counters current;
+/**
+ * @brief последняя используемая программа
+ *
+ */
+extern GLuint program;
+
+/**
+ * @brief Включает или выключает статистику
+ *
+ * @param value включить
+ */
+void enable(bool value);
+/**
+ * @brief Включена ли статистика
+ *
+ * @return true
+ * @return false
+ */
+bool enabled();
+/**
+ * @brief Умеет ли драйвер замерять время на GPU, нужен контекст OpenGL
+ *
+ * @return true
+ * @return false
+ */
+bool timerSupported();
+/**
+ * @brief Начинает проход кадра, предыдущий заканчивается
+ *
+ * @param p проход
+ */
+void pass(RenderPass p);
+/**
+ * @brief Заканчивает кадр, вызывать перед выводом на экран
+ *
+ */
+void endFrame();
+/**
+ * @brief Статистика последнего готового кадра
+ *
+ * С замером GPU это кадр на несколько кадров раньше текущего.
+ *
+ * @return const Frame&
+ */
+const Frame &last();
+/**
+ * @brief Задает куда писать статистику каждого кадра (CSV)
+ *
+ * @param os поток или nullptr
+ */
+void dumpTo(std::ostream *os);
+
+/**
+ * @brief glDrawArrays со счетчиками
+ *
+ */
+inline void drawArrays(GLenum mode, GLint first, GLsizei count) {
+  glDrawArrays(mode, first, count);
+  if (on) {
+    current.drawCalls++;
+    current.vertices += count;
+  }
+}
+
+/**
+ * @brief glDrawElements со счетчиками, номера вершин берутся из буфера
+ *
+ */
+inline void drawElements(GLenum mode, GLsizei count, GLenum type) {
+  glDrawElements(mode, count, type, nullptr);
+  if (on) {
+    current.drawCalls++;
+    current.vertices += count;
+  }
+}
+
+/**
+ * @brief glBufferData со счетчиками
+ *
+ */
+inline void bufferData(GLenum target, GLsizeiptr size, const void *data,
+                       GLenum usage) {
+  glBufferData(target, size, data, usage);
+  if (on && data) current.bufferBytes += size;
+}
+
+/**
+ * @brief glBufferSubData со счетчиками
+ *
+ */
+inline void bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
+                          const void *data) {
+  glBufferSubData(target, offset, size, data);
+  if (on) current.bufferBytes += size;
+}
+
+/**
+ * @brief glTexSubImage2D со счетчиками, только для байтовой альфы
+ *
+ */
+inline void texSubImage2D(GLenum target, GLint level, GLint x, GLint y,
+                          GLsizei width, GLsizei height, GLenum format,
+                          GLenum type, const void *pixels) {
+  glTexSubImage2D(target, level, x, y, width, height, format, type, pixels);
+  if (on) current.textureBytes += (unsigned long)width * height;
+}
+
+/**
+ * @brief glBindTexture со счетчиками
+ *
+ */
+inline void bindTexture(GLenum target, GLuint texture) {
+  glBindTexture(target, texture);
+  if (on && texture) current.textureBinds++;
+}
+
+/**
+ * @brief glUseProgram со счетчиками, сменой считается другая программа
+ *
+ */
+inline void useProgram(GLuint id) {
+  glUseProgram(id);
+  // После отвязки (0) любая программа считается сменой
+  if (on && id && id != program) current.programSwitches++;
+  program = id;
+}
+
+}  // namespace GLStats
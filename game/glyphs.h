@@ -0,0 +1,130 @@
+/**
+ * @file glyphs.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Формат заранее растеризованного атласа символов
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Атлас готовит при сборке утилита fontbaker: файл символов (заголовок и
+ * таблица метрик) и файл атласа (байты альфы построчно) встраиваются в игру
+ * через bin2cpp.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace Glyphs {
+
+/**
+ * @brief сигнатура файла символов
+ *
+ */
+constexpr uint32_t magic = 0x46594C47;  // "GLYF"
+/**
+ * @brief версия формата
+ *
+ */
+constexpr uint32_t version = 1;
+
+/**
+ * @brief режим растеризации
+ *
+ */
+enum Mode : uint32_t {
+  /**
+   * @brief обычный растр
+   *
+   */
+  Bitmap = 0,
+  /**
+   * @brief поле расстояний
+   *
+   */
+  Sdf = 1
+};
+
+/**
+ * @brief заголовок файла символов
+ *
+ */
+struct Header {
+  /**
+   * @brief сигнатура
+   *
+   */
+  uint32_t magic;
+  /**
+   * @brief версия формата
+   *
+   */
+  uint32_t version;
+  /**
+   * @brief режим растеризации
+   *
+   */
+  uint32_t mode;
+  /**
+   * @brief размер символа в пикселях
+   *
+   */
+  uint32_t size;
+  /**
+   * @brief размах поля расстояний в пикселях
+   *
+   */
+  int32_t spread;
+  /**
+   * @brief ширина атласа
+   *
+   */
+  uint32_t width;
+  /**
+   * @brief высота атласа
+   *
+   */
+  uint32_t height;
+  /**
+   * @brief количество символов в таблице за заголовком
+   *
+   */
+  uint32_t count;
+};
+
+/**
+ * @brief метрики символа
+ *
+ */
+struct Glyph {
+  /**
+   * @brief код символа Unicode
+   *
+   */
+  uint32_t code;
+  /**
+   * @brief позиция в атласе
+   *
+   */
+  uint16_t x, y;
+  /**
+   * @brief размер растра
+   *
+   */
+  uint16_t width, height;
+  /**
+   * @brief смещение растра в строке
+   *
+   */
+  int16_t left, top;
+  /**
+   * @brief смещение до следующего символа в пикселях
+   *
+   */
+  int16_t advance;
+  /**
+   * @brief выравнивание
+   *
+   */
+  uint16_t reserved;
+};
+
+}  // namespace Glyphs
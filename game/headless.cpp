@@ -0,0 +1,283 @@
+/**
+ * @file headless.cpp
+ * @author Alex Light (dev@3107.ru)
+ * @brief Запуск игры без окна и OpenGL
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Сцена крутится на ручных часах с пустым отрисовщиком столько шагов,
+ * сколько задано, или повторяет запись ввода из игры. Выводит скорость,
+ * время и выделения памяти этапов и контрольную сумму состояния, может
+ * сохранить замеры профилировщика последних шагов и проверить, что шаги
+ * после разгона укладываются в лимит выделений памяти.
+ */
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+
+#include "jobs.h"
+#include "level.h"
+#include "memory.h"
+#include "profiler.h"
+#include "replay.h"
+#include "scene.h"
+
+/**
+ * @brief параметры запуска
+ *
+ */
+struct Options {
+  /**
+   * @brief файл конфигурации
+   *
+   */
+  const char *config = nullptr;
+  /**
+   * @brief количество шагов
+   *
+   */
+  uint32_t ticks = 10000;
+  /**
+   * @brief начальное значение случайных чисел
+   *
+   */
+  unsigned seed = 0;
+  /**
+   * @brief файл записи ввода
+   *
+   */
+  const char *replay = nullptr;
+  /**
+   * @brief файл замеров профилировщика
+   *
+   */
+  const char *trace = nullptr;
+  /**
+   * @brief лимит выделений памяти за шаг, -1 не проверяем
+   *
+   */
+  long budget = -1;
+  /**
+   * @brief шаги разгона, на которых лимит не проверяем
+   *
+   */
+  uint32_t warmup = 100;
+  /**
+   * @brief потоков пула, 0 - по числу ядер
+   *
+   */
+  size_t threads = 0;
+};
+
+/**
+ * @brief Прогоняет сцену и выводит результаты
+ *
+ * @param scene сцена
+ * @param clock часы сцены
+ * @param opt параметры, ticks - количество шагов
+ * @return true шаги после разгона уложились в лимит выделений памяти
+ * @return false нет
+ */
+bool run(Scene &scene, ManualClock &clock, const Options &opt) {
+  Scene::PhaseStats stats{};
+  scene.profile(&stats);
+
+  using namespace std::chrono;
+  auto start = steady_clock::now();
+  uint64_t worst = 0, over = 0;
+  uint32_t worstTick = 0;
+  for (uint32_t i = 0; i < opt.ticks; i++) {
+    auto allocs = Memory::counters().allocations;
+    clock.advance(processDelay);
+    scene.tick();
+    scene.draw();
+    allocs = Memory::counters().allocations - allocs;
+    if (i >= opt.warmup && allocs > worst) {
+      worst = allocs;
+      worstTick = i;
+    }
+    if (i >= opt.warmup && opt.budget >= 0 && allocs > uint64_t(opt.budget))
+      over++;
+  }
+  auto elapsed = duration<double>(steady_clock::now() - start).count();
+
+  std::cout << "Ticks: " << opt.ticks << ", time: " << elapsed
+            << " s, ticks/s: " << opt.ticks / elapsed
+            << ", score: " << scene.getScore()
+            << ", best score: " << scene.getBestScore() << std::endl;
+  auto per = [&](double v) { return opt.ticks ? v / opt.ticks : 0.; };
+  for (size_t i = 0; i < stats.size(); i++) {
+    auto &st = stats[i];
+    std::cout << "  " << std::setw(8) << std::left
+              << Scene::phaseName(Scene::Phase(i)) << st.seconds * 1000.
+              << " ms, " << per(st.seconds * 1e6) << " us/tick, "
+              << per(double(st.allocations)) << " allocs/tick, "
+              << per(double(st.bytes)) << " bytes/tick" << std::endl;
+  }
+  std::cout << "Checksum: " << std::hex << std::setw(16)
+            << std::setfill('0') << std::right << scene.checksum() << std::dec
+            << std::setfill(' ') << std::endl;
+  std::cout << "Steady state (after " << opt.warmup << " ticks): ";
+  if (worst)
+    std::cout << "max allocs/tick: " << worst << " at tick " << worstTick;
+  else
+    std::cout << "no allocations";
+  std::cout << std::endl;
+  if (opt.budget >= 0) {
+    if (over) {
+      std::cout << "Allocation budget " << opt.budget << " exceeded in "
+                << over << " ticks" << std::endl;
+      return false;
+    }
+    std::cout << "Allocation budget " << opt.budget << " ok" << std::endl;
+  }
+  return true;
+}
+
+/**
+ * @brief Разбирает целое число параметра
+ *
+ * @param s строка
+ * @param value результат
+ * @return true
+ * @return false строка не число или число слишком большое
+ */
+bool parseNumber(const char *s, long &value) {
+  char *end;
+  errno = 0;
+  value = std::strtol(s, &end, 10);
+  return end != s && !*end && errno != ERANGE;
+}
+
+/**
+ * @brief Разбирает неотрицательное целое число параметра
+ *
+ * @tparam T беззнаковый тип результата
+ * @param s строка
+ * @param value результат
+ * @return true
+ * @return false строка не число, число отрицательное или не влезает в T
+ */
+template <typename T>
+bool parseNumber(const char *s, T &value) {
+  // strtoul принимает минус и переворачивает число, отсекаем его сами
+  if (std::strchr(s, '-')) return false;
+  char *end;
+  errno = 0;
+  auto v = std::strtoul(s, &end, 10);
+  if (end == s || *end || errno == ERANGE ||
+      v > std::numeric_limits<T>::max())
+    return false;
+  value = T(v);
+  return true;
+}
+
+/**
+ * @brief Разбирает параметры запуска
+ *
+ * @param argc
+ * @param argv
+ * @param opt сюда помещаем параметры
+ * @return true
+ * @return false параметры неверные
+ */
+bool parseOptions(int argc, char **argv, Options &opt) {
+  int positional = 0;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    auto value = [&]() { return i + 1 < argc ? argv[++i] : nullptr; };
+    const char *v = nullptr;
+    if (arg == "--replay") {
+      if (!(opt.replay = value())) return false;
+    } else if (arg == "--trace") {
+      if (!(opt.trace = value())) return false;
+    } else if (arg == "--budget") {
+      if (!(v = value()) || !parseNumber(v, opt.budget)) return false;
+    } else if (arg == "--warmup") {
+      if (!(v = value()) || !parseNumber(v, opt.warmup)) return false;
+    } else if (arg == "--threads") {
+      if (!(v = value()) || !parseNumber(v, opt.threads)) return false;
+    } else if (positional == 0) {
+      opt.config = argv[i];
+      positional++;
+    } else if (positional == 1) {
+      if (!parseNumber(argv[i], opt.ticks)) return false;
+      positional++;
+    } else if (positional == 2) {
+      if (!parseNumber(argv[i], opt.seed)) return false;
+      positional++;
+    } else {
+      return false;
+    }
+  }
+  return opt.config;
+}
+
+/**
+ * @brief Принимает путь к файлу конфигурации и количество шагов с начальным
+ * значением случайных чисел или файл записи ввода, файл для замеров
+ * профилировщика и лимит выделений памяти за шаг
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int main(int argc, char **argv) {
+  Options opt;
+  if (!parseOptions(argc, argv, opt)) {
+    std::cout << "Usage: headless game.cfg [ticks] [seed] [options]"
+              << std::endl
+              << "  --replay input.rep  replay recorded input" << std::endl
+              << "  --trace out.json    save profiler samples" << std::endl
+              << "  --budget allocs     fail if a tick after warmup "
+                 "allocates more"
+              << std::endl
+              << "  --warmup ticks      ticks not checked by budget, "
+                 "default 100"
+              << std::endl
+              << "  --threads count     worker threads for loading and tick "
+                 "phases, default all cores"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (opt.trace) Profiler::enable(true);
+  Jobs::setThreads(opt.threads);
+  // Загрузка до первого шага: файл, разбор и объекты сцены
+  auto loadStart = std::chrono::steady_clock::now();
+  auto loaded = [&] {
+    std::cout << "Load: "
+              << std::chrono::duration<double, std::milli>(
+                     std::chrono::steady_clock::now() - loadStart)
+                     .count()
+              << " ms, threads: " << Jobs::threads() << std::endl;
+  };
+  Config cfg;
+  if (!cfg.open(opt.config)) return EXIT_FAILURE;
+
+  ManualClock clock;
+  NullRenderer renderer;
+  bool ok;
+  if (opt.replay) {
+    ReplayInput input;
+    if (!input.load(opt.replay)) return EXIT_FAILURE;
+    auto &header = input.getHeader();
+    if (header.config != cfg.hash()) {
+      std::cout << "Replay was recorded with another config" << std::endl;
+      return EXIT_FAILURE;
+    }
+    Scene scene(clock, input, renderer, cfg, header.seed);
+    loaded();
+    input.bind(&scene);
+    opt.ticks = header.ticks;
+    ok = run(scene, clock, opt);
+  } else {
+    NullInput input;
+    Scene scene(clock, input, renderer, cfg, opt.seed);
+    loaded();
+    ok = run(scene, clock, opt);
+  }
+  if (opt.trace && !Profiler::exportTrace(opt.trace)) ok = false;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file jobs.cpp
+ * @author Alex Light (dev@3107.ru)
+ * @brief Реализация пула потоков
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#include "jobs.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Jobs {
+
+namespace {
+
+/**
+ * @brief размер очереди потока, при переполнении участок выполняется сразу
+ *
+ */
+constexpr size_t queueSize = 256;
+
+/**
+ * @brief запущенный цикл
+ *
+ */
+struct Group {
+  Kernel kernel;
+  void *ctx;
+  /**
+   * @brief участков еще не выполнено
+   *
+   */
+  std::atomic<size_t> pending;
+};
+
+/**
+ * @brief участок цикла
+ *
+ */
+struct Task {
+  Group *group;
+  size_t begin, end;
+};
+
+/**
+ * @brief очередь участков потока, кольцо под блокировкой
+ *
+ */
+struct Queue {
+  std::mutex mutex;
+  Task ring[queueSize];
+  size_t head = 0, tail = 0;
+};
+
+/**
+ * @brief пул потоков
+ *
+ */
+struct Pool {
+  size_t count = 0;
+  std::vector<std::thread> workers;
+  std::unique_ptr<Queue[]> queues;
+  /**
+   * @brief участков во всех очередях
+   *
+   */
+  std::atomic<size_t> queued{0};
+  /**
+   * @brief очередь для следующего участка
+   *
+   */
+  std::atomic<size_t> next{0};
+  std::mutex sleep;
+  std::condition_variable wake;
+  bool stop = false;
+
+  ~Pool() { shutdown(); }
+
+  void start(size_t n) {
+    shutdown();
+    count = n;
+    if (n < 2) return;
+    queues.reset(new Queue[n - 1]);
+    for (size_t i = 0; i + 1 < n; i++)
+      workers.emplace_back([this, i] { work(i); });
+  }
+
+  void shutdown() {
+    {
+      std::lock_guard<std::mutex> lock(sleep);
+      stop = true;
+    }
+    wake.notify_all();
+    for (auto &t : workers) t.join();
+    workers.clear();
+    queues.reset();
+    stop = false;
+  }
+
+  bool push(const Task &t) {
+    auto &q = queues[next.fetch_add(1, std::memory_order_relaxed) %
+                     workers.size()];
+    {
+      std::lock_guard<std::mutex> lock(q.mutex);
+      if (q.tail - q.head == queueSize) return false;
+      q.ring[q.tail++ % queueSize] = t;
+    }
+    queued.fetch_add(1);
+    // Берем блокировку, чтобы не потерять пробуждение засыпающего потока
+    { std::lock_guard<std::mutex> lock(sleep); }
+    wake.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Берет участок, свой с конца очереди, чужой с начала
+   *
+   * @param self номер потока, поиск начинается с очереди self % потоков
+   */
+  bool take(size_t self, Task &t) {
+    if (!queued.load()) return false;
+    auto n = workers.size();
+    for (size_t k = 0; k < n; k++) {
+      auto i = (self + k) % n;
+      auto &q = queues[i];
+      std::lock_guard<std::mutex> lock(q.mutex);
+      if (q.head == q.tail) continue;
+      t = i == self ? q.ring[--q.tail % queueSize]
+                    : q.ring[q.head++ % queueSize];
+      queued.fetch_sub(1);
+      return true;
+    }
+    return false;
+  }
+
+  static void execute(const Task &t) {
+    t.group->kernel(t.group->ctx, t.begin, t.end);
+    t.group->pending.fetch_sub(1, std::memory_order_release);
+  }
+
+  void work(size_t self) {
+    for (;;) {
+      Task t;
+      if (take(self, t)) {
+        execute(t);
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep);
+      wake.wait(lock, [&] { return stop || queued.load() > 0; });
+      if (stop) return;
+    }
+  }
+};
+
+Pool &pool() {
+  static Pool p;
+  return p;
+}
+
+/**
+ * @brief Количество потоков по умолчанию
+ *
+ */
+size_t defaultThreads() {
+#ifdef EMSCRIPTEN
+  return 1;  // Без pthread потоков в браузере нет
+#else
+  return std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+#endif
+}
+
+}  // namespace
+
+size_t threads() {
+  auto &p = pool();
+  if (!p.count) p.start(defaultThreads());
+  return p.count;
+}
+
+void setThreads(size_t count) {
+#ifdef EMSCRIPTEN
+  count = 1;
+#endif
+  pool().start(count ? count : defaultThreads());
+}
+
+void run(size_t count, size_t grain, Kernel kernel, void *ctx) {
+  if (!count) return;
+  auto &p = pool();
+  grain = std::max(grain, size_t(1));
+  // Участков в несколько раз больше потоков, чтобы было что красть
+  auto chunks = std::min((count + grain - 1) / grain, threads() * 4);
+  if (chunks < 2 || p.workers.empty()) return kernel(ctx, 0, count);
+
+  Group group{kernel, ctx, {chunks}};
+  auto bound = [&](size_t i) { return count * i / chunks; };
+  for (size_t i = 1; i < chunks; i++) {
+    Task t{&group, bound(i), bound(i + 1)};
+    if (!p.push(t)) Pool::execute(t);
+  }
+  Pool::execute(Task{&group, 0, bound(1)});
+  // Помогаем, пока цикл не закончится. Номер больше номеров рабочих
+  // потоков, так что своей очереди нет и все участки крадутся
+  auto self = p.workers.size();
+  while (group.pending.load(std::memory_order_acquire)) {
+    Task t;
+    if (p.take(self++, t))
+      Pool::execute(t);
+    else
+      std::this_thread::yield();
+  }
+}
+
+}  // namespace Jobs
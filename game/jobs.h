@@ -0,0 +1,71 @@
+/**
+ * @file jobs.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Пул потоков для параллельных циклов
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * У каждого рабочего потока своя очередь участков. Поток берет свежие
+ * участки из конца своей очереди, а когда она пуста, крадет старые из начала
+ * чужих. Поток, запустивший цикл, тоже выполняет участки, пока цикл не
+ * закончится, поэтому циклы можно вкладывать. Очереди фиксированного
+ * размера, запуск цикла память не выделяет.
+ */
+#pragma once
+
+#include "common.h"
+
+namespace Jobs {
+
+/**
+ * @brief Функция участка [begin, end)
+ *
+ */
+using Kernel = void (*)(void *ctx, size_t begin, size_t end);
+
+/**
+ * @brief Количество потоков вместе с вызывающим
+ *
+ * @return size_t
+ */
+size_t threads();
+/**
+ * @brief Задает количество потоков вместе с вызывающим
+ *
+ * 1 - все выполняется в вызывающем потоке. Нельзя вызывать во время цикла.
+ *
+ * @param count количество, 0 - по числу ядер
+ */
+void setThreads(size_t count);
+/**
+ * @brief Выполняет kernel над участками [0, count) и ждет окончания
+ *
+ * @param count количество элементов
+ * @param grain наименьший размер участка
+ * @param kernel функция участка
+ * @param ctx параметр функции
+ */
+void run(size_t count, size_t grain, Kernel kernel, void *ctx);
+
+/**
+ * @brief Параллельный цикл, f(begin, end) вызывается для участков [0, count)
+ *
+ * Участки выполняются в любом порядке, для повторяемого результата каждый
+ * участок пишет только в свои элементы.
+ *
+ * @tparam F функция
+ * @param count количество элементов
+ * @param grain наименьший размер участка
+ * @param f функция участка
+ */
+template <typename F>
+void parallelFor(size_t count, size_t grain, F &&f) {
+  using Fn = std::remove_reference_t<F>;
+  run(count, grain,
+      [](void *ctx, size_t begin, size_t end) {
+        (*static_cast<Fn *>(ctx))(begin, end);
+      },
+      const_cast<void *>(static_cast<const void *>(&f)));
+}
+
+}  // namespace Jobs
@@ -0,0 +1,409 @@
+/**
+ * @file level.cpp
+ * @author Alex Light (dev@3107.ru)
+ * @brief Реализация скомпилированного уровня и конфигурации
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#include "level.h"
+
+#include <algorithm>
+
+#include "jobs.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Level {
+
+bool compile(const std::vector<std::vector<Point>> &cfg, const char *file,
+             GLfloat worldSize) {
+  // Разбиение и сетку строят объекты, пишем их массивы подряд
+  Objects objects(Color{});
+  bool chunked = worldSize > gameSize;
+  if (chunked) {
+    auto scaled = cfg;
+    for (auto &pts : scaled)
+      for (auto &pt : pts) pt = pt * (worldSize / gameSize);
+    objects.set(scaled);
+  } else {
+    objects.set(cfg);
+  }
+  Header header{};
+  header.magic = magic;
+  header.version = version;
+
+  // Объекты мира идут по кускам, внутри куска в прежнем порядке
+  std::vector<uint32_t> order(objects.size());
+  for (size_t i = 0; i < order.size(); i++) order[i] = uint32_t(i);
+  std::vector<ChunkRecord> chunks;
+  if (chunked) {
+    auto bounds = [&](size_t i) {
+      auto v = objects.getPoints(i);
+      std::pair<Point, Point> b{v[0], v[0]};
+      for (size_t k = 1; k < v.size(); k++) {
+        for (size_t j = 0; j < AXES; j++) {
+          b.first[j] = std::min(b.first[j], v[k][j]);
+          b.second[j] = std::max(b.second[j], v[k][j]);
+        }
+      }
+      return b;
+    };
+    auto n = uint32_t(std::ceil(2.f * worldSize / chunkSize));
+    header.chunks = n;
+    header.chunk = Size{chunkSize, chunkSize};
+    header.min = Point{-worldSize, -worldSize};
+    std::vector<uint32_t> chunkOf(objects.size());
+    for (size_t i = 0; i < objects.size(); i++) {
+      auto b = bounds(i);
+      uint32_t c[AXES];
+      for (size_t j = 0; j < AXES; j++) {
+        auto center = (b.first[j] + b.second[j]) / 2.f;
+        auto k = std::floor((center - header.min[j]) / chunkSize);
+        c[j] = uint32_t(std::max(std::min(k, GLfloat(n - 1)), 0.f));
+      }
+      chunkOf[i] = c[1] * n + c[0];
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+      return chunkOf[a] < chunkOf[b];
+    });
+    chunks.resize(size_t(n) * n);
+    for (size_t c = 0; c < chunks.size(); c++) {
+      // Пустой кусок - точка в его углу
+      Point corner{header.min[0] + chunkSize * GLfloat(c % n),
+                   header.min[1] + chunkSize * GLfloat(c / n)};
+      chunks[c] = ChunkRecord{0, 0, corner, corner};
+    }
+    for (uint32_t k = 0; k < order.size(); k++) {
+      auto &ch = chunks[chunkOf[order[k]]];
+      auto b = bounds(order[k]);
+      if (!ch.count) {
+        ch.first = k;
+        ch.min = b.first;
+        ch.max = b.second;
+      }
+      ch.count++;
+      for (size_t j = 0; j < AXES; j++) {
+        ch.min[j] = std::min(ch.min[j], b.first[j]);
+        ch.max[j] = std::max(ch.max[j], b.second[j]);
+      }
+    }
+    // У пустых кусков первый объект - конец предыдущих
+    uint32_t next = 0;
+    for (auto &ch : chunks) {
+      if (!ch.count) ch.first = next;
+      next = ch.first + ch.count;
+    }
+  }
+
+  std::vector<ObjectRecord> records;
+  std::vector<Point> points;
+  std::vector<TriangleIndexes> triangles;
+  for (auto i : order) {
+    auto v = objects.getPoints(i);
+    auto t = objects.getIndexes(i);
+    records.push_back(
+        ObjectRecord{uint32_t(points.size()), uint32_t(v.size()),
+                     uint32_t(triangles.size()), uint32_t(t.size())});
+    points.insert(points.end(), v.floats, v.floats + v.size());
+    triangles.insert(triangles.end(), t.begin(), t.end());
+  }
+  if (chunked) {
+    header.max = Point{worldSize, worldSize};
+  } else {
+    for (size_t i = 0; i < points.size(); i++) {
+      for (size_t j = 0; j < AXES; j++) {
+        auto v = points[i][j];
+        header.min[j] = i ? std::min(header.min[j], v) : v;
+        header.max[j] = i ? std::max(header.max[j], v) : v;
+      }
+    }
+  }
+  // Сетка общая на все объекты, у мира ее строят загруженные куски
+  auto grid = chunked ? SpatialGrid() : objects.getGrid();
+  header.objects = uint32_t(records.size());
+  header.points = uint32_t(points.size());
+  header.triangles = uint32_t(triangles.size());
+  header.cells = grid.size;
+  header.items = uint32_t(grid.items.size());
+  header.cell = grid.cell;
+
+  std::ofstream fs(file, std::ios::binary);
+  auto write = [&](const void *p, size_t size) {
+    fs.write(static_cast<const char *>(p), size);
+  };
+  write(&header, sizeof(header));
+  write(records.data(), records.size() * sizeof(ObjectRecord));
+  write(points.data(), points.size() * sizeof(Point));
+  write(triangles.data(), triangles.size() * sizeof(TriangleIndexes));
+  write(grid.start.data(), grid.start.size() * sizeof(uint32_t));
+  write(grid.items.data(), grid.items.size() * sizeof(uint32_t));
+  write(chunks.data(), chunks.size() * sizeof(ChunkRecord));
+  if (!fs) {
+    std::cout << "Error writing level: " << file << std::endl;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace Level
+
+#ifdef _WIN32
+
+bool MappedFile::open(const char *name) {
+  close();
+  file = CreateFileA(name, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                     OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    file = nullptr;
+    return false;
+  }
+  LARGE_INTEGER sz;
+  if (!GetFileSizeEx(file, &sz)) return close(), false;
+  len = size_t(sz.QuadPart);
+  if (!len) return true;
+  mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping) return close(), false;
+  ptr = static_cast<const char *>(
+      MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+  if (!ptr) return close(), false;
+  return true;
+}
+
+void MappedFile::close() {
+  if (ptr) UnmapViewOfFile(ptr);
+  if (mapping) CloseHandle(mapping);
+  if (file) CloseHandle(file);
+  ptr = nullptr;
+  mapping = file = nullptr;
+  len = 0;
+}
+
+#else
+
+bool MappedFile::open(const char *name) {
+  close();
+  int fd = ::open(name, O_RDONLY);
+  if (fd < 0) return false;
+  struct stat st;
+  bool ok = !fstat(fd, &st);
+  if (ok && st.st_size > 0) {
+    auto p = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ok = p != MAP_FAILED;
+    if (ok) {
+      ptr = static_cast<const char *>(p);
+      len = size_t(st.st_size);
+    }
+  }
+  ::close(fd);  // Отображение остается и без дескриптора
+  return ok;
+}
+
+void MappedFile::close() {
+  if (ptr) munmap(const_cast<char *>(ptr), len);
+  ptr = nullptr;
+  len = 0;
+}
+
+#endif
+
+/**
+ * @brief Парсит текст конфига на пуле потоков
+ *
+ * Текст режется на участки по началам полигонов '[', внутри полигона этого
+ * символа нет. Участки склеиваются по порядку, ошибка выводится первая по
+ * тексту, результат совпадает с parseConfig.
+ *
+ * @param first начало текста
+ * @param last конец текста
+ * @return std::vector<std::vector<Point>>
+ */
+static std::vector<std::vector<Point>> parseText(const char *first,
+                                                 const char *last) {
+  // Участки не меньше 64 КБ, мелкие конфиги разбираются в одном потоке
+  constexpr size_t minChunk = 64 * 1024;
+  auto size = size_t(last - first);
+  auto n = std::max(std::min(Jobs::threads() * 4, size / minChunk), size_t(1));
+  std::vector<const char *> bounds{first};
+  for (size_t i = 1; i < n; i++) {
+    auto p = std::max(first + size * i / n, bounds.back());
+    auto next = static_cast<const char *>(std::memchr(p, '[', last - p));
+    bounds.push_back(next ? next : last);
+  }
+  bounds.push_back(last);
+
+  std::vector<ConfigChunk> chunks(n);
+  Jobs::parallelFor(n, 1, [&](size_t begin, size_t end) {
+    for (auto i = begin; i < end; i++)
+      parseConfigChunk(bounds[i], bounds[i + 1], chunks[i]);
+  });
+  ConfigChunk all;
+  size_t count = 0;
+  for (auto &c : chunks) {
+    if (c.error) {
+      printConfigError(first, c);
+      return {};
+    }
+    if (!c.count) continue;
+    for (size_t j = 0; j < AXES; j++) {
+      all.min[j] = all.count ? std::min(all.min[j], c.min[j]) : c.min[j];
+      all.max[j] = all.count ? std::max(all.max[j], c.max[j]) : c.max[j];
+    }
+    all.count += c.count;
+    count += c.polygons.size();
+  }
+  Size scale;
+  if (!configSize(all, scale)) return {};
+  all.polygons.reserve(count);
+  for (auto &c : chunks)
+    for (auto &pts : c.polygons) all.polygons.push_back(std::move(pts));
+  Jobs::parallelFor(all.polygons.size(), 256, [&](size_t begin, size_t end) {
+    for (auto i = begin; i < end; i++)
+      normalizeConfig(all.polygons[i], all.min, scale);
+  });
+  return std::move(all.polygons);
+}
+
+bool Config::open(const char *name) {
+  buffer.clear();
+  if (!file.open(name)) {
+    std::cout << "Error reading file: " << name << std::endl;
+    return false;
+  }
+  data = file.data();
+  size = file.size();
+  return parse(name);
+}
+
+bool Config::assign(std::string str) {
+  file.close();
+  buffer = std::move(str);
+  data = buffer.data();
+  size = buffer.size();
+  return parse("config");
+}
+
+bool Config::parse(const char *name) {
+  uint32_t sign = 0;
+  if (size >= sizeof(sign)) std::memcpy(&sign, data, sizeof(sign));
+  binary = sign == Level::magic;
+  image = ObjectsImage();
+  header = Level::Header();
+  chunkTable = View<Level::ChunkRecord>();
+  polygons.clear();
+  if (!binary) {
+    polygons = parseText(data, data + size);
+    return true;
+  }
+
+  auto broken = [&] {
+    std::cout << "Level is broken: " << name << std::endl;
+    binary = false;
+    image = ObjectsImage();
+    chunkTable = View<Level::ChunkRecord>();
+    return false;
+  };
+  if (size < sizeof(Level::Header)) return broken();
+  auto &h = *reinterpret_cast<const Level::Header *>(data);
+  if (h.version != Level::version) {
+    std::cout << "Wrong level version: " << name << std::endl;
+    binary = false;
+    return false;
+  }
+  uint64_t starts = h.cells ? uint64_t(h.cells) * h.cells + 1 : 0;
+  uint64_t chunks = uint64_t(h.chunks) * h.chunks;
+  uint64_t expected = sizeof(h) + uint64_t(h.objects) * sizeof(ObjectRecord) +
+                      uint64_t(h.points) * sizeof(Point) +
+                      uint64_t(h.triangles) * sizeof(TriangleIndexes) +
+                      (starts + h.items) * sizeof(uint32_t) +
+                      chunks * sizeof(Level::ChunkRecord);
+  if (expected != size) return broken();
+
+  // Массивы идут подряд, все размеры кратны 4 байтам
+  auto p = data + sizeof(h);
+  auto take = [&](auto &view, size_t count) {
+    using T = std::remove_reference_t<decltype(*view.first)>;
+    view.first = reinterpret_cast<const T *>(p);
+    view.count = count;
+    p += count * sizeof(T);
+  };
+  take(image.records, h.objects);
+  take(image.points, h.points);
+  take(image.triangles, h.triangles);
+  take(image.grid.start, size_t(starts));
+  take(image.grid.items, h.items);
+  take(chunkTable, size_t(chunks));
+  image.grid.size = h.cells;
+  image.grid.min = h.min;
+  image.grid.cell = h.cell;
+
+  // Проверим ссылки, чтобы испорченный файл не увел чтение за массивы
+  for (auto const &r : image.records) {
+    if (r.pointCount < 3 || uint64_t(r.points) + r.pointCount > h.points ||
+        uint64_t(r.triangles) + r.triangleCount > h.triangles)
+      return broken();
+    for (auto k = r.triangles; k < r.triangles + r.triangleCount; k++)
+      for (auto i : image.triangles[k])
+        if (i >= r.pointCount) return broken();
+  }
+  if (h.cells) {
+    if (!(h.cell[0] > 0.f && h.cell[1] > 0.f)) return broken();
+    auto &grid = image.grid;
+    if (grid.start[0] || grid.start[starts - 1] != h.items) return broken();
+    for (size_t c = 0; c + 1 < starts; c++) {
+      if (grid.start[c] > grid.start[c + 1]) return broken();
+      for (auto k = grid.start[c]; k < grid.start[c + 1]; k++) {
+        if (grid.items[k] >= h.objects) return broken();
+        if (k > grid.start[c] && grid.items[k] <= grid.items[k - 1])
+          return broken();
+      }
+    }
+  }
+  // Куски идут подряд и покрывают все объекты
+  if (chunks) {
+    if (!(h.chunk[0] > 0.f && h.chunk[1] > 0.f)) return broken();
+    uint64_t next = 0;
+    for (auto const &c : chunkTable) {
+      if (c.first != next) return broken();
+      next += c.count;
+    }
+    if (next != h.objects) return broken();
+  }
+  header = h;
+  return true;
+}
+
+uint64_t Config::hash() const { return fnv1a(data, size); }
+
+bool Config::isBinary() const { return binary; }
+
+void Config::load(Objects &objects) const {
+  if (binary)
+    objects.borrow(image);
+  else
+    objects.set(polygons);
+}
+
+const Level::Header &Config::getHeader() const { return header; }
+
+const Level::ChunkRecord &Config::getChunk(size_t i) const {
+  return chunkTable[i];
+}
+
+void Config::loadChunk(size_t i, Objects &objects) const {
+  // Записи ссылаются на общие массивы, берем только записи куска
+  auto &c = chunkTable[i];
+  ObjectsImage img;
+  img.records = View<ObjectRecord>{image.records.data() + c.first, c.count};
+  img.points = image.points;
+  img.triangles = image.triangles;
+  objects.borrow(img);
+}
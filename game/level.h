@@ -0,0 +1,287 @@
+/**
+ * @file level.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Конфигурация уровня: текст или скомпилированный файл
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Скомпилированный файл (levelc): заголовок Level::Header, затем массивы
+ * ObjectRecord, Point, TriangleIndexes, начала списков ячеек сетки, номера
+ * объектов ячеек и куски мира ChunkRecord. Точки уже приведены к полю или к
+ * миру больше поля, полигоны разбиты на треугольники. Уровень больше поля
+ * делится на куски, объекты в файле идут по кускам, общей сетки нет. Числа
+ * пишутся как есть, компилировать нужно на платформе с тем же порядком байт.
+ * Файл отображается в память, и объекты берут массивы прямо из него.
+ */
+#pragma once
+
+#include "objects.h"
+
+namespace Level {
+
+/**
+ * @brief сигнатура файла
+ *
+ */
+constexpr uint32_t magic = 0x4C564C47;  // "GLVL"
+/**
+ * @brief версия формата
+ *
+ */
+constexpr uint32_t version = 2;
+
+/**
+ * @brief заголовок файла
+ *
+ */
+struct Header {
+  /**
+   * @brief сигнатура
+   *
+   */
+  uint32_t magic;
+  /**
+   * @brief версия формата
+   *
+   */
+  uint32_t version;
+  /**
+   * @brief количество объектов
+   *
+   */
+  uint32_t objects;
+  /**
+   * @brief количество точек
+   *
+   */
+  uint32_t points;
+  /**
+   * @brief количество треугольников
+   *
+   */
+  uint32_t triangles;
+  /**
+   * @brief ячеек сетки по каждой оси
+   *
+   */
+  uint32_t cells;
+  /**
+   * @brief номеров объектов во всех ячейках
+   *
+   */
+  uint32_t items;
+  /**
+   * @brief кусков мира по каждой оси, 0 - уровень не делится
+   *
+   */
+  uint32_t chunks;
+  /**
+   * @brief границы точек
+   *
+   */
+  Point min, max;
+  /**
+   * @brief размер ячейки сетки
+   *
+   */
+  Size cell;
+  /**
+   * @brief размер куска, куски начинаются от min
+   *
+   */
+  Size chunk;
+};
+
+/**
+ * @brief кусок мира
+ *
+ */
+struct ChunkRecord {
+  /**
+   * @brief первый объект куска
+   *
+   */
+  uint32_t first;
+  /**
+   * @brief количество объектов
+   *
+   */
+  uint32_t count;
+  /**
+   * @brief границы точек объектов, могут выходить за кусок
+   *
+   */
+  Point min, max;
+};
+
+/**
+ * @brief Компилирует уровень в файл
+ *
+ * Объект попадает в кусок по центру своих границ.
+ *
+ * @param cfg полигоны, как их возвращает parseConfig
+ * @param file имя файла
+ * @param worldSize половина стороны мира, больше gameSize - уровень
+ * делится на куски
+ * @return true записали
+ * @return false ошибка
+ */
+bool compile(const std::vector<std::vector<Point>> &cfg, const char *file,
+             GLfloat worldSize = gameSize);
+
+}  // namespace Level
+
+/**
+ * @brief Файл, отображенный в память только для чтения
+ *
+ */
+class MappedFile {
+  const char *ptr = nullptr;
+  size_t len = 0;
+#ifdef _WIN32
+  void *file = nullptr;
+  void *mapping = nullptr;
+#endif
+
+ public:
+  MappedFile() = default;
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile() { close(); }
+  /**
+   * @brief Отображает файл
+   *
+   * @param name имя файла
+   * @return true получилось
+   * @return false ошибка
+   */
+  bool open(const char *name);
+  /**
+   * @brief Закрывает файл
+   *
+   */
+  void close();
+  const char *data() const { return ptr; }
+  size_t size() const { return len; }
+};
+
+/**
+ * @brief Конфигурация уровня
+ *
+ * Формат определяется по сигнатуре: скомпилированный уровень или текст для
+ * parseConfig. Память конфигурации должна жить, пока объекты ее используют.
+ */
+class Config {
+  /**
+   * @brief отображенный файл
+   *
+   */
+  MappedFile file;
+  /**
+   * @brief содержимое, если оно не из файла
+   *
+   */
+  std::string buffer;
+  /**
+   * @brief содержимое
+   *
+   */
+  const char *data = nullptr;
+  size_t size = 0;
+  /**
+   * @brief скомпилированный уровень
+   *
+   */
+  bool binary = false;
+  /**
+   * @brief массивы скомпилированного уровня
+   *
+   */
+  ObjectsImage image;
+  /**
+   * @brief заголовок скомпилированного уровня
+   *
+   */
+  Level::Header header{};
+  /**
+   * @brief куски мира
+   *
+   */
+  View<Level::ChunkRecord> chunkTable;
+  /**
+   * @brief полигоны текстовой конфигурации
+   *
+   */
+  std::vector<std::vector<Point>> polygons;
+
+  /**
+   * @brief Разбирает содержимое
+   *
+   * @param name имя для сообщений об ошибках
+   * @return true
+   * @return false скомпилированный уровень поврежден
+   */
+  bool parse(const char *name);
+
+ public:
+  Config() = default;
+  Config(const Config &) = delete;
+  Config &operator=(const Config &) = delete;
+  /**
+   * @brief Загружает конфигурацию из файла
+   *
+   * @param name имя файла
+   * @return true
+   * @return false ошибка
+   */
+  bool open(const char *name);
+  /**
+   * @brief Загружает конфигурацию из строки
+   *
+   * @param str содержимое
+   * @return true
+   * @return false ошибка
+   */
+  bool assign(std::string str);
+  /**
+   * @brief Хеш содержимого, для записи ввода
+   *
+   * @return uint64_t
+   */
+  uint64_t hash() const;
+  /**
+   * @brief Скомпилированный ли уровень
+   *
+   * @return true
+   * @return false текст
+   */
+  bool isBinary() const;
+  /**
+   * @brief Заполняет объекты препятствиями уровня
+   *
+   * Уровень из кусков загружается целиком.
+   *
+   * @param objects объекты
+   */
+  void load(Objects &objects) const;
+  /**
+   * @brief Заголовок скомпилированного уровня
+   *
+   * @return const Level::Header& chunks 0 для текста
+   */
+  const Level::Header &getHeader() const;
+  /**
+   * @brief Кусок мира
+   *
+   * @param i номер, y * chunks + x
+   * @return const Level::ChunkRecord&
+   */
+  const Level::ChunkRecord &getChunk(size_t i) const;
+  /**
+   * @brief Заполняет объекты препятствиями куска
+   *
+   * @param i номер куска
+   * @param objects объекты
+   */
+  void loadChunk(size_t i, Objects &objects) const;
+};
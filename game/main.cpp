@@ -8,6 +8,11 @@
  * \section intro_sec Информация
  * Игра разработана как тест. Автор Alex Light (dev@3107.ru).
  */
+#include "glplatform.h"
+#include "glstats.h"
+#include "level.h"
+#include "profiler.h"
+#include "replay.h"
 #include "scene.h"
 
 /**
@@ -16,25 +21,100 @@
  */
 #ifdef EMSCRIPTEN
 #include <emscripten.h>
-std::string readConfig() {
-  return emscripten_run_script_string(
-      "(function(){return atob(Module.gameConfig);})()");
+/**
+ * @brief Загрузка конфигурации из javascript
+ *
+ * Строка приходит в base64 и раскодируется здесь, скомпилированный уровень
+ * содержит нули и строкой C не передается.
+ *
+ * @param cfg конфигурация
+ * @return true
+ * @return false ошибка
+ */
+bool readConfig(Config &cfg) {
+  const char *str = emscripten_run_script_string("Module.gameConfig");
+  std::string data;
+  uint32_t bits = 0;
+  int count = 0;
+  for (; *str; str++) {
+    auto c = *str;
+    int v = c >= 'A' && c <= 'Z'   ? c - 'A'
+            : c >= 'a' && c <= 'z' ? c - 'a' + 26
+            : c >= '0' && c <= '9' ? c - '0' + 52
+            : c == '+'             ? 62
+            : c == '/'             ? 63
+                                   : -1;
+    if (v < 0) continue;  // '=' и переводы строк
+    bits = bits << 6 | uint32_t(v);
+    if ((count += 6) >= 8) {
+      count -= 8;
+      data.push_back(char(bits >> count & 0xff));
+    }
+  }
+  return cfg.assign(std::move(data));
 }
 #else
 /**
  * @brief Загрузка конфигурации из файла
  *
- * @param file Путь к файлу
- * @return std::string строка конфигурации
+ * @param cfg конфигурация
+ * @param file Путь к файлу, текст или скомпилированный уровень
+ * @return true
+ * @return false ошибка
  */
-std::string readConfig(const char *file) {
-  std::ifstream fs(file);
-  return std::string((std::istreambuf_iterator<char>(fs)),
-                     std::istreambuf_iterator<char>());
-}
+bool readConfig(Config &cfg, const char *file) { return cfg.open(file); }
 #endif
 /**
- * @brief Стартовый метод, принимает параметр путь к файлу конфигурации
+ * @brief Включает статистику OpenGL с записью каждого кадра в glstats.csv
+ * или выключает и выводит последний кадр
+ *
+ */
+void toggleGLStats() {
+  static std::ofstream csv;
+  if (GLStats::enabled()) {
+    GLStats::enable(false);
+    GLStats::dumpTo(nullptr);
+    csv.close();
+    auto &f = GLStats::last();
+    std::cout << "GL frame " << f.number
+              << ": draw calls: " << f.counters.drawCalls
+              << ", vertices: " << f.counters.vertices
+              << ", buffer bytes: " << f.counters.bufferBytes
+              << ", texture bytes: " << f.counters.textureBytes
+              << ", texture binds: " << f.counters.textureBinds
+              << ", program switches: " << f.counters.programSwitches
+              << std::endl;
+  } else {
+    csv.open("glstats.csv");
+    GLStats::dumpTo(&csv);
+    GLStats::enable(true);
+    std::cout << "GL stats to glstats.csv, GPU timer: "
+              << (GLStats::timerSupported() ? "yes" : "no") << std::endl;
+  }
+}
+
+/**
+ * @brief Что нужно обработчикам окна
+ *
+ */
+struct WindowContext {
+  Scene *scene;
+  GlfwInput *input;
+};
+
+/**
+ * @brief Данные обработчиков окна
+ *
+ * @param window окно
+ * @return WindowContext&
+ */
+WindowContext &context(GLFWwindow *window) {
+  return *reinterpret_cast<WindowContext *>(glfwGetWindowUserPointer(window));
+}
+
+/**
+ * @brief Стартовый метод, принимает параметр путь к файлу конфигурации и
+ * необязательный путь к файлу записи ввода для повтора в headless
  *
  * @param argc
  * @param argv
@@ -43,10 +123,11 @@ std::string readConfig(const char *file) {
 int main(int argc, char **argv) {
   std::cout << "Starting game..." << std::endl;
 
+  Config cfg;
 #ifdef EMSCRIPTEN
-  std::string cfg = readConfig();
+  readConfig(cfg);
 #else
-  std::string cfg = readConfig(argc >= 2 ? argv[1] : "game.cfg");
+  readConfig(cfg, argc >= 2 ? argv[1] : "game.cfg");
 #endif
 
   if (!glfwInit()) {
@@ -64,6 +145,8 @@ int main(int argc, char **argv) {
   }
 
   glfwMakeContextCurrent(window);
+  // Кадры по vsync, без него цикл ждет сам
+  glfwSwapInterval(1);
 
   glewExperimental = true;
   if (glewInit() != GLEW_OK) {
@@ -73,49 +156,91 @@ int main(int argc, char **argv) {
 
   glViewport(0, 0, WNDSIZE, WNDSIZE);
 
-  Scene scene(window, parseConfig(cfg));
+  GlfwClock clock;
+  GlfwInput input;
+  GLRenderer renderer(window);
+  auto seed = std::random_device()();
+  Scene scene(clock, input, renderer, cfg, seed);
+  input.bind(&scene);
 
-  glfwSetWindowUserPointer(window, &scene);
+  // Запишем ввод, если задан файл
+  std::unique_ptr<Recorder> recorder;
+#ifndef EMSCRIPTEN
+  if (argc >= 3) {
+    recorder = std::make_unique<Recorder>(seed, cfg.hash());
+    scene.record(recorder.get());
+  }
+#endif
+
+  WindowContext ctx{&scene, &input};
+  glfwSetWindowUserPointer(window, &ctx);
 
   glfwSetFramebufferSizeCallback(
       window, [](GLFWwindow *window, int width, int height) {
         auto sz = std::min(width, height);
         glViewport((width - sz) / 2, (height - sz) / 2, sz, sz);
+        context(window).scene->invalidate();
       });
 
+  // Окно открылось после перекрытия, содержимое нужно нарисовать заново
+  glfwSetWindowRefreshCallback(window, [](GLFWwindow *window) {
+    context(window).scene->invalidate();
+  });
+
   glfwSetMouseButtonCallback(window, [](GLFWwindow *window, int button,
                                         int action, int mods) {
-    Scene *scene = reinterpret_cast<Scene *>(glfwGetWindowUserPointer(window));
+    auto input = context(window).input;
     switch (button) {
       case GLFW_MOUSE_BUTTON_LEFT:
         if (action == GLFW_PRESS) {
-          double x, y;
-          glfwGetCursorPos(window, &x, &y);
-          scene->onClick(x, y);
+          double mx, my;
+          glfwGetCursorPos(window, &mx, &my);
+          // Переведем в координаты игры
+          GLint vp[4];
+          glGetIntegerv(GL_VIEWPORT, vp);
+          GLfloat x = GLfloat(mx - vp[0]) / (vp[2] - vp[0]) * 2.f - 1.f;
+          GLfloat y = GLfloat(vp[3] - my) / (vp[3] - vp[1]) * 2.f - 1.f;
+          input->click({x, y});
         }
     }
   });
 
   glfwSetKeyCallback(window, [](GLFWwindow *window, int key, int scancode,
                                 int action, int mods) {
-    Scene *scene = reinterpret_cast<Scene *>(glfwGetWindowUserPointer(window));
+    auto &ctx = context(window);
+    // Клавиши игры идут в очередь ввода, остальные действуют сразу
+    auto input = ctx.input;
     if (action != GLFW_REPEAT) {
       switch (key) {
         case GLFW_KEY_A:
         case GLFW_KEY_LEFT:
-          scene->onKey(Scene::Keys::Left, action == GLFW_PRESS);
+          input->key(Scene::Keys::Left, action == GLFW_PRESS);
           break;
         case GLFW_KEY_W:
         case GLFW_KEY_UP:
-          scene->onKey(Scene::Keys::Up, action == GLFW_PRESS);
+          input->key(Scene::Keys::Up, action == GLFW_PRESS);
           break;
         case GLFW_KEY_D:
         case GLFW_KEY_RIGHT:
-          scene->onKey(Scene::Keys::Right, action == GLFW_PRESS);
+          input->key(Scene::Keys::Right, action == GLFW_PRESS);
           break;
         case GLFW_KEY_S:
         case GLFW_KEY_DOWN:
-          scene->onKey(Scene::Keys::Down, action == GLFW_PRESS);
+          input->key(Scene::Keys::Down, action == GLFW_PRESS);
+          break;
+        // Профилировщик: включить/выключить и сохранить замеры
+        case GLFW_KEY_F3:
+          if (action == GLFW_PRESS) {
+            Profiler::enable(!Profiler::enabled());
+            ctx.scene->invalidate();
+          }
+          break;
+        case GLFW_KEY_F4:
+          if (action == GLFW_PRESS) Profiler::exportTrace("trace.json");
+          break;
+        // Статистика OpenGL по кадрам
+        case GLFW_KEY_F5:
+          if (action == GLFW_PRESS) toggleGLStats();
           break;
       }
     }
@@ -125,6 +250,9 @@ int main(int argc, char **argv) {
 
   std::cout << "Main loop..." << std::endl;
 
+  // Шаги в своем потоке, окно рисует их снимки
+  scene.setThreaded(true);
+
 #ifdef EMSCRIPTEN
   emscripten_set_main_loop_arg(loop, &scene, 0, 1);
 #else
@@ -132,6 +260,25 @@ int main(int argc, char **argv) {
 #endif
 
   std::cout << "Closing..." << std::endl;
+  scene.setThreaded(false);
+  // Ровность кадров: среднее время, разброс и худший кадр
+  auto &ft = scene.getFrameTimes();
+  if (ft.count) {
+    auto mean = ft.sum / ft.count;
+    auto jitter = std::sqrt(std::max(ft.squares / ft.count - mean * mean, 0.));
+    std::cout << "Frames: " << ft.count << ", frame time: " << mean * 1000.
+              << " ms, jitter: " << jitter * 1000.
+              << " ms, worst: " << ft.worst * 1000. << " ms" << std::endl;
+  }
+  // Задержка от ввода до кадра
+  auto &lt = scene.getLatency();
+  if (lt.count) {
+    std::cout << "Input latency: " << lt.sum / lt.count * 1000.
+              << " ms, worst: " << lt.worst * 1000. << " ms" << std::endl;
+  }
+#ifndef EMSCRIPTEN
+  if (recorder) recorder->save(argv[2], scene.getTicks());
+#endif
   glfwDestroyWindow(window);
   glfwTerminate();
 
@@ -0,0 +1,30 @@
+/**
+ * @file memory.cpp
+ * @author Alex Light (dev@3107.ru)
+ * @brief Реализация счетчиков выделений памяти
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#include "memory.h"
+
+#include <atomic>
+
+namespace Memory {
+
+namespace {
+// Порядок не нужен, счетчики читаются после окончания замеряемой работы
+std::atomic<uint64_t> allocations{0};
+std::atomic<uint64_t> bytes{0};
+}  // namespace
+
+void add(size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+Counters counters() {
+  return Counters{allocations.load(std::memory_order_relaxed),
+                  bytes.load(std::memory_order_relaxed)};
+}
+
+}  // namespace Memory
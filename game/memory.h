@@ -0,0 +1,50 @@
+/**
+ * @file memory.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Счетчики выделений памяти
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Счетчики увеличивает подмененный глобальный operator new из allochook.cpp,
+ * его собирают только в программы для замеров. В игре счетчики остаются 0.
+ * Счетчики общие для всех потоков, так что выделения в участках
+ * параллельных циклов на потоках пула тоже учитываются.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Memory {
+
+/**
+ * @brief счетчики выделений памяти
+ *
+ */
+struct Counters {
+  /**
+   * @brief количество выделений
+   *
+   */
+  uint64_t allocations;
+  /**
+   * @brief выделено байт
+   *
+   */
+  uint64_t bytes;
+};
+
+/**
+ * @brief Учитывает выделение, вызывает подмененный operator new
+ *
+ * @param bytes размер
+ */
+void add(size_t bytes);
+/**
+ * @brief Счетчики всех потоков с начала программы
+ *
+ * @return Counters
+ */
+Counters counters();
+
+}  // namespace Memory
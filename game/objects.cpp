@@ -7,177 +7,373 @@
  */
 #include "objects.h"
 
-/**
- * @brief Программа для вертексов полигона
- * 
- */
-static const char *vscode = R"(
-      attribute vec2 pos;
-      void main() {
-        gl_Position = vec4(pos, 0.0, 1.0);
-      }
-    )";
+#include "jobs.h"
 
-/**
- * @brief Программа для фрагментов полигона
- * 
- */
-static const char *fscode = R"(
-      precision mediump float;
-      uniform vec4 color;
-      void main() {
-        gl_FragColor = color;
-      }
-    )";
-
-Objects::Program::Program() {
-  auto vs = glCreateShader(GL_VERTEX_SHADER);
-  glShaderSource(vs, 1, &vscode, NULL);
-  glCompileShader(vs);
-  auto fs = glCreateShader(GL_FRAGMENT_SHADER);
-  glShaderSource(fs, 1, &fscode, NULL);
-  glCompileShader(fs);
-  id = glCreateProgram();
-  glAttachShader(id, vs);
-  glAttachShader(id, fs);
-  glLinkProgram(id);
-  glDetachShader(id, vs);
-  glDetachShader(id, fs);
-  glDeleteShader(vs);
-  glDeleteShader(fs);
-  pos = glGetAttribLocation(id, "pos");
-  color = glGetUniformLocation(id, "color");
-}
-
-Objects::Program::~Program() { glDeleteProgram(id); }
-
-Objects::Program &Objects::Program::get() {
-  static Program prog;
-  return prog;
-}
-
-Objects::Objects(const Color &color) : prog(Program::get()), color(color) {
-  glGenVertexArrays(1, &vao);
-  glBindVertexArray(vao);
-  glGenBuffers(1, &vbo);
-  glBindBuffer(GL_ARRAY_BUFFER, vbo);
-  glVertexAttribPointer(prog.pos, AXES, GL_FLOAT, GL_FALSE, 0, 0);
-  glEnableVertexAttribArray(prog.pos);
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
-  glBindVertexArray(0);
-}
-
-Objects::~Objects() {
-  glDeleteBuffers(1, &vbo);
-  glDeleteVertexArrays(1, &vao);
-}
+Objects::Objects(const Color &color, VertexFormat format)
+    : color(color), format(format) {}
 
 void Objects::setColor(const Color &clr) { color = clr; }
 
-ObjectPtr Objects::inside(const Point &pt) const {
-  for (auto o : objects) {
-    if (g::ptInPoligon(o->points, pt)) return o;
-  }
-  return nullptr;
+const Color &Objects::getColor() const { return color; }
+
+unsigned Objects::getVersion() const { return version; }
+
+VertexFormat Objects::getFormat() const { return format; }
+
+size_t Objects::getBytes() const {
+  return objects.capacity() * sizeof(Object) +
+         slots.capacity() * sizeof(Slot) +
+         freeSlots.capacity() * sizeof(uint32_t) +
+         points.capacity() * sizeof(Point) +
+         shorts.capacity() * sizeof(ShortPoint) +
+         triangles.capacity() * sizeof(TriangleIndexes) +
+         (gridStart.capacity() + gridItems.capacity()) * sizeof(uint32_t);
 }
 
-ObjectPtr Objects::intersect(const std::vector<Point> &pts) const {
-  std::vector<Triangle> triangles;
-  g::triangulate2d(pts, triangles);
-  for (auto o : objects) {
-    for (auto const &t1 : o->triangles) {
-      for (auto const &t2 : triangles) {
-        if (g::intersect(t1, t2)) return o;
-      }
+const Objects::Object *Objects::find(ObjectHandle o) const {
+  if (o.index >= slots.size() || slots[o.index].generation != o.generation)
+    return nullptr;
+  return &objects[slots[o.index].index];
+}
+
+ObjectHandle Objects::handle(const Object &o) const {
+  return ObjectHandle{o.slot, slots[o.slot].generation};
+}
+
+ObjectHandle Objects::at(size_t i) const { return handle(objects[i]); }
+
+PointView Objects::getPoints(size_t i) const {
+  auto &s = objects[i].points;
+  if (format == VertexFormat::Short)
+    return PointView{nullptr, shorts.data() + s.offset, s.count};
+  return PointView{pointData() + s.offset, nullptr, s.count};
+}
+
+PointView Objects::getPoints(ObjectHandle o) const {
+  auto obj = find(o);
+  if (!obj) return PointView();
+  return getPoints(slots[o.index].index);
+}
+
+View<TriangleIndexes> Objects::getIndexes(size_t i) const {
+  auto &s = objects[i].triangles;
+  return View<TriangleIndexes>{triangleData() + s.offset, s.count};
+}
+
+ObjectHandle Objects::inside(const Point &pt) const {
+  // Треугольники уже есть, заново разбивать полигон не нужно
+  return scan(pt, pt, [&](const Object &o) {
+    auto t = triangleData() + o.triangles.offset;
+    for (auto end = t + o.triangles.count; t != end; ++t) {
+      auto tri = triangle(o, *t);
+      if (g::ptInTriangle(tri[0], tri[1], tri[2], pt)) return true;
     }
-  }
-  return nullptr;
+    return false;
+  });
+}
+
+ObjectHandle Objects::intersect(const Point &pt1, const Point &pt2) const {
+  Point lo{std::min(pt1[0], pt2[0]), std::min(pt1[1], pt2[1])};
+  Point hi{std::max(pt1[0], pt2[0]), std::max(pt1[1], pt2[1])};
+  return scan(lo, hi, [&](const Object &o) {
+    auto t = triangleData() + o.triangles.offset;
+    for (auto end = t + o.triangles.count; t != end; ++t) {
+      if (g::intersect(triangle(o, *t), pt1, pt2)) return true;
+    }
+    return false;
+  });
 }
 
-ObjectPtr Objects::intersect(const Point &pt1, const Point &pt2) const {
-  for (auto o : objects) {
-    for (auto const &t : o->triangles) {
-      if (g::intersect(t, pt1, pt2)) return o;
+ObjectHandle Objects::intersect(const Objects &other, ObjectHandle o) const {
+  auto obj = other.find(o);
+  if (!obj) return ObjectHandle();
+  auto pts = other.getPoints(o);
+  Point lo = pts[0], hi = pts[0];
+  for (size_t i = 1; i < pts.size(); i++) {
+    auto p = pts[i];
+    for (size_t j = 0; j < AXES; j++) {
+      lo[j] = std::min(lo[j], p[j]);
+      hi[j] = std::max(hi[j], p[j]);
+    }
+  }
+  auto first = other.triangleData() + obj->triangles.offset;
+  auto last = first + obj->triangles.count;
+  return scan(lo, hi, [&](const Object &o1) {
+    auto t1 = triangleData() + o1.triangles.offset;
+    for (auto end = t1 + o1.triangles.count; t1 != end; ++t1) {
+      auto tri = triangle(o1, *t1);
+      for (auto t2 = first; t2 != last; ++t2) {
+        if (g::intersect(tri, other.triangle(*obj, *t2))) return true;
+      }
     }
+    return false;
+  });
+}
+
+void Objects::set(const std::vector<std::vector<Point>> &val) {
+  clear();
+  // Разбиваем параллельно, каждый полигон пишет только в свой элемент
+  std::vector<std::vector<TriangleIndexes>> tris(val.size());
+  std::vector<char> ok(val.size());
+  Jobs::parallelFor(val.size(), 64, [&](size_t begin, size_t end) {
+    for (auto i = begin; i < end; i++)
+      ok[i] = g::triangulate2dIndexes(val[i], tris[i],
+                                      std::allocator<size_t>());
+  });
+  // Собираем по порядку, как последовательные add
+  size_t pointCount = 0, triangleCount = 0;
+  for (size_t i = 0; i < val.size(); i++) {
+    if (!ok[i]) continue;
+    pointCount += val[i].size();
+    triangleCount += tris[i].size();
+  }
+  objects.reserve(val.size());
+  if (format == VertexFormat::Short)
+    shorts.reserve(pointCount);
+  else
+    points.reserve(pointCount);
+  triangles.reserve(triangleCount);
+  for (size_t i = 0; i < val.size(); i++) {
+    if (!ok[i]) continue;
+    Object o;
+    o.slot = newSlot();
+    store(o.points, val[i]);
+    auto &t = tris[i];
+    std::copy(t.begin(), t.end(),
+              reserve(triangles, o.triangles, garbageTriangles, t.size()));
+    objects.push_back(o);
   }
-  return nullptr;
+  version++;
+  buildGrid();
 }
 
-ObjectPtr Objects::intersect(ObjectPtr o) const {
-  for (auto o1 : objects) {
-    for (auto const &t1 : o1->triangles) {
-      for (auto const &t2 : o->triangles) {
-        if (g::intersect(t1, t2)) return o1;
+void Objects::buildGrid() {
+  grid = SpatialGrid();
+  gridStart.clear();
+  gridItems.clear();
+  auto n = objects.size();
+  if (!n) return;
+  std::vector<std::pair<Point, Point>> boxes(n);
+  Jobs::parallelFor(n, 256, [&](size_t begin, size_t end) {
+    for (auto i = begin; i < end; i++) {
+      auto v = getPoints(i);
+      Point lo = v[0], hi = lo;
+      for (size_t k = 1; k < v.size(); k++) {
+        auto p = v[k];
+        for (size_t j = 0; j < AXES; j++) {
+          lo[j] = std::min(lo[j], p[j]);
+          hi[j] = std::max(hi[j], p[j]);
+        }
       }
+      boxes[i] = {lo, hi};
+    }
+  });
+  Point lo = boxes[0].first, hi = boxes[0].second;
+  for (auto const &b : boxes) {
+    for (size_t j = 0; j < AXES; j++) {
+      lo[j] = std::min(lo[j], b.first[j]);
+      hi[j] = std::max(hi[j], b.second[j]);
     }
   }
-  return nullptr;
+
+  // Примерно по объекту на ячейку
+  SpatialGrid g;
+  g.size = uint32_t(std::max(std::min(std::sqrt(double(n)), 256.), 1.));
+  g.min = lo;
+  for (size_t j = 0; j < AXES; j++) {
+    g.cell[j] = (hi[j] - lo[j]) / GLfloat(g.size);
+    if (!(g.cell[j] > 0.f)) g.cell[j] = 1.f;
+  }
+  size_t cells = size_t(g.size) * g.size;
+  auto forCells = [&](size_t i, auto f) {
+    auto &b = boxes[i];
+    for (auto y = g.cellOf(b.first[1], 1); y <= g.cellOf(b.second[1], 1); y++)
+      for (auto x = g.cellOf(b.first[0], 0); x <= g.cellOf(b.second[0], 0);
+           x++)
+        f(y * g.size + x);
+  };
+
+  // Сортировка подсчетом по участкам объектов: участок считает свои
+  // объекты в ячейках, места раздаются по ячейкам, а внутри ячейки по
+  // участкам, так номера в ячейке идут по возрастанию
+  auto ranges = std::max(std::min(Jobs::threads(), n / 1024), size_t(1));
+  auto bound = [&](size_t r) { return n * r / ranges; };
+  std::vector<uint32_t> offsets(ranges * cells);
+  Jobs::parallelFor(ranges, 1, [&](size_t begin, size_t end) {
+    for (auto r = begin; r < end; r++) {
+      auto counts = offsets.data() + r * cells;
+      for (auto i = bound(r); i < bound(r + 1); i++)
+        forCells(i, [&](size_t c) { counts[c]++; });
+    }
+  });
+  gridStart.resize(cells + 1);
+  uint32_t total = 0;
+  for (size_t c = 0; c < cells; c++) {
+    gridStart[c] = total;
+    for (size_t r = 0; r < ranges; r++) {
+      auto count = offsets[r * cells + c];
+      offsets[r * cells + c] = total;
+      total += count;
+    }
+  }
+  gridStart[cells] = total;
+  gridItems.resize(total);
+  Jobs::parallelFor(ranges, 1, [&](size_t begin, size_t end) {
+    for (auto r = begin; r < end; r++) {
+      auto next = offsets.data() + r * cells;
+      for (auto i = bound(r); i < bound(r + 1); i++)
+        forCells(i, [&](size_t c) { gridItems[next[c]++] = uint32_t(i); });
+    }
+  });
+  g.start = View<uint32_t>{gridStart.data(), gridStart.size()};
+  g.items = View<uint32_t>{gridItems.data(), gridItems.size()};
+  grid = g;
 }
 
-ObjectPtr Objects::add(const std::vector<Point> &pts) {
-  auto o = std::make_shared<Object>();
-  if (g::triangulate2d(pts, o->triangles)) {
-    o->points = pts;
+const SpatialGrid &Objects::getGrid() const { return grid; }
+
+void Objects::borrow(const ObjectsImage &img) {
+  clear();
+  objects.reserve(img.records.size());
+  for (auto const &r : img.records) {
+    Object o;
+    o.points = Span{r.points, r.pointCount, r.pointCount};
+    o.triangles = Span{r.triangles, r.triangleCount, r.triangleCount};
+    o.slot = newSlot();
     objects.push_back(o);
-    changed = true;
-    return o;
   }
-  return nullptr;
+  image = img;
+  borrowed = true;
+  if (format == VertexFormat::Short) {
+    // Сжатых точек в чужой памяти нет, сожмем себе
+    detach();
+    shorts.reserve(img.points.size());
+    for (auto const &p : img.points) shorts.push_back(g::quantize(p));
+    // Сетка строилась по несжатым точкам, сжатые отличаются меньше запаса
+    // проверки в scan
+  }
+  grid = img.grid;
+  if (!grid.size) buildGrid();
 }
 
-void Objects::set(const std::vector<std::vector<Point>> &val) {
-  clear();
-  for (auto const &v : val) add(v);
+void Objects::assign(const Objects &other) {
+  if (this == &other) return;
+  color = other.color;
+  version = other.version;
+  format = other.format;
+  objects = other.objects;
+  slots = other.slots;
+  freeSlots = other.freeSlots;
+  points = other.points;
+  shorts = other.shorts;
+  triangles = other.triangles;
+  garbagePoints = other.garbagePoints;
+  garbageTriangles = other.garbageTriangles;
+  borrowed = other.borrowed;
+  image = other.image;
+  gridStart = other.gridStart;
+  gridItems = other.gridItems;
+  grid = other.grid;
+  if (!gridStart.empty()) {  // Своя сетка ссылается на свои массивы
+    grid.start = View<uint32_t>{gridStart.data(), gridStart.size()};
+    grid.items = View<uint32_t>{gridItems.data(), gridItems.size()};
+  }
+}
+
+void Objects::detach() {
+  grid = SpatialGrid();
+  gridStart.clear();
+  gridItems.clear();
+  if (!borrowed) return;
+  borrowed = false;
+  if (format == VertexFormat::Float)
+    points.assign(image.points.begin(), image.points.end());
+  triangles.assign(image.triangles.begin(), image.triangles.end());
+  image = ObjectsImage();
 }
 
-bool Objects::update(ObjectPtr o, const std::vector<Point> &pts) {
-  std::vector<Triangle> t;
-  if (g::triangulate2d(pts, t)) {
-    o->points = pts;
-    o->triangles.swap(t);
-    changed = true;
-    return true;
+uint32_t Objects::newSlot() {
+  uint32_t slot;
+  if (freeSlots.empty()) {
+    slot = uint32_t(slots.size());
+    slots.emplace_back();
+  } else {
+    slot = freeSlots.back();
+    freeSlots.pop_back();
   }
-  return false;
+  slots[slot].index = uint32_t(objects.size());
+  return slot;
+}
+
+void Objects::release(const Object &o) {
+  garbagePoints += o.points.capacity;
+  garbageTriangles += o.triangles.capacity;
+  slots[o.slot].generation++;
+  freeSlots.push_back(o.slot);
+}
+
+void Objects::compact() {
+  auto total = format == VertexFormat::Short ? shorts.size() : points.size();
+  if (garbagePoints <= total / 2 &&
+      garbageTriangles <= triangles.size() / 2)
+    return;
+  // Переложим участки подряд в порядке объектов
+  auto pack = [&](auto &flat, auto member) {
+    std::remove_reference_t<decltype(flat)> packed;
+    packed.reserve(flat.size());
+    for (auto &o : objects) {
+      auto &s = o.*member;
+      auto first = flat.begin() + s.offset;
+      s.offset = uint32_t(packed.size());
+      s.capacity = s.count;
+      packed.insert(packed.end(), first, first + s.count);
+    }
+    flat.swap(packed);
+  };
+  if (format == VertexFormat::Short)
+    pack(shorts, &Object::points);
+  else
+    pack(points, &Object::points);
+  pack(triangles, &Object::triangles);
+  garbagePoints = garbageTriangles = 0;
 }
 
-void Objects::remove(ObjectPtr o) {
-  objects.remove(o);
-  changed = true;
+void Objects::remove(ObjectHandle o) {
+  if (!find(o)) return;
+  detach();
+  auto i = slots[o.index].index;
+  release(objects[i]);
+  // Порядок объектов сохраняем, он определяет какой объект найдется первым
+  objects.erase(objects.begin() + i);
+  for (auto j = i; j < objects.size(); j++) slots[objects[j].slot].index = j;
+  version++;
+  compact();
 }
 
 void Objects::clear() {
+  for (auto const &o : objects) release(o);
   objects.clear();
-  changed = true;
+  points.clear();
+  shorts.clear();
+  triangles.clear();
+  garbagePoints = garbageTriangles = 0;
+  borrowed = false;
+  image = ObjectsImage();
+  grid = SpatialGrid();
+  gridStart.clear();
+  gridItems.clear();
+  version++;
+}
+
+void Objects::truncate(size_t count) {
+  if (objects.size() <= count) return;
+  detach();
+  for (auto i = count; i < objects.size(); i++) release(objects[i]);
+  objects.resize(count);
+  version++;
+  compact();
 }
 
 size_t Objects::size() const { return objects.size(); }
 
 bool Objects::empty() const { return objects.empty(); }
-
-void Objects::draw() {
-  glUseProgram(prog.id);
-  glUniform4fv(prog.color, 1, color.data());
-  glBindVertexArray(vao);
-  if (changed) { // Нужно обновить буфер?
-    changed = false;
-    std::vector<GLfloat> buf;
-    for (auto o : objects) {
-      for (auto const &t : o->triangles) {
-        for (size_t i = 0; i < t.size(); i++) {
-          for (size_t j = 0; j < AXES; j++) {
-            buf.push_back(t[i][j]);
-          }
-        }
-      }
-    }
-    cnt = buf.size() / AXES;
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, buf.size() * sizeof(GLfloat), buf.data(),
-                 GL_DYNAMIC_DRAW);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-  }
-  glDrawArrays(GL_TRIANGLES, 0, cnt);
-  glBindVertexArray(0);
-  glUseProgram(0);
-}
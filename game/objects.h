@@ -8,188 +8,575 @@
 #pragma once
 
 #include "geometry.h"
+#include "platform.h"
 #include "utils.h"
 
 /**
- * @brief класс объекта полигона
+ * @brief Ссылка на объект коллекции
  *
+ * Номер ячейки и ее поколение: после удаления объекта поколение ячейки
+ * меняется, и старая ссылка перестает работать.
  */
-struct Object {
+struct ObjectHandle {
   /**
-   * @brief точки полигона
+   * @brief номер ячейки
    *
    */
-  std::vector<Point> points;
+  uint32_t index = ~0u;
+  /**
+   * @brief поколение ячейки
+   *
+   */
+  uint32_t generation = 0;
   /**
-   * @brief треугольники полигона
+   * @brief Ссылка на объект или пустая
    *
    */
-  std::vector<Triangle> triangles;
+  explicit operator bool() const { return index != ~0u; }
 };
+
 /**
- * @brief указатель на объект
+ * @brief Непрерывный участок массива только для чтения
  *
+ * @tparam T тип элементов
  */
-using ObjectPtr = std::shared_ptr<Object>;
+template <typename T>
+struct View {
+  const T *first = nullptr;
+  size_t count = 0;
+  const T *begin() const { return first; }
+  const T *end() const { return first + count; }
+  const T *data() const { return first; }
+  size_t size() const { return count; }
+  bool empty() const { return !count; }
+  const T &operator[](size_t i) const { return first[i]; }
+};
 
 /**
- * @brief класс коллекции объектов
+ * @brief Точки объекта, сжатые распаковываются при чтении
  *
  */
-class Objects {
+struct PointView {
   /**
-   * @brief ид буфера
+   * @brief точки, если они хранятся как Point
    *
    */
-  GLuint vbo;
+  const Point *floats = nullptr;
   /**
-   * @brief ид контекста
+   * @brief точки, если они хранятся сжатыми
    *
    */
-  GLuint vao;
+  const ShortPoint *shorts = nullptr;
+  size_t count = 0;
+  size_t size() const { return count; }
+  bool empty() const { return !count; }
+  Point operator[](size_t i) const {
+    return floats ? floats[i] : g::dequantize(shorts[i]);
+  }
+};
+
+/**
+ * @brief Участки объекта в общих массивах точек и треугольников
+ *
+ */
+struct ObjectRecord {
+  uint32_t points;
+  uint32_t pointCount;
+  uint32_t triangles;
+  uint32_t triangleCount;
+};
+
+/**
+ * @brief Сетка ячеек с номерами объектов, чьи границы задевают ячейку
+ *
+ * Номера в ячейке идут по возрастанию.
+ */
+struct SpatialGrid {
   /**
-   * @brief размер буфера
+   * @brief ячеек по каждой оси, 0 - сетки нет
    *
    */
-  GLsizei cnt;
+  uint32_t size = 0;
   /**
-   * @brief цвет закраски
+   * @brief левый нижний угол сетки
    *
    */
-  Color color;
+  Point min;
   /**
-   * @brief Треугольники и буфер opengl не совпадают, надо обновить
+   * @brief размер ячейки
    *
    */
-  bool changed = true;
+  Size cell;
   /**
-   * @brief класс программы отрисовки
+   * @brief начало списка каждой ячейки в items, size * size + 1 элементов
    *
    */
-  struct Program {
-    /**
-     * @brief ид программы
-     *
-     */
-    GLuint id;
-    /**
-     * @brief адрес позиции вертекса в программе
-     *
-     */
-    GLuint pos;
-    /**
-     * @brief адрес цвета в программе
-     *
-     */
-    GLuint color;
-    /**
-     * @brief Construct a new Program object
-     *
-     */
-    Program();
+  View<uint32_t> start;
+  /**
+   * @brief номера объектов
+   *
+   */
+  View<uint32_t> items;
+  /**
+   * @brief Ячейка по координате
+   *
+   * @param v координата
+   * @param axis ось
+   * @return size_t номер ячейки по оси
+   */
+  size_t cellOf(GLfloat v, size_t axis) const {
+    auto c = std::floor((v - min[axis]) / cell[axis]);
+    return size_t(std::max(std::min(c, GLfloat(size - 1)), 0.f));
+  }
+};
+
+/**
+ * @brief Готовые объекты в чужой памяти, например в файле уровня
+ *
+ */
+struct ObjectsImage {
+  View<ObjectRecord> records;
+  View<Point> points;
+  View<TriangleIndexes> triangles;
+  SpatialGrid grid;
+};
+
+/**
+ * @brief класс коллекции объектов
+ *
+ * Точки и треугольники всех объектов лежат в двух общих массивах, объект
+ * хранит только участки в них. Треугольник - это номера точек своего объекта,
+ * общие вершины не повторяются. Точки можно хранить сжатыми (VertexFormat),
+ * тогда проверки пересечений распаковывают их на лету. Массивы можно взять
+ * готовыми из чужой памяти (borrow), они копируются только при изменении.
+ * Объекты идут подряд в порядке добавления, поэтому проверки пересечений и
+ * отрисовка проходят память линейно.
+ */
+class Objects {
+  /**
+   * @brief участок общего массива
+   *
+   */
+  struct Span {
+    uint32_t offset = 0;
+    uint32_t count = 0;
     /**
-     * @brief Destroy the Program object
+     * @brief сколько места занято, при обновлении меньшим числом элементов
+     * место остается за объектом
      *
      */
-    ~Program();
+    uint32_t capacity = 0;
+  };
+  /**
+   * @brief объект полигона
+   *
+   */
+  struct Object {
+    Span points;
+    Span triangles;
     /**
-     * @brief Возвращает ссылку на синглетон программы
+     * @brief номер ячейки, которая ссылается на объект
      *
-     * @return Program&
      */
-    static Program &get();
+    uint32_t slot;
+  };
+  /**
+   * @brief ячейка ссылки: где лежит объект и поколение
+   *
+   */
+  struct Slot {
+    uint32_t index = 0;
+    uint32_t generation = 0;
   };
   /**
-   * @brief ссылка на программу отрисовки
+   * @brief цвет закраски
+   *
+   */
+  Color color;
+  /**
+   * @brief увеличивается при каждом изменении треугольников
+   *
+   */
+  unsigned version = 0;
+  /**
+   * @brief формат хранения точек
+   *
+   */
+  VertexFormat format;
+  /**
+   * @brief объекты в порядке добавления
+   *
+   */
+  std::vector<Object> objects;
+  /**
+   * @brief ячейки ссылок
+   *
+   */
+  std::vector<Slot> slots;
+  /**
+   * @brief свободные ячейки
+   *
+   */
+  std::vector<uint32_t> freeSlots;
+  /**
+   * @brief точки всех объектов
+   *
+   */
+  std::vector<Point> points;
+  /**
+   * @brief точки всех объектов в формате VertexFormat::Short
+   *
+   */
+  std::vector<ShortPoint> shorts;
+  /**
+   * @brief треугольники всех объектов, номера точек внутри объекта
+   *
+   */
+  std::vector<TriangleIndexes> triangles;
+  /**
+   * @brief сколько точек в массиве больше никому не принадлежит
+   *
+   */
+  size_t garbagePoints = 0;
+  /**
+   * @brief сколько треугольников в массиве больше никому не принадлежит
+   *
+   */
+  size_t garbageTriangles = 0;
+  /**
+   * @brief массивы взяты из чужой памяти
+   *
+   */
+  bool borrowed = false;
+  /**
+   * @brief чужие массивы
+   *
+   */
+  ObjectsImage image;
+  /**
+   * @brief сетка объектов, чужая или из gridStart и gridItems
+   *
+   * Есть только после set и borrow, любое изменение ее сбрасывает.
+   */
+  SpatialGrid grid;
+  /**
+   * @brief начала списков своей сетки
+   *
+   */
+  std::vector<uint32_t> gridStart;
+  /**
+   * @brief номера объектов своей сетки
    *
    */
-  Program &prog;
+  std::vector<uint32_t> gridItems;
 
- public:
   /**
-   * @brief список объектов
+   * @brief Точки всех объектов как Point
    *
+   * @return const Point*
    */
-  std::list<ObjectPtr> objects;
+  const Point *pointData() const {
+    return borrowed ? image.points.data() : points.data();
+  }
   /**
-   * @brief Construct a new Objects object
+   * @brief Треугольники всех объектов
    *
-   * @param color цвет объектов
+   * @return const TriangleIndexes*
+   */
+  const TriangleIndexes *triangleData() const {
+    return borrowed ? image.triangles.data() : triangles.data();
+  }
+  /**
+   * @brief Готовит к изменению: копирует чужие массивы к себе и сбрасывает
+   * сетку
+   *
+   */
+  void detach();
+  /**
+   * @brief Строит сетку по границам объектов на пуле потоков
+   *
+   */
+  void buildGrid();
+  /**
+   * @brief Ищет первый по порядку объект, для которого hit вернет true
+   *
+   * С сеткой проверяются только объекты из ячеек области.
+   *
+   * @tparam F bool(const Object &)
+   * @param lo левый нижний угол области
+   * @param hi правый верхний угол области
+   * @param hit проверка объекта
+   * @return ObjectHandle ссылка на объект или пустая
+   */
+  template <typename F>
+  ObjectHandle scan(const Point &lo, const Point &hi, F hit) const;
+
+  /**
+   * @brief Находит объект по ссылке
+   *
+   * @param o ссылка
+   * @return Object* объект или nullptr, если он удален
+   */
+  const Object *find(ObjectHandle o) const;
+  /**
+   * @brief Ссылка на объект
+   *
+   * @param o объект
+   * @return ObjectHandle
+   */
+  ObjectHandle handle(const Object &o) const;
+  /**
+   * @brief Точки треугольника объекта
+   *
+   * @param o объект
+   * @param t номера точек
+   * @return Triangle
+   */
+  Triangle triangle(const Object &o, const TriangleIndexes &t) const {
+    if (format == VertexFormat::Short) {
+      auto p = shorts.data() + o.points.offset;
+      return Triangle{g::dequantize(p[t[0]]), g::dequantize(p[t[1]]),
+                      g::dequantize(p[t[2]])};
+    }
+    auto p = pointData() + o.points.offset;
+    return Triangle{p[t[0]], p[t[1]], p[t[2]]};
+  }
+  /**
+   * @brief Выделяет место под элементы в участке общего массива, участок
+   * переезжает в конец массива, если места не хватает
+   *
+   * @param flat общий массив
+   * @param span участок
+   * @param garbage счетчик ничейных элементов массива
+   * @param count количество
+   * @return T* куда класть элементы
+   */
+  template <typename T>
+  static T *reserve(std::vector<T> &flat, Span &span, size_t &garbage,
+                    size_t count);
+  /**
+   * @brief Кладет точки объекта в общий массив в нужном формате
+   *
+   * @param span участок
+   * @param pts точки
+   */
+  template <typename C>
+  void store(Span &span, const C &pts);
+  /**
+   * @brief Занимает ячейку ссылки для объекта, который добавится в конец
+   *
+   * @return uint32_t номер ячейки
    */
-  Objects(const Color &color);
+  uint32_t newSlot();
   /**
-   * @brief Destroy the Objects object
+   * @brief Освобождает ячейку и место объекта в общих массивах
    *
+   * @param o объект
    */
-  ~Objects();
+  void release(const Object &o);
+  /**
+   * @brief Убирает из общих массивов ничейные участки, если их стало больше
+   * чем занятых
+   *
+   */
+  void compact();
+
+ public:
+  /**
+   * @brief данные отрисовщика (буферы треугольников)
+   *
+   */
+  mutable std::unique_ptr<RenderCache> cache;
+  /**
+   * @brief Construct a new Objects object
+   *
+   * @param color цвет объектов
+   * @param format формат хранения точек
+   */
+  Objects(const Color &color, VertexFormat format = VertexFormat::Float);
   /**
    * @brief Set the Color object
    *
    * @param color новый цвет объектов
    */
   void setColor(const Color &color);
+  /**
+   * @brief Цвет объектов
+   *
+   * @return const Color&
+   */
+  const Color &getColor() const;
+  /**
+   * @brief Номер изменения треугольников, отрисовщик по нему понимает что
+   * буфер надо обновить
+   *
+   * @return unsigned
+   */
+  unsigned getVersion() const;
+  /**
+   * @brief Формат хранения точек
+   *
+   * @return VertexFormat
+   */
+  VertexFormat getFormat() const;
+  /**
+   * @brief Память под объекты, точки и треугольники
+   *
+   * @return size_t байт
+   */
+  size_t getBytes() const;
+  /**
+   * @brief Ссылка на объект по номеру
+   *
+   * @param i номер объекта, меньше size()
+   * @return ObjectHandle
+   */
+  ObjectHandle at(size_t i) const;
+  /**
+   * @brief Точки объекта по номеру
+   *
+   * @param i номер объекта, меньше size()
+   * @return PointView
+   */
+  PointView getPoints(size_t i) const;
+  /**
+   * @brief Точки объекта
+   *
+   * @param o ссылка на объект
+   * @return PointView пусто, если объект удален
+   */
+  PointView getPoints(ObjectHandle o) const;
+  /**
+   * @brief Треугольники объекта по номеру как номера его точек
+   *
+   * @param i номер объекта, меньше size()
+   * @return View<TriangleIndexes>
+   */
+  View<TriangleIndexes> getIndexes(size_t i) const;
   /**
    * @brief Находит объекто с точкой внутри
    *
    * @param pt Точка для проверки
-   * @return ObjectPtr указатель на объект или nullptr
+   * @return ObjectHandle ссылка на объект или пустая
    */
-  ObjectPtr inside(const Point &pt) const;
+  ObjectHandle inside(const Point &pt) const;
   /**
    * @brief Находит объект пересекающийся с полигоном
    *
    * @param pts точки полигона
-   * @return ObjectPtr указатель на объект или nullptr
+   * @return ObjectHandle ссылка на объект или пустая
    */
-  ObjectPtr intersect(const std::vector<Point> &pts) const;
+  template <typename C>
+  ObjectHandle intersect(const C &pts) const;
   /**
    * @brief Находит объект пересекающийся с отрезком
    *
    * @param pt1 1ая точка отрезка
    * @param pt2 2ая точка отрезка
-   * @return ObjectPtr указатель на объект или nullptr
+   * @return ObjectHandle ссылка на объект или пустая
    */
-  ObjectPtr intersect(const Point &pt1, const Point &pt2) const;
+  ObjectHandle intersect(const Point &pt1, const Point &pt2) const;
   /**
-   * @brief Находит объект пересекающийся с объектом
+   * @brief Находит объект пересекающийся с объектом другой коллекции
    *
-   * @param o указатель на объект
-   * @return ObjectPtr указатель на объект или nullptr
+   * @param other коллекция объекта
+   * @param o ссылка на объект в other
+   * @return ObjectHandle ссылка на объект или пустая
    */
-  ObjectPtr intersect(ObjectPtr o) const;
+  ObjectHandle intersect(const Objects &other, ObjectHandle o) const;
   /**
    * @brief Добавляет объект в коллекцию
    *
    * @param val точки объекта
-   * @return ObjectPtr указатель на объект
+   * @return ObjectHandle ссылка на объект или пустая
+   */
+  template <typename C>
+  ObjectHandle add(const C &val);
+  /**
+   * @brief Добавляет объект, уже разбитый на треугольники
+   *
+   * Разбиение можно сделать заранее в другом потоке, коллекция меняется
+   * только здесь.
+   *
+   * @param pts точки объекта
+   * @param t треугольники как номера точек
+   * @return ObjectHandle ссылка на объект
    */
-  ObjectPtr add(const std::vector<Point> &val);
+  template <typename C, typename T>
+  ObjectHandle add(const C &pts, const T &t);
   /**
-   * @brief Устанавливает все объекты коллекции
+   * @brief Устанавливает все объекты коллекции и строит сетку
+   *
+   * Полигоны разбиваются на треугольники на пуле потоков, объекты идут в
+   * порядке val, неразбиваемые пропускаются как в add.
    *
    * @param val коллекция коллекций точек объектов
    */
   void set(const std::vector<std::vector<Point>> &val);
+  /**
+   * @brief Заменяет все объекты готовыми из чужой памяти без копирования,
+   * память должна жить пока коллекция ее использует
+   *
+   * Сжатый формат точек так не хранится, тогда точки копируются. Если
+   * сетки в img нет, она строится.
+   *
+   * @param img массивы объектов
+   */
+  void borrow(const ObjectsImage &img);
+  /**
+   * @brief Заменяет все объекты копией других, память массивов
+   * переиспользуется
+   *
+   * Номер изменения берется у источника, поэтому копии одних и тех же
+   * объектов обновляют буферы отрисовщика только после их изменения.
+   *
+   * @param other объекты
+   */
+  void assign(const Objects &other);
+  /**
+   * @brief Сетка объектов
+   *
+   * @return const SpatialGrid& сетка, size 0 если ее нет
+   */
+  const SpatialGrid &getGrid() const;
   /**
    * @brief Обновляет точки объекта
    *
-   * @param o указатель на объект
+   * @param o ссылка на объект
    * @param pts новые точки
    * @return true удалось заменить
    * @return false не удалось заменить
    */
-  bool update(ObjectPtr o, const std::vector<Point> &pts);
+  template <typename C>
+  bool update(ObjectHandle o, const C &pts);
+  /**
+   * @brief Обновляет точки объекта, уже разбитого на треугольники
+   *
+   * @param o ссылка на объект
+   * @param pts новые точки
+   * @param t треугольники как номера точек
+   * @return true удалось заменить
+   * @return false объекта нет
+   */
+  template <typename C, typename T>
+  bool update(ObjectHandle o, const C &pts, const T &t);
   /**
    * @brief Удаляет объект из коллекции
    *
-   * @param o указатель на объект
+   * @param o ссылка на объект
    */
-  void remove(ObjectPtr o);
+  void remove(ObjectHandle o);
   /**
    * @brief Удаляет все объекты
    *
    */
   void clear();
+  /**
+   * @brief Удаляет объекты начиная с заданного номера
+   *
+   * @param count сколько объектов оставить
+   */
+  void truncate(size_t count);
   /**
    * @brief Возвращает количество объектов
    *
@@ -203,9 +590,134 @@ class Objects {
    * @return false
    */
   bool empty() const;
-  /**
-   * @brief Отрисовывает объекты
-   *
-   */
-  void draw();
 };
+
+template <typename T>
+T *Objects::reserve(std::vector<T> &flat, Span &span, size_t &garbage,
+                    size_t count) {
+  if (count > span.capacity) {
+    garbage += span.capacity;
+    span.offset = uint32_t(flat.size());
+    span.capacity = uint32_t(count);
+    flat.resize(flat.size() + count);
+  }
+  span.count = uint32_t(count);
+  return flat.data() + span.offset;
+}
+
+template <typename C>
+void Objects::store(Span &span, const C &pts) {
+  if (format == VertexFormat::Short) {
+    auto dst = reserve(shorts, span, garbagePoints, pts.size());
+    for (auto const &p : pts) *dst++ = g::quantize(p);
+  } else {
+    std::copy(pts.begin(), pts.end(),
+              reserve(points, span, garbagePoints, pts.size()));
+  }
+}
+
+template <typename F>
+ObjectHandle Objects::scan(const Point &lo, const Point &hi, F hit) const {
+  if (!grid.size) {
+    for (auto const &o : objects)
+      if (hit(o)) return handle(o);
+    return ObjectHandle();
+  }
+  // Запас на погрешность проверок пересечения
+  constexpr GLfloat margin = 1e-4f;
+  auto x0 = grid.cellOf(lo[0] - margin, 0);
+  auto x1 = grid.cellOf(hi[0] + margin, 0);
+  auto y0 = grid.cellOf(lo[1] - margin, 1);
+  auto y1 = grid.cellOf(hi[1] + margin, 1);
+  // Объект может быть в нескольких ячейках, ищем наименьший номер, как при
+  // проходе по порядку
+  auto best = objects.size();
+  for (auto y = y0; y <= y1; y++) {
+    for (auto x = x0; x <= x1; x++) {
+      auto c = y * grid.size + x;
+      for (auto k = grid.start[c]; k < grid.start[c + 1]; k++) {
+        auto i = grid.items[k];
+        if (i >= best) break;
+        if (hit(objects[i])) {
+          best = i;
+          break;
+        }
+      }
+    }
+  }
+  return best < objects.size() ? handle(objects[best]) : ObjectHandle();
+}
+
+// Временные данные берутся из распределителя контейнера точек, так что при
+// точках в арене куча не используется
+
+template <typename C>
+ObjectHandle Objects::intersect(const C &pts) const {
+  std::vector<Triangle, g::Rebind<typename C::allocator_type, Triangle>>
+      other(pts.get_allocator());
+  g::triangulate2d(pts, other);
+  Point lo{0.f, 0.f}, hi{0.f, 0.f};
+  for (size_t i = 0; i < pts.size(); i++) {
+    for (size_t j = 0; j < AXES; j++) {
+      lo[j] = i ? std::min(lo[j], pts[i][j]) : pts[i][j];
+      hi[j] = i ? std::max(hi[j], pts[i][j]) : pts[i][j];
+    }
+  }
+  return scan(lo, hi, [&](const Object &o) {
+    auto t1 = triangleData() + o.triangles.offset;
+    for (auto end = t1 + o.triangles.count; t1 != end; ++t1) {
+      auto tri = triangle(o, *t1);
+      for (auto const &t2 : other) {
+        if (g::intersect(tri, t2)) return true;
+      }
+    }
+    return false;
+  });
+}
+
+template <typename C>
+ObjectHandle Objects::add(const C &pts) {
+  std::vector<TriangleIndexes,
+              g::Rebind<typename C::allocator_type, TriangleIndexes>>
+      t(pts.get_allocator());
+  if (!g::triangulate2dIndexes(pts, t, pts.get_allocator()))
+    return ObjectHandle();
+  return add(pts, t);
+}
+
+template <typename C, typename T>
+ObjectHandle Objects::add(const C &pts, const T &t) {
+  detach();
+  Object o;
+  o.slot = newSlot();
+  store(o.points, pts);
+  std::copy(t.begin(), t.end(),
+            reserve(triangles, o.triangles, garbageTriangles, t.size()));
+  objects.push_back(o);
+  version++;
+  return handle(o);
+}
+
+template <typename C>
+bool Objects::update(ObjectHandle o, const C &pts) {
+  if (!find(o)) return false;
+  std::vector<TriangleIndexes,
+              g::Rebind<typename C::allocator_type, TriangleIndexes>>
+      t(pts.get_allocator());
+  if (!g::triangulate2dIndexes(pts, t, pts.get_allocator())) return false;
+  return update(o, pts, t);
+}
+
+template <typename C, typename T>
+bool Objects::update(ObjectHandle o, const C &pts, const T &t) {
+  if (!find(o)) return false;
+  detach();
+  // Пока точек не больше чем было, объект остается на своем месте
+  auto &obj = objects[slots[o.index].index];
+  store(obj.points, pts);
+  std::copy(t.begin(), t.end(),
+            reserve(triangles, obj.triangles, garbageTriangles, t.size()));
+  version++;
+  compact();
+  return true;
+}
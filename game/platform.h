@@ -0,0 +1,232 @@
+/**
+ * @file platform.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Интерфейсы платформы: часы, ввод и отрисовка
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Логика игры работает только через эти интерфейсы, поэтому может
+ * выполняться без окна и контекста OpenGL.
+ */
+#pragma once
+
+#include "common.h"
+
+class Objects;
+
+/**
+ * @brief Данные отрисовщика, привязанные к объекту игры (буферы и т.п.)
+ *
+ * Объект владеет ими и удаляет вместе с собой.
+ */
+struct RenderCache {
+  virtual ~RenderCache() = default;
+};
+
+/**
+ * @brief Строка текста на экране
+ *
+ */
+struct Label {
+  /**
+   * @brief строка в UTF-8
+   *
+   */
+  std::string text;
+  /**
+   * @brief цвет
+   *
+   */
+  Color color;
+  /**
+   * @brief координаты
+   *
+   */
+  Point pt;
+  /**
+   * @brief высота
+   *
+   */
+  GLfloat height;
+  /**
+   * @brief увеличивается при каждом изменении строки
+   *
+   */
+  unsigned version = 0;
+  /**
+   * @brief данные отрисовщика
+   *
+   */
+  mutable std::unique_ptr<RenderCache> cache;
+  /**
+   * @brief Construct a new Label object
+   *
+   * @param color цвет
+   * @param pt координаты
+   * @param height высота
+   */
+  Label(const Color &color, const Point &pt, GLfloat height)
+      : color(color), pt(pt), height(height) {}
+  /**
+   * @brief Устанавливает строку, если она изменилась
+   *
+   * @param str строка
+   */
+  void set(const char *str) {
+    if (text.compare(str)) {
+      text = str;  // Память строки переиспользуется
+      version++;
+    }
+  }
+};
+
+/**
+ * @brief Часы игры
+ *
+ */
+class Clock {
+ public:
+  virtual ~Clock() = default;
+  /**
+   * @brief Текущее время
+   *
+   * @return double время в сек.
+   */
+  virtual double time() = 0;
+  /**
+   * @brief Ждет до заданного времени, если оно еще не наступило
+   *
+   * @param deadline время в сек.
+   */
+  virtual void wait(double) {}
+};
+
+/**
+ * @brief Часы, которые идут только когда их двигают
+ *
+ */
+class ManualClock : public Clock {
+  double now = 0.;
+
+ public:
+  double time() override { return now; }
+  /**
+   * @brief Сдвигает время
+   *
+   * @param dt сдвиг в сек.
+   */
+  void advance(double dt) { now += dt; }
+};
+
+/**
+ * @brief Источник ввода
+ *
+ * Нажатия клавиш и клики приходят в сцену сами (onKey, onClick) во время
+ * poll, состояние gamepad сцена опрашивает.
+ */
+class Input {
+ public:
+  virtual ~Input() = default;
+  /**
+   * @brief Собирает события окна с временем прихода, вызывается каждый кадр
+   *
+   */
+  virtual void collect() {}
+  /**
+   * @brief Отдает сцене события, пришедшие к началу шага
+   *
+   * @param until время начала шага в сек.
+   */
+  virtual void poll(double until) = 0;
+  /**
+   * @brief Положение стика gamepad
+   *
+   * @param axes сюда помещаем вектор
+   * @return true gamepad подключен
+   * @return false нет
+   */
+  virtual bool gamepad(Force &axes) = 0;
+  /**
+   * @brief Ждет событий, пока нечего делать
+   *
+   * @param timeout наибольшее время ожидания в сек.
+   */
+  virtual void wait(double) {}
+  /**
+   * @brief Прерывает wait из другого потока
+   *
+   */
+  virtual void wake() {}
+};
+
+/**
+ * @brief Ввод без событий
+ *
+ */
+class NullInput : public Input {
+ public:
+  void poll(double) override {}
+  bool gamepad(Force &) override { return false; }
+};
+
+/**
+ * @brief Проходы отрисовки кадра, для статистики
+ *
+ */
+enum class RenderPass { Sprites, Darkness, Figures, Text, Count };
+
+/**
+ * @brief Отрисовщик кадра
+ *
+ */
+class Renderer {
+ public:
+  virtual ~Renderer() = default;
+  /**
+   * @brief Начинает кадр
+   *
+   * @param back цвет фона
+   */
+  virtual void begin(const Color &back) = 0;
+  /**
+   * @brief Начинает проход отрисовки, предыдущий проход заканчивается
+   *
+   * @param p проход
+   */
+  virtual void pass(RenderPass) {}
+  /**
+   * @brief Задает центр вида для следующих объектов, текст не сдвигается
+   *
+   * @param center центр вида в мире
+   */
+  virtual void camera(const Point &) {}
+  /**
+   * @brief Рисует объекты
+   *
+   * @param objects объекты
+   */
+  virtual void draw(const Objects &objects) = 0;
+  /**
+   * @brief Рисует текст
+   *
+   * @param label текст
+   */
+  virtual void draw(const Label &label) = 0;
+  /**
+   * @brief Заканчивает кадр и выводит на экран
+   *
+   */
+  virtual void end() = 0;
+};
+
+/**
+ * @brief Отрисовщик, который ничего не рисует
+ *
+ */
+class NullRenderer : public Renderer {
+ public:
+  void begin(const Color &) override {}
+  void draw(const Objects &) override {}
+  void draw(const Label &) override {}
+  void end() override {}
+};
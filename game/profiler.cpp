@@ -0,0 +1,119 @@
+/**
+ * @file profiler.cpp
+ * @author Alex Light (dev@3107.ru)
+ * @brief Реализация профилировщика
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#include "profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+
+namespace Profiler {
+
+namespace {
+
+/**
+ * @brief ячейка буфера
+ *
+ * seq нечетный пока ячейка пишется, четный 2 * (номер записи + 1) когда
+ * записана, читатель сверяет его до и после копирования.
+ */
+struct Slot {
+  std::atomic<uint64_t> seq{0};
+  Sample sample;
+};
+
+std::atomic<bool> on{false};
+std::atomic<uint64_t> head{0};
+std::atomic<uint32_t> threads{0};
+Slot ring[capacity];
+const auto start = std::chrono::steady_clock::now();
+
+uint32_t threadId() {
+  static thread_local uint32_t id = threads.fetch_add(1) + 1;
+  return id;
+}
+
+}  // namespace
+
+bool enabled() { return on.load(std::memory_order_relaxed); }
+
+void enable(bool value) { on.store(value, std::memory_order_relaxed); }
+
+uint64_t now() {
+  // +1 чтобы 0 в Scope значил "выключено"
+  return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count()) +
+         1;
+}
+
+void push(const char *name, uint64_t begin, uint64_t end) {
+  auto idx = head.fetch_add(1, std::memory_order_relaxed);
+  auto &slot = ring[idx & (capacity - 1)];
+  slot.seq.store(idx * 2 + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.sample = Sample{name, begin, end, threadId()};
+  slot.seq.store(idx * 2 + 2, std::memory_order_release);
+}
+
+std::vector<Sample> samples() {
+  std::vector<Sample> res;
+  auto last = head.load(std::memory_order_acquire);
+  auto first = last > capacity ? last - capacity : 0;
+  res.reserve(size_t(last - first));
+  for (auto idx = first; idx < last; idx++) {
+    auto &slot = ring[idx & (capacity - 1)];
+    auto seq = slot.seq.load(std::memory_order_acquire);
+    if (seq != idx * 2 + 2) continue;  // Пишется или уже перезаписана
+    auto s = slot.sample;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.seq.load(std::memory_order_relaxed) == seq) res.push_back(s);
+  }
+  return res;
+}
+
+std::vector<Stat> collect(double window) {
+  auto from = now() - std::min(now(), uint64_t(window * 1e9));
+  std::vector<Stat> res;
+  size_t frames = 0;
+  for (auto const &s : samples()) {
+    if (s.end < from) continue;
+    if (!std::strcmp(s.name, "frame")) frames++;
+    auto it = std::find_if(res.begin(), res.end(), [&](const Stat &st) {
+      return !std::strcmp(st.name, s.name);
+    });
+    if (it == res.end()) it = res.insert(res.end(), Stat{s.name, 0.});
+    it->ms += double(s.end - s.begin) * 1e-6;
+  }
+  for (auto &st : res) st.ms /= double(std::max<size_t>(frames, 1));
+  std::sort(res.begin(), res.end(), [](const Stat &a, const Stat &b) {
+    return std::strcmp(a.name, b.name) < 0;
+  });
+  return res;
+}
+
+bool exportTrace(const char *file) {
+  std::ofstream fs(file);
+  fs << std::fixed << std::setprecision(3) << "{\"traceEvents\": [";
+  bool first = true;
+  for (auto const &s : samples()) {
+    fs << (first ? "\n" : ",\n") << "{\"name\": \"" << s.name
+       << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << s.thread
+       << ", \"ts\": " << double(s.begin) * 1e-3
+       << ", \"dur\": " << double(s.end - s.begin) * 1e-3 << "}";
+    first = false;
+  }
+  fs << "\n], \"displayTimeUnit\": \"ms\"}\n";
+  if (!fs) {
+    std::cout << "Error writing trace: " << file << std::endl;
+    return false;
+  }
+  std::cout << "Trace saved: " << file << std::endl;
+  return true;
+}
+
+}  // namespace Profiler
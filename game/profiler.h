@@ -0,0 +1,163 @@
+/**
+ * @file profiler.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Замер времени участков кадра
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Участок отмечается объектом Profiler::Scope (макрос PROFILE), при выходе
+ * из участка его начало и конец пишутся в кольцевой буфер без блокировок.
+ * Пока профилировщик выключен, Scope только проверяет флаг.
+ */
+#pragma once
+
+#include <atomic>
+
+#include "common.h"
+
+namespace Profiler {
+
+/**
+ * @brief замер участка
+ *
+ */
+struct Sample {
+  /**
+   * @brief имя участка, строковая константа
+   *
+   */
+  const char *name;
+  /**
+   * @brief начало в нс от старта программы
+   *
+   */
+  uint64_t begin;
+  /**
+   * @brief конец в нс от старта программы
+   *
+   */
+  uint64_t end;
+  /**
+   * @brief номер потока
+   *
+   */
+  uint32_t thread;
+};
+
+/**
+ * @brief среднее время участка за кадр
+ *
+ */
+struct Stat {
+  /**
+   * @brief имя участка
+   *
+   */
+  const char *name;
+  /**
+   * @brief время в мс
+   *
+   */
+  double ms;
+};
+
+/**
+ * @brief размер кольцевого буфера, степень 2
+ *
+ */
+constexpr size_t capacity = 1 << 15;
+
+/**
+ * @brief Включен ли профилировщик
+ *
+ * @return true
+ * @return false
+ */
+bool enabled();
+/**
+ * @brief Включает или выключает профилировщик
+ *
+ * @param on включить
+ */
+void enable(bool on);
+/**
+ * @brief Текущее время
+ *
+ * @return uint64_t нс от старта программы
+ */
+uint64_t now();
+/**
+ * @brief Пишет замер в буфер
+ *
+ * @param name имя участка
+ * @param begin начало
+ * @param end конец
+ */
+void push(const char *name, uint64_t begin, uint64_t end);
+/**
+ * @brief Копирует последние замеры из буфера
+ *
+ * Замеры, которые перезаписываются во время чтения, пропускаются.
+ *
+ * @return std::vector<Sample> замеры по порядку записи
+ */
+std::vector<Sample> samples();
+/**
+ * @brief Среднее время участков за кадр в последнем интервале
+ *
+ * Кадр - участок с именем frame, если кадров не было делим на 1.
+ *
+ * @param window интервал в сек.
+ * @return std::vector<Stat> участки по имени
+ */
+std::vector<Stat> collect(double window);
+/**
+ * @brief Сохраняет замеры в формате Chrome trace (chrome://tracing, Perfetto)
+ *
+ * @param file имя файла
+ * @return true сохранили
+ * @return false ошибка
+ */
+bool exportTrace(const char *file);
+
+/**
+ * @brief Замер участка от создания до удаления объекта
+ *
+ */
+class Scope {
+  /**
+   * @brief имя участка
+   *
+   */
+  const char *name;
+  /**
+   * @brief начало, 0 если профилировщик был выключен
+   *
+   */
+  uint64_t begin;
+
+ public:
+  /**
+   * @brief Construct a new Scope object
+   *
+   * @param name имя участка, строковая константа
+   */
+  explicit Scope(const char *name)
+      : name(name), begin(enabled() ? now() : 0) {}
+  ~Scope() {
+    if (begin) push(name, begin, now());
+  }
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+};
+
+}  // namespace Profiler
+
+#define PROFILE_CONCAT2(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT2(a, b)
+/**
+ * @brief Замер участка до конца блока
+ *
+ */
+#define PROFILE(name) \
+  Profiler::Scope PROFILE_CONCAT(profileScope, __LINE__)(name)
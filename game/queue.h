@@ -0,0 +1,149 @@
+/**
+ * @file queue.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Передача данных между двумя потоками без блокировок
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Кольцевая очередь постоянного размера
+ *
+ * Писатель двигает только хвост, читатель только голову, поэтому хватает
+ * атомарных индексов без блокировок. Память выделена сразу, полная очередь
+ * новые элементы не принимает.
+ *
+ * @tparam T элемент
+ * @tparam N размер, степень двойки
+ */
+template <typename T, size_t N>
+class RingQueue {
+  static_assert(N && !(N & (N - 1)), "size must be a power of two");
+  /**
+   * @brief элементы
+   *
+   */
+  std::array<T, N> items;
+  /**
+   * @brief номер следующего элемента для чтения
+   *
+   */
+  std::atomic<size_t> head{0};
+  /**
+   * @brief номер следующего элемента для записи
+   *
+   */
+  std::atomic<size_t> tail{0};
+
+ public:
+  /**
+   * @brief Добавляет элемент, вызывает писатель
+   *
+   * @param item элемент
+   * @return true
+   * @return false очередь полна
+   */
+  bool push(const T &item) {
+    auto t = tail.load(std::memory_order_relaxed);
+    if (t - head.load(std::memory_order_acquire) == N) return false;
+    items[t & (N - 1)] = item;
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+  /**
+   * @brief Первый элемент, вызывает читатель
+   *
+   * @return const T* элемент или nullptr, если очередь пуста
+   */
+  const T *front() const {
+    auto h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire)) return nullptr;
+    return &items[h & (N - 1)];
+  }
+  /**
+   * @brief Удаляет первый элемент, вызывает читатель после front
+   *
+   */
+  void pop() {
+    head.store(head.load(std::memory_order_relaxed) + 1,
+               std::memory_order_release);
+  }
+};
+
+/**
+ * @brief Тройной буфер: писатель публикует значения, читатель берет
+ * последнее
+ *
+ * Буфер писателя, буфер читателя и опубликованный меняются местами
+ * атомарным обменом, так что потоки не ждут друг друга. Если читатель не
+ * успел взять опубликованное значение, следующая публикация его заменяет.
+ *
+ * @tparam T значение
+ */
+template <typename T>
+class TripleBuffer {
+  /**
+   * @brief признак того, что опубликованное значение еще не прочитано
+   *
+   */
+  static constexpr unsigned fresh = 4;
+  std::array<T, 3> items;
+  /**
+   * @brief номер опубликованного буфера и признак fresh
+   *
+   */
+  std::atomic<unsigned> middle{1};
+  /**
+   * @brief буфер писателя
+   *
+   */
+  unsigned back = 0;
+  /**
+   * @brief буфер читателя
+   *
+   */
+  unsigned front = 2;
+
+ public:
+  /**
+   * @brief Буфер писателя, в нем остается значение одной из прошлых
+   * публикаций
+   *
+   * @return T&
+   */
+  T &write() { return items[back]; }
+  /**
+   * @brief Публикует буфер писателя, писатель получает другой
+   *
+   * @return true прошлое опубликованное значение не прочитано, теперь это
+   * буфер писателя
+   * @return false
+   */
+  bool publish() {
+    auto m = middle.exchange(back | fresh, std::memory_order_acq_rel);
+    back = m & 3;
+    return m & fresh;
+  }
+  /**
+   * @brief Берет последнее опубликованное значение, если оно новое
+   *
+   * @return true значение новое
+   * @return false нового нет, read() остался прежним
+   */
+  bool acquire() {
+    if (!(middle.load(std::memory_order_relaxed) & fresh)) return false;
+    front = middle.exchange(front, std::memory_order_acq_rel) & 3;
+    return true;
+  }
+  /**
+   * @brief Буфер читателя
+   *
+   * @return const T&
+   */
+  const T &read() const { return items[front]; }
+};
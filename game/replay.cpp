@@ -0,0 +1,158 @@
+/**
+ * @file replay.cpp
+ * @author Alex Light (dev@3107.ru)
+ * @brief Реализация записи и повтора ввода
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#include "replay.h"
+
+Recorder::Recorder(uint32_t seed, uint64_t config)
+    : header{Replay::magic, Replay::version, seed, 0, config} {}
+
+void Recorder::event(uint32_t tick, Replay::Type type) {
+  // Шаг пишем разницей с предыдущим событием, обычно это 1 байт
+  auto delta = tick - last;
+  last = tick;
+  do {
+    uint8_t b = delta & 0x7F;
+    delta >>= 7;
+    data.push_back(delta ? b | 0x80 : b);
+  } while (delta);
+  data.push_back(type);
+}
+
+void Recorder::point(const Point &pt) {
+  auto p = reinterpret_cast<const uint8_t *>(pt.data());
+  data.insert(data.end(), p, p + sizeof(Point));
+}
+
+void Recorder::key(uint32_t tick, Scene::Keys key, bool down) {
+  event(tick, Replay::Key);
+  data.push_back(uint8_t(unsigned(key) * 2 + down));
+}
+
+void Recorder::click(uint32_t tick, const Point &pt) {
+  event(tick, Replay::Click);
+  point(pt);
+}
+
+void Recorder::gamepad(uint32_t tick, bool on, const Force &v) {
+  if (on == connected && (!on || v == axes)) return;
+  connected = on;
+  if (on) {
+    axes = v;
+    event(tick, Replay::Gamepad);
+    point(v);
+  } else {
+    event(tick, Replay::NoGamepad);
+  }
+}
+
+bool Recorder::save(const char *file, uint32_t ticks) {
+  header.ticks = ticks;
+  std::ofstream fs(file, std::ios::binary);
+  fs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  fs.write(reinterpret_cast<const char *>(data.data()), data.size());
+  if (!fs) {
+    std::cout << "Error writing replay: " << file << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool ReplayInput::load(const char *file) {
+  auto buf = readFile(file);
+  if (buf.size() < sizeof(header)) {
+    std::cout << "Error reading replay: " << file << std::endl;
+    return false;
+  }
+  std::memcpy(&header, buf.data(), sizeof(header));
+  if (header.magic != Replay::magic || header.version != Replay::version) {
+    std::cout << "Wrong replay format: " << file << std::endl;
+    return false;
+  }
+  auto p = reinterpret_cast<const uint8_t *>(buf.data()) + sizeof(header);
+  auto end = reinterpret_cast<const uint8_t *>(buf.data()) + buf.size();
+  auto point = [&](Point &pt) {
+    if (end - p < ptrdiff_t(sizeof(Point))) return false;
+    std::memcpy(pt.data(), p, sizeof(Point));
+    p += sizeof(Point);
+    return true;
+  };
+  uint32_t tick = 0;
+  events.clear();
+  while (p < end) {
+    uint32_t delta = 0;
+    unsigned shift = 0;
+    for (; p < end && shift < 32; shift += 7) {
+      delta |= uint32_t(*p & 0x7F) << shift;
+      if (!(*p++ & 0x80)) break;
+    }
+    // Разница шагов длиннее 32 бит бывает только в испорченном файле
+    if (shift >= 32) {
+      std::cout << "Replay is broken: " << file << std::endl;
+      return false;
+    }
+    if (p >= end) break;
+    Replay::Event e{};
+    e.tick = tick += delta;
+    e.type = Replay::Type(*p++);
+    bool ok = true;
+    switch (e.type) {
+      case Replay::Key:
+        if ((ok = p < end)) {
+          e.key = Scene::Keys(*p / 2);
+          e.down = *p++ & 1;
+        }
+        break;
+      case Replay::Click:
+      case Replay::Gamepad:
+        ok = point(e.pt);
+        break;
+      case Replay::NoGamepad:
+        break;
+      default:
+        ok = false;
+    }
+    if (!ok) break;
+    events.push_back(e);
+  }
+  if (p != end) {
+    std::cout << "Replay is broken: " << file << std::endl;
+    return false;
+  }
+  next = 0;
+  return true;
+}
+
+const Replay::Header &ReplayInput::getHeader() const { return header; }
+
+void ReplayInput::bind(Scene *s) { scene = s; }
+
+void ReplayInput::poll(double) {
+  auto tick = scene->getTicks();
+  for (; next < events.size() && events[next].tick <= tick; next++) {
+    auto &e = events[next];
+    switch (e.type) {
+      case Replay::Key:
+        scene->onKey(e.key, e.down);
+        break;
+      case Replay::Click:
+        scene->onClick(e.pt);
+        break;
+      case Replay::Gamepad:
+        connected = true;
+        axes = e.pt;
+        break;
+      case Replay::NoGamepad:
+        connected = false;
+        break;
+    }
+  }
+}
+
+bool ReplayInput::gamepad(Force &v) {
+  if (connected) v = axes;
+  return connected;
+}
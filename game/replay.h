@@ -0,0 +1,273 @@
+/**
+ * @file replay.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Запись ввода игры и повтор без окна
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Сцена детерминирована: случайные числа идут от начального значения, а время
+ * считается по номеру шага. Поэтому для повтора достаточно записать начальное
+ * значение, хеш конфигурации и события ввода с номером шага.
+ *
+ * Файл: заголовок Replay::Header, затем события. Событие: номер шага от
+ * предыдущего события (LEB128), байт типа и данные. Числа пишутся как есть,
+ * повторять запись нужно на той же платформе.
+ */
+#pragma once
+
+#include "scene.h"
+
+namespace Replay {
+
+/**
+ * @brief сигнатура файла
+ *
+ */
+constexpr uint32_t magic = 0x50455247;  // "GREP"
+/**
+ * @brief версия формата
+ *
+ */
+constexpr uint32_t version = 1;
+
+/**
+ * @brief заголовок файла
+ *
+ */
+struct Header {
+  /**
+   * @brief сигнатура
+   *
+   */
+  uint32_t magic;
+  /**
+   * @brief версия формата
+   *
+   */
+  uint32_t version;
+  /**
+   * @brief начальное значение генератора случайных чисел сцены
+   *
+   */
+  uint32_t seed;
+  /**
+   * @brief количество шагов записи
+   *
+   */
+  uint32_t ticks;
+  /**
+   * @brief хеш конфигурации
+   *
+   */
+  uint64_t config;
+};
+
+/**
+ * @brief тип события
+ *
+ */
+enum Type : uint8_t {
+  /**
+   * @brief клавиша, данные: байт клавиша * 2 + нажата
+   *
+   */
+  Key = 0,
+  /**
+   * @brief клик, данные: точка
+   *
+   */
+  Click = 1,
+  /**
+   * @brief gamepad подключен или сдвинут стик, данные: вектор
+   *
+   */
+  Gamepad = 2,
+  /**
+   * @brief gamepad отключен
+   *
+   */
+  NoGamepad = 3
+};
+
+/**
+ * @brief событие ввода
+ *
+ */
+struct Event {
+  /**
+   * @brief номер шага
+   *
+   */
+  uint32_t tick;
+  /**
+   * @brief тип
+   *
+   */
+  Type type;
+  /**
+   * @brief клавиша
+   *
+   */
+  Scene::Keys key;
+  /**
+   * @brief нажата
+   *
+   */
+  bool down;
+  /**
+   * @brief точка клика или вектор gamepad
+   *
+   */
+  Point pt;
+};
+
+}  // namespace Replay
+
+/**
+ * @brief Запись ввода сцены
+ *
+ */
+class Recorder {
+  /**
+   * @brief заголовок
+   *
+   */
+  Replay::Header header;
+  /**
+   * @brief события
+   *
+   */
+  std::vector<uint8_t> data;
+  /**
+   * @brief шаг последнего события
+   *
+   */
+  uint32_t last = 0;
+  /**
+   * @brief gamepad был подключен
+   *
+   */
+  bool connected = false;
+  /**
+   * @brief последний записанный вектор gamepad
+   *
+   */
+  Force axes = {0.f, 0.f};
+
+  /**
+   * @brief Пишет номер шага и тип события
+   *
+   * @param tick номер шага
+   * @param type тип
+   */
+  void event(uint32_t tick, Replay::Type type);
+  /**
+   * @brief Пишет точку
+   *
+   * @param pt точка
+   */
+  void point(const Point &pt);
+
+ public:
+  /**
+   * @brief Construct a new Recorder object
+   *
+   * @param seed начальное значение генератора случайных чисел сцены
+   * @param config хеш конфигурации
+   */
+  Recorder(uint32_t seed, uint64_t config);
+  /**
+   * @brief Записывает клавишу
+   *
+   * @param tick номер шага
+   * @param key клавиша
+   * @param down нажата
+   */
+  void key(uint32_t tick, Scene::Keys key, bool down);
+  /**
+   * @brief Записывает клик
+   *
+   * @param tick номер шага
+   * @param pt точка в координатах игры
+   */
+  void click(uint32_t tick, const Point &pt);
+  /**
+   * @brief Записывает состояние gamepad, если оно изменилось
+   *
+   * @param tick номер шага
+   * @param on подключен
+   * @param v вектор стика
+   */
+  void gamepad(uint32_t tick, bool on, const Force &v);
+  /**
+   * @brief Сохраняет запись в файл
+   *
+   * @param file имя файла
+   * @param ticks количество шагов
+   * @return true сохранили
+   * @return false ошибка
+   */
+  bool save(const char *file, uint32_t ticks);
+};
+
+/**
+ * @brief Ввод из записи
+ *
+ * На каждом шаге отдает сцене события записанные на этом шаге.
+ */
+class ReplayInput : public Input {
+  /**
+   * @brief заголовок
+   *
+   */
+  Replay::Header header{};
+  /**
+   * @brief события
+   *
+   */
+  std::vector<Replay::Event> events;
+  /**
+   * @brief следующее событие
+   *
+   */
+  size_t next = 0;
+  /**
+   * @brief gamepad подключен
+   *
+   */
+  bool connected = false;
+  /**
+   * @brief вектор gamepad
+   *
+   */
+  Force axes = {0.f, 0.f};
+  /**
+   * @brief сцена, которой отдаем события
+   *
+   */
+  Scene *scene = nullptr;
+
+ public:
+  /**
+   * @brief Загружает запись
+   *
+   * @param file имя файла
+   * @return true загрузили
+   * @return false ошибка
+   */
+  bool load(const char *file);
+  /**
+   * @brief Заголовок записи
+   *
+   * @return const Replay::Header&
+   */
+  const Replay::Header &getHeader() const;
+  /**
+   * @brief Задает сцену, которой отдаем события
+   *
+   * @param s сцена
+   */
+  void bind(Scene *s);
+  void poll(double) override;
+  bool gamepad(Force &v) override;
+};
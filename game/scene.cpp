@@ -7,19 +7,109 @@
  */
 #include "scene.h"
 
-Scene::Scene(GLFWwindow *window, const std::vector<std::vector<Point>> &cfg)
-    : rnd(gameSize),
-      window(window),
-      figures(figureColor),
-      darkness(darknessColor) {
-  // Нужен блендинг так как текстуры для текста с альфой
-  glEnable(GL_BLEND);
-  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-  // Загрузим прпятствия
-  figures.set(cfg);
+#include <chrono>
+
+#include "jobs.h"
+#include "level.h"
+#include "memory.h"
+#include "profiler.h"
+#include "replay.h"
+
+namespace {
+
+/**
+ * @brief больше точек у невидимого полигона не бывает: концы стороны, два
+ * пересечения лучей с границей вида и до трех углов между ними
+ *
+ */
+constexpr size_t shadowPoints = 8;
+
+/**
+ * @brief невидимый полигон стороны препятствия, уже разбитый на треугольники
+ *
+ */
+struct Shadow {
+  /**
+   * @brief количество точек, 0 - полигона нет
+   *
+   */
+  size_t count;
+  size_t triangles;
+  std::array<Point, shadowPoints> pts;
+  std::array<TriangleIndexes, shadowPoints - 2> tris;
+};
+
+}  // namespace
+
+Scene::Scene(Clock &clock, Input &input, Renderer &renderer,
+             const Config &cfg, unsigned seed)
+    : rnd(gameSize, seed),
+      clock(clock),
+      input(input),
+      renderer(renderer),
+      cfg(cfg),
+      figures(cfg, figureColor, levelVertexFormat),
+      darkness(darknessColor),
+      scoreText(scoreColor, scorePosition, scoreHeight),
+      gamerShape(gamerColor),
+      prizeShape(prizeColor),
+      zombyShape(zombyActiveColor) {
+  // Загрузим прпятствия вокруг стартовой точки
+  camera = figures.follow(camera);
+  figures.stream(camera);
+  // Спрайты рисуются сдвигом одной фигуры
+  gamerShape.add(g::points(Circle{{0.f, 0.f}, gamerRadius}));
+  prizeShape.add(g::points(Rect{{0.f, 0.f}, prizeSize}));
+  zombyShape.add(g::points(Rect{{0.f, 0.f}, zombySize}));
+  // Первый снимок до шагов
+  publish();
+  acquire();
+}
+
+Scene::~Scene() { setThreaded(false); }
+
+const char *Scene::phaseName(Phase phase) {
+  static const char *names[] = {"input", "gamer", "prize", "zombies", "draw"};
+  return names[size_t(phase)];
+}
+
+template <typename F>
+void Scene::measure(Phase phase, F f) {
+  PROFILE(phaseName(phase));
+  if (!phaseStats) return f();
+  using steady = std::chrono::steady_clock;
+  auto mem = Memory::counters();
+  auto start = steady::now();
+  f();
+  auto &st = (*phaseStats)[size_t(phase)];
+  st.seconds += std::chrono::duration<double>(steady::now() - start).count();
+  st.allocations += Memory::counters().allocations - mem.allocations;
+  st.bytes += Memory::counters().bytes - mem.bytes;
+}
+
+template <typename F>
+void Scene::parallelFor(size_t count, size_t grain, F f) {
+  // Участок может выполнять любой поток пула и поток, ждущий свой цикл
+  auto n = Jobs::threads() + 1;
+  if (localCount < n) {
+    locals.reset(new LocalArena[n]);
+    localCount = n;
+  }
+  Jobs::parallelFor(count, grain, [&](size_t begin, size_t end) {
+    // Берем свободную память, участков одновременно не больше потоков
+    size_t i = 0;
+    while (locals[i].busy.exchange(true, std::memory_order_acquire))
+      if (++i == localCount) {
+        i = 0;
+        std::this_thread::yield();
+      }
+    f(begin, end, locals[i].arena);
+    locals[i].busy.store(false, std::memory_order_release);
+  });
 }
 
 void Scene::onKey(Keys key, bool down) {
+  if (recorder) recorder->key(ticks, key, down);
   if (!gamer) return;
   // Зададим вектор скорости движения игрока
   auto &f = gamer->force;
@@ -39,58 +129,257 @@ void Scene::onKey(Keys key, bool down) {
   }
 }
 
-void Scene::onClick(double mx, double my) {
-  GLint vp[4];
-  glGetIntegerv(GL_VIEWPORT, vp);
-  GLfloat x = GLfloat(mx - vp[0]) / (vp[2] - vp[0]) * 2.f - 1.f;
-  GLfloat y = GLfloat(vp[3] - my) / (vp[3] - vp[1]) * 2.f - 1.f;
-  std::cout << "click: " << x << "," << y << std::endl;
-  updateDarkness({x, y});  // Так сделано в примере
+void Scene::onClick(const Point &pt) {
+  if (recorder) recorder->click(ticks, pt);
+  std::cout << "click: " << pt[0] << "," << pt[1] << std::endl;
+  updateDarkness(pt + camera);  // Так сделано в примере
+}
+
+void Scene::onInput(double time) {
+  if (inputTime < 0.) inputTime = time;
 }
 
+void Scene::invalidate() { damaged = true; }
+
 void Scene::processGamepad() {
   if (!gamer) return;
-  int count;
-  auto axes = glfwGetJoystickAxes(GLFW_JOYSTICK_1, &count);
-  if (axes && count > 1) {
+  Force axes{};
+  auto on = input.gamepad(axes);
+  if (recorder) recorder->gamepad(ticks, on, axes);
+  if (on) {
     // Зададим вектор скорости движения игрока
-    auto &f = gamer->force;
-    f[0] = axes[0];
-    f[1] = -axes[1];
+    gamer->force = axes;
   }
 }
 
 void Scene::loop() {
-  // Обработаем действия
-  process();
+  bool idle;
+  double next;
+  {
+    PROFILE("frame");
+    // События окна в очередь, шаги заберут их по времени
+    input.collect();
+    auto time = clock.time();
+    if (frames) frameTimes.add(time - frameTime);
+    frameTime = time;
+    // Без своего потока шаги идут здесь
+    if (!worker.joinable()) process();
+    acquire();
+    auto &s = snapshots.read();
+    // Следующий шаг и доля шага, прошедшая после снимка
+    next = s.time + processDelay;
+    blend = GLfloat(std::max(
+        std::min((clock.time() - s.time) / processDelay, 1.), 0.));
+    // Нарисуем, если кадр отличается от прошлого
+    idle = !damaged && !s.changed && s.score == shownScore &&
+           s.bestScore == shownBestScore && !Profiler::enabled();
+    if (!idle) {
+      damaged = false;
+      render();
+      // Ввод шага на экране
+      if (s.inputTime >= 0. && s.tick != latencyTick) {
+        latencyTick = s.tick;
+        latency.add(clock.time() - s.inputTime);
+      }
+    }
 
-  // Очистим фон
-  glClearColor(backColor[0], backColor[1], backColor[2], backColor[3]);
-  glClear(GL_COLOR_BUFFER_BIT);
+    // Время от старта до первого кадра
+    if (!frames++) {
+      std::cout << "First frame: " << clock.time() * 1000. << " ms"
+                << std::endl;
+    }
+  }
+  if (idle) {
+    // Ничего не меняется, ждем событий до следующего шага. Поток шагов сам
+    // разбудит, если снимок изменится
+    input.wait(worker.joinable() ? processDelay : next - clock.time());
+  } else {
+    // Если vsync не ограничил частоту, не рисуем чаще frameDelay
+    clock.wait(frameTime + frameDelay);
+  }
+}
 
-  // Нарисуем все
-  for (auto z : zombies) z->draw();  // Зобмби под темнотой
-  darkness.draw();
-  figures.draw();
-  if (prize) prize->draw();
-  if (gamer) gamer->draw();
+void Scene::setThreaded(bool on) {
+#ifndef EMSCRIPTEN  // В браузере потоков нет
+  if (on == worker.joinable()) return;
+  if (on) {
+    // Загружаемые куски меняет поток шагов, отрисовке нужны свои
+    if (figures.streamed() && !scenery) {
+      scenery = std::make_unique<World>(cfg, figureColor, levelVertexFormat);
+      scenery->stream(snapshots.read().camera);
+    }
+    running = true;
+    worker = std::thread([this] { simulate(); });
+  } else {
+    running = false;
+    worker.join();
+  }
+#endif
+}
 
-  // Выведем текст
-  std::stringstream ss;
-  ss << "Score: " << score << ", BestScore: " << bestScore;
-  text.draw(ss.str(), scoreColor, scorePosition, scoreHeight);
+void Scene::simulate() {
+  while (running) {
+    process();
+    // До следующего шага
+    clock.wait(lastTime - lag + processDelay);
+  }
+}
+
+void Scene::publish() {
+  auto &s = snapshots.write();
+  // Неполученный снимок заменяется этим, его изменения и ввод не теряем
+  auto carried = dropped && s.changed;
+  if (dropped && s.inputTime >= 0. &&
+      (inputTime < 0. || s.inputTime < inputTime))
+    inputTime = s.inputTime;
+  s.inputTime = inputTime;
+  inputTime = -1.;
+  s.tick = ticks;
+  // Шаги без process (headless) идут без расписания
+  s.time = tickTime < HUGE_VAL ? tickTime : clock.time();
+  s.lastCamera = lastCamera;
+  s.camera = camera;
+  auto state = [](const auto &sprite) {
+    return SpriteState{sprite.from, sprite.sprite.first, sprite.getColor()};
+  };
+  s.hasGamer = !!gamer;
+  if (gamer) s.gamer = state(*gamer);
+  s.hasPrize = !!prize;
+  if (prize) s.prize = state(*prize);
+  s.zombies.clear();
+  for (auto const &z : zombies) s.zombies.push_back(state(*z));
+  // Темнота копируется, только если изменилась
+  if (s.darkness.getVersion() != darkness.getVersion())
+    s.darkness.assign(darkness);
+  s.score = score;
+  s.bestScore = bestScore;
+  s.changed = changed || carried;
+  dropped = snapshots.publish();
+  // worker принадлежит потоку отрисовки, здесь только атомарный флаг
+  if (s.changed && running) input.wake();
+}
+
+void Scene::acquire() {
+  // Кадры прошлого снимка рисовались между позициями, последний кадр не
+  // совпадает с новыми позициями, его нарисуем хотя бы раз
+  auto was = snapshots.read().changed;
+  if (!snapshots.acquire()) return;
+  auto &s = snapshots.read();
+  if (was || s.changed) damaged = true;
+  // Свои куски мира для отрисовки идут за снимком
+  if (scenery) scenery->stream(s.camera);
+}
+
+void Scene::drawSprite(Objects &shape, const SpriteState &s,
+                       const Point &view) {
+  // Вершины не трогаем, сдвигаем вид на позицию между шагами
+  shape.setColor(s.color);
+  renderer.camera(view - (s.from + (s.to - s.from) * blend));
+  renderer.draw(shape);
+}
 
-  // На экран
-  glfwSwapBuffers(window);
+void Scene::draw() {
+  acquire();
+  render();
 }
 
+void Scene::render() {
+  measure(Phase::Draw, [&] {
+    auto &s = snapshots.read();
+    // Очистим фон
+    renderer.begin(backColor);
+    // Вид между прошлым и текущим шагом
+    auto view = s.lastCamera + (s.camera - s.lastCamera) * blend;
+
+    // Нарисуем все
+    {
+      PROFILE("draw zombies");
+      renderer.pass(RenderPass::Sprites);
+      for (auto const &z : s.zombies)
+        drawSprite(zombyShape, z, view);  // Зобмби под темнотой
+    }
+    {
+      PROFILE("draw darkness");
+      renderer.pass(RenderPass::Darkness);
+      renderer.camera(view);
+      renderer.draw(s.darkness);
+    }
+    {
+      PROFILE("draw figures");
+      renderer.pass(RenderPass::Figures);
+      // Только куски в виде
+      auto half = Size{gameSize, gameSize};
+      auto &world = scenery ? *scenery : figures;
+      world.visit(view - half, view + half,
+                  [&](const Objects &o) { renderer.draw(o); });
+    }
+    {
+      PROFILE("draw sprites");
+      renderer.pass(RenderPass::Sprites);
+      if (s.hasPrize) drawSprite(prizeShape, s.prize, view);
+      if (s.hasGamer) drawSprite(gamerShape, s.gamer, view);
+    }
+
+    // Выведем текст, строку обновляем только при изменении счета
+    if (s.score != shownScore || s.bestScore != shownBestScore) {
+      shownScore = s.score;
+      shownBestScore = s.bestScore;
+      char str[64];
+      std::snprintf(str, sizeof(str), "Score: %d, BestScore: %d", s.score,
+                    s.bestScore);
+      scoreText.set(str);
+    }
+    {
+      PROFILE("draw text");
+      renderer.pass(RenderPass::Text);
+      renderer.draw(scoreText);
+      drawOverlay();
+    }
+
+    // На экран
+    PROFILE("swap");
+    renderer.end();
+  });
+}
+
+void Scene::drawOverlay() {
+  if (!Profiler::enabled()) return;
+  // Текст обновляем не каждый кадр, иначе его не прочитать
+  auto time = clock.time();
+  if (overlayTime + profilerDelay <= time) {
+    overlayTime = time;
+    auto stats = Profiler::collect(profilerDelay);
+    while (overlay.size() < stats.size()) {
+      auto pt = scorePosition;
+      pt[1] -= scoreHeight + profilerHeight * overlay.size();
+      overlay.emplace_back(profilerColor, pt, profilerHeight);
+    }
+    for (size_t i = 0; i < overlay.size(); i++) {
+      char str[64] = "";
+      if (i < stats.size())
+        std::snprintf(str, sizeof(str), "%s: %.3f ms", stats[i].name,
+                      stats[i].ms);
+      overlay[i].set(str);
+    }
+  }
+  for (auto const &l : overlay) renderer.draw(l);
+}
+
+int Scene::getScore() const { return score; }
+
+int Scene::getBestScore() const { return bestScore; }
+
 bool Scene::createRandomRect(const Size &sz, Rect &rc) {
   // 100 раз попробуем случайную точку, вдруг повезет ))
   for (int i = 0; i < 100; i++) {
-    auto r = Rect{rnd.point2d(), sz};
-    if (r.first[0] > -1.f + sz[0] && r.first[0] < 1.f - sz[0] &&
-        r.first[1] > -1.f + sz[1] && r.first[1] < 1.f - sz[1]) {
-      if (!figures.intersect(g::points(r))) {
+    // Место в виде
+    auto r = Rect{rnd.point2d() + camera, sz};
+    auto d = r.first - camera;
+    if (d[0] > -1.f + sz[0] && d[0] < 1.f - sz[0] && d[1] > -1.f + sz[1] &&
+        d[1] < 1.f - sz[1]) {
+      ArenaVector<Point> pts(arena);
+      g::points(r, pts);
+      if (!figures.intersect(pts)) {
         rc = r;
         return true;
       }
@@ -103,6 +392,11 @@ bool Scene::createRandomRect(const Size &sz, Rect &rc) {
 void Scene::createGamer() {
   // Круг по центру
   auto circle = Circle{{0.f, 0.f}, gamerRadius};
+  ArenaVector<Point> pts(arena);
+  auto blocked = [&](const Circle &c) {
+    g::points(c, pts);
+    return figures.intersect(pts);
+  };
   // Функция смещает круг во все стороны и проверяет не пересекается ли он с
   // препятствиями
   auto probe = [&](GLfloat step) {
@@ -111,15 +405,14 @@ void Scene::createGamer() {
         auto c = circle;
         c.first[0] += x;
         c.first[1] += y;
-        if (!figures.intersect(g::points(c))) return c;
+        if (!blocked(c)) return c;
       }
     }
     return circle;
   };
   // Начнем с нуля и будем увеличивать смещение
   GLfloat step = .0f;
-  while (figures.intersect(
-      g::points(circle))) {  // Можем и застрять тут если не найдем места
+  while (blocked(circle)) {  // Можем и застрять тут если не найдем места
     step += .01f;
     circle = probe(step);
   }
@@ -127,31 +420,83 @@ void Scene::createGamer() {
 }
 
 void Scene::updateDarkness(const Point &pt) {
-  darkness.clear();
-  int k = 0, m = 0;
-  // Переберем препятствия и добавим невидимые полигоны для каждой стороны
-  // препятствия
-  for (auto o : figures.objects) {
-    for (size_t i = 0; i < o->points.size(); i++) {
-      auto &A = o->points[i];
-      auto &B = o->points[(i + 1) % o->points.size()];
-      std::vector<Point> pts;
-      g::invisiblePoligon(pt, A, B, pts);
-      if (pts.size() > 2) {
-        // По идее здесь можно попробовать объединить полигоны
-        // С другой стороны наверное gpu быстрее отбросит ненужное, чем это
-        // делать на cpu
-        darkness.add(pts);
+  PROFILE("darkness");
+  // Темнота до краев вида на прошлом и текущем шаге, между ними рисуются
+  // кадры, стороны за видом не нужны
+  auto half = Size{gameSize, gameSize};
+  auto lo = Point{std::min(lastCamera[0], camera[0]),
+                  std::min(lastCamera[1], camera[1])} -
+            half;
+  auto hi = Point{std::max(lastCamera[0], camera[0]),
+                  std::max(lastCamera[1], camera[1])} +
+            half;
+  Corners view = {lo, Point{hi[0], lo[1]}, hi, Point{lo[0], hi[1]}};
+  // Соберем видимые стороны препятствий
+  ArenaVector<std::array<Point, 2>> edges(arena);
+  figures.visit(lo, hi, [&](const Objects &o) {
+    for (size_t j = 0; j < o.size(); j++) {
+      auto v = o.getPoints(j);
+      for (size_t i = 0; i < v.size(); i++) {
+        auto A = v[i];
+        auto B = v[(i + 1) % v.size()];
+        if (g::clip(lo, hi, A, B)) edges.push_back({A, B});
       }
     }
+  });
+  // Невидимые полигоны сторон независимы, строим и разбиваем их
+  // параллельно, каждая сторона пишет только в свой элемент
+  ArenaVector<Shadow> shadows(edges.size(), arena);
+  parallelFor(edges.size(), 64, [&](size_t begin, size_t end, Arena &local) {
+    for (auto i = begin; i < end; i++) {
+      auto &s = shadows[i];
+      s.count = 0;
+      local.reset();
+      ArenaVector<Point> pts(local);
+      g::invisiblePoligon(pt, edges[i][0], edges[i][1], pts, view);
+      if (pts.size() < 3) continue;
+      ArenaVector<TriangleIndexes> t(local);
+      if (!g::triangulate2dIndexes(pts, t, pts.get_allocator())) continue;
+      s.count = pts.size();
+      s.triangles = t.size();
+      std::copy(pts.begin(), pts.end(), s.pts.begin());
+      std::copy(t.begin(), t.end(), s.tris.begin());
+    }
+  });
+  // Полигоны темноты переиспользуем по порядку сторон, чтобы не выделять
+  // память под них на каждом шаге, порядок как при построении по одному
+  size_t count = 0;
+  ArenaVector<Point> pts(arena);
+  ArenaVector<TriangleIndexes> t(arena);
+  for (auto &s : shadows) {
+    if (!s.count) continue;
+    // По идее здесь можно попробовать объединить полигоны
+    // С другой стороны наверное gpu быстрее отбросит ненужное, чем это
+    // делать на cpu
+    pts.assign(s.pts.begin(), s.pts.begin() + s.count);
+    t.assign(s.tris.begin(), s.tris.begin() + s.triangles);
+    if (count < darkness.size())
+      darkness.update(darkness.at(count), pts, t);
+    else
+      darkness.add(pts, t);
+    count++;
   }
+  darkness.truncate(count);
+  changed = true;
 }
 
 void Scene::processGamer(double time) {
   // Создадим игрока
-  if (!gamer) createGamer();
-  // Сдвинем и если сдвинулись пересчитаем темноту
-  if (gamer->move(figures)) updateDarkness(gamer->sprite.first);
+  if (!gamer) {
+    createGamer();
+    changed = true;
+  }
+  // Сдвинем и если сдвинулись пересчитаем темноту, камера идет за игроком
+  if (gamer->move(figures, arena)) {
+    changed = true;
+    camera = figures.follow(gamer->sprite.first);
+    figures.stream(camera);
+    updateDarkness(gamer->sprite.first);
+  }
 }
 
 void Scene::processPrize(double time) {
@@ -160,12 +505,16 @@ void Scene::processPrize(double time) {
     if (prize->intersect(gamer)) {
       bestScore = std::max(++score, bestScore);
       prize.reset();
+      changed = true;
     }
   }
   // Создадим приз в случайном месте
   if (!prize) {
     Rect rc;
-    if (createRandomRect(prizeSize, rc)) prize = std::make_shared<Prize>(rc);
+    if (createRandomRect(prizeSize, rc)) {
+      prize = std::make_shared<Prize>(rc);
+      changed = true;
+    }
   }
 }
 
@@ -173,31 +522,137 @@ void Scene::processZombies(double time) {
   // Создадим зомби
   if (zombies.size() < zombyCount) {
     Rect rc;
-    if (createRandomRect(zombySize, rc))
-      zombies.push_back(std::make_shared<Zomby>(rc));
+    if (createRandomRect(zombySize, rc)) {
+      zombies.push_back(std::make_shared<Zomby>(rc, rnd.seed()));
+      changed = true;
+    }
   }
-  // Обработаем действия
-  for (auto z : zombies) {
-    // Если пересеклись с игроком делим очки на 2
-    if (z->process(figures, gamer, time, score)) score /= 2;
+  // Зомби за загруженными кусками не проверить, они пропадают, а новые
+  // появятся в виде
+  zombies.remove_if([&](const std::shared_ptr<Zomby> &z) {
+    if (figures.active(z->sprite.first)) return false;
+    changed = true;
+    return true;
+  });
+  // Контакты и погоня меняют только своего зомби, поэтому идут
+  // параллельно участками по несколько зомби, иначе передача участка
+  // потоку дороже его работы. Очки делятся по порядку зомби, как при
+  // обходе по одному
+  struct Step {
+    Zomby *zomby;
+    int score;
+    bool hit;
+    bool recolored;
+  };
+  ArenaVector<Step> steps(arena);
+  steps.reserve(zombies.size());
+  for (auto &z : zombies) steps.push_back({z.get(), 0, false, false});
+  auto &target = *gamer;
+  parallelFor(steps.size(), 4, [&](size_t begin, size_t end, Arena &) {
+    for (auto i = begin; i < end; i++) {
+      auto &s = steps[i];
+      auto color = s.zomby->getColor();
+      s.hit = s.zomby->touch(target, time);
+      s.recolored = s.zomby->getColor() != color;
+    }
+  });
+  // Если пересеклись с игроком делим очки на 2, следующие зомби видят уже
+  // новый счет
+  for (auto &s : steps) {
+    s.score = score;
+    if (s.hit) score /= 2;
   }
+  parallelFor(steps.size(), 4, [&](size_t begin, size_t end, Arena &local) {
+    for (auto i = begin; i < end; i++) {
+      local.reset();
+      steps[i].zomby->chase(figures, target, steps[i].score, local);
+    }
+  });
+  for (auto &s : steps)
+    if (s.recolored || s.zomby->sprite.first != s.zomby->from) changed = true;
 }
 
 void Scene::process() {
-  // Действия обрабатываем не на каждой отрисовке
-  auto tick = glfwGetTime();
-  if (lastTick + processDelay < tick) {
-    lastTick = tick;
+  auto time = clock.time();
+  // Время считаем с первого вызова, загрузку не догоняем
+  if (lastTime >= 0.) lag += time - lastTime;
+  lastTime = time;
+  // Шаги постоянной длины за накопленное время, после долгой паузы
+  // догоняем не все
+  for (unsigned i = 0; lag >= processDelay; i++) {
+    if (i == maxTicksPerFrame) {
+      lag = std::fmod(lag, processDelay);
+      break;
+    }
+    lag -= processDelay;
+    tickTime = time - lag;
+    tick();
+  }
+}
 
+void Scene::tick() {
+  // Время игры по номеру шага, а не по часам, чтобы повтор совпадал
+  auto time = double(ticks) * processDelay;
+  // Временные данные прошлого шага больше не нужны
+  arena.reset();
+  changed = false;
+  auto shown = std::make_pair(score, bestScore);
+  // Запомним позиции, от них рисуем до новых
+  lastCamera = camera;
+  if (gamer) gamer->from = gamer->sprite.first;
+  for (auto &z : zombies) z->from = z->sprite.first;
+
+  measure(Phase::Input, [&] {
     // Получим события мыши и клавиатуры
-    glfwPollEvents();
+    input.poll(tickTime);
 
     // Проверим gamepad
     processGamepad();
+  });
+
+  // Выполним действия
+  measure(Phase::Gamer, [&] { processGamer(time); });
+  measure(Phase::Prize, [&] { processPrize(time); });
+  measure(Phase::Zombies, [&] { processZombies(time); });
+  ticks++;
+  if (std::make_pair(score, bestScore) != shown) changed = true;
+  publish();
+}
+
+uint32_t Scene::getTicks() const { return ticks; }
+
+const Scene::TimeStats &Scene::getFrameTimes() const { return frameTimes; }
 
-    // Выполним действия
-    processGamer(tick);
-    processPrize(tick);
-    processZombies(tick);
+const Scene::TimeStats &Scene::getLatency() const { return latency; }
+
+uint64_t Scene::checksum() const {
+  uint64_t h = fnv1a(&ticks, sizeof(ticks));
+  auto add = [&](const void *p, size_t sz) { h = fnv1a(p, sz, h); };
+  auto addObjects = [&](const Objects &o) {
+    for (size_t i = 0; i < o.size(); i++) {
+      auto v = o.getPoints(i);
+      for (size_t k = 0; k < v.size(); k++) {
+        auto p = v[k];
+        add(&p, sizeof(p));
+      }
+    }
+  };
+  add(&score, sizeof(score));
+  add(&bestScore, sizeof(bestScore));
+  if (gamer) {
+    add(&gamer->sprite, sizeof(gamer->sprite));
+    add(&gamer->speed, sizeof(gamer->speed));
+  }
+  if (prize) add(&prize->sprite, sizeof(prize->sprite));
+  for (auto const &z : zombies) {
+    add(&z->sprite, sizeof(z->sprite));
+    add(&z->speed, sizeof(z->speed));
+    add(&z->contactTime, sizeof(z->contactTime));
   }
+  addObjects(darkness);
+  return h;
 }
+
+void Scene::record(Recorder *r) { recorder = r; }
+
+void Scene::profile(PhaseStats *stats) { phaseStats = stats; }
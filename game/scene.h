@@ -7,26 +7,324 @@
  */
 #pragma once
 
+#include <atomic>
+#include <thread>
+
+#include "arena.h"
 #include "objects.h"
+#include "platform.h"
+#include "queue.h"
 #include "sprites.h"
-#include "text.h"
+
+class Recorder;
+class Config;
 
 /**
  * @brief Класс сцены где вся игра и происходит
  *
+ * Окно, время и ввод сцена получает через интерфейсы платформы, поэтому
+ * может работать без окна. Время игры считается по номеру шага, а случайные
+ * числа идут от заданного начального значения, поэтому с тем же вводом игра
+ * повторяется точно.
+ *
+ * Шаг публикует снимок для отрисовки через тройной буфер, кадр рисует
+ * только последний снимок. Поэтому шаги могут идти в своем потоке и не
+ * ждать кадров, а кадры не ждут шагов.
  */
 class Scene {
+ public:
+  /**
+   * @brief этапы шага и кадра для замера времени
+   *
+   */
+  enum class Phase { Input, Gamer, Prize, Zombies, Draw, Count };
+  /**
+   * @brief замер этапа
+   *
+   */
+  struct PhaseStat {
+    /**
+     * @brief время в сек.
+     *
+     */
+    double seconds;
+    /**
+     * @brief выделения памяти, считаются если подменен operator new
+     *
+     */
+    uint64_t allocations;
+    /**
+     * @brief выделено байт
+     *
+     */
+    uint64_t bytes;
+  };
+  /**
+   * @brief замеры этапов
+   *
+   */
+  using PhaseStats = std::array<PhaseStat, size_t(Phase::Count)>;
+  /**
+   * @brief замеры промежутков времени
+   *
+   */
+  struct TimeStats {
+    /**
+     * @brief количество промежутков
+     *
+     */
+    unsigned long count;
+    /**
+     * @brief сумма в сек.
+     *
+     */
+    double sum;
+    /**
+     * @brief сумма квадратов, для разброса
+     *
+     */
+    double squares;
+    /**
+     * @brief наибольший промежуток в сек.
+     *
+     */
+    double worst;
+    /**
+     * @brief Добавляет промежуток
+     *
+     * @param dt промежуток в сек.
+     */
+    void add(double dt) {
+      count++;
+      sum += dt;
+      squares += dt * dt;
+      worst = std::max(worst, dt);
+    }
+  };
+
+ private:
+  /**
+   * @brief положение спрайта для отрисовки
+   *
+   */
+  struct SpriteState {
+    /**
+     * @brief позиция на прошлом шаге
+     *
+     */
+    Point from;
+    /**
+     * @brief позиция на шаге
+     *
+     */
+    Point to;
+    Color color;
+  };
+  /**
+   * @brief Снимок шага для отрисовки
+   *
+   * Шаг заполняет снимок и публикует, отрисовка берет последний и больше к
+   * состоянию игры не обращается, поэтому шаги могут идти в своем потоке.
+   */
+  struct Snapshot {
+    /**
+     * @brief номер шага
+     *
+     */
+    uint32_t tick = 0;
+    /**
+     * @brief время начала шага, от него считается доля шага для кадра
+     *
+     */
+    double time = 0.;
+    /**
+     * @brief центр вида на прошлом шаге и на шаге
+     *
+     */
+    Point lastCamera{0.f, 0.f}, camera{0.f, 0.f};
+    bool hasGamer = false, hasPrize = false;
+    SpriteState gamer, prize;
+    std::vector<SpriteState> zombies;
+    Objects darkness{darknessColor};
+    int score = 0, bestScore = 0;
+    /**
+     * @brief на шаге изменилось видимое
+     *
+     */
+    bool changed = false;
+    /**
+     * @brief время прихода самого раннего ввода шага, меньше нуля если
+     * ввода не было
+     *
+     */
+    double inputTime = -1.;
+    /**
+     * @brief Construct a new Snapshot object
+     *
+     * Память под зомби сразу, чтобы шаги ее не выделяли.
+     */
+    Snapshot() { zombies.reserve(zombyCount); }
+  };
+
+  // Состояние игры, меняется только шагами
   Random rnd;
-  GLFWwindow *window;
-  Text text;
-  Objects figures;
+  Clock &clock;
+  Input &input;
+  Renderer &renderer;
+  const Config &cfg;
+  World figures;
   Objects darkness;
+  /**
+   * @brief центр вида в мире
+   *
+   */
+  Point camera{0.f, 0.f};
+  /**
+   * @brief центр вида на прошлом шаге
+   *
+   */
+  Point lastCamera{0.f, 0.f};
   std::shared_ptr<Gamer> gamer;
   std::shared_ptr<Prize> prize;
   std::list<std::shared_ptr<Zomby>> zombies;
   int score = 0, bestScore = 0;
-  double lastTick = 0.;
+  /**
+   * @brief время прошлого вызова process, меньше нуля до первого
+   *
+   */
+  double lastTime = -1.;
+  /**
+   * @brief накопленное время, на которое еще не сделаны шаги
+   *
+   */
+  double lag = 0.;
+  /**
+   * @brief на шаге изменилось видимое, кадры между шагами разные
+   *
+   */
+  bool changed = false;
+  /**
+   * @brief время начала текущего шага, ввод до него отдается в шаг
+   *
+   */
+  double tickTime = HUGE_VAL;
+  /**
+   * @brief время прихода самого раннего ввода шага, меньше нуля если его нет
+   *
+   */
+  double inputTime = -1.;
+  /**
+   * @brief прошлый снимок не прочитан и стал буфером шага, его изменения
+   * переходят в следующий
+   *
+   */
+  bool dropped = false;
+  uint32_t ticks = 0;
+  Recorder *recorder = nullptr;
+  PhaseStats *phaseStats = nullptr;
+  /**
+   * @brief временные данные шага, сбрасывается в начале каждого шага
+   *
+   */
+  Arena arena{tickArenaBytes};
+  /**
+   * @brief временная память участка параллельного цикла шага
+   *
+   */
+  struct LocalArena {
+    Arena arena{tickArenaBytes};
+    /**
+     * @brief занята участком
+     *
+     */
+    std::atomic<bool> busy{false};
+  };
+  /**
+   * @brief память участков, по одной на поток, который может выполнять
+   * участок, выделяется потоком шагов и учитывается в его шаге
+   *
+   */
+  std::unique_ptr<LocalArena[]> locals;
+  size_t localCount = 0;
+
+  // Снимки от шагов к отрисовке
+  TripleBuffer<Snapshot> snapshots;
+  /**
+   * @brief поток шагов, если они идут не в потоке отрисовки
+   *
+   */
+  std::thread worker;
+  std::atomic<bool> running{false};
+
+  // Состояние отрисовки
+  Label scoreText;
+  std::vector<Label> overlay;
+  double overlayTime = -profilerDelay;
+  int shownScore = -1, shownBestScore = -1;
+  /**
+   * @brief фигуры спрайтов с центром в начале координат, рисуются со
+   * сдвигом вида
+   *
+   */
+  Objects gamerShape, prizeShape, zombyShape;
+  /**
+   * @brief препятствия для отрисовки, если мир загружается кусками, а шаги
+   * идут в своем потоке, иначе рисуются figures
+   *
+   */
+  std::unique_ptr<World> scenery;
+  /**
+   * @brief доля шага после снимка, позиции рисуются между прошлым и
+   * текущим шагом
+   *
+   */
+  GLfloat blend = 1.f;
+  /**
+   * @brief кадр отличается от нарисованного, его нужно нарисовать
+   *
+   */
+  bool damaged = true;
+  /**
+   * @brief время начала прошлого кадра
+   *
+   */
+  double frameTime = 0.;
+  /**
+   * @brief шаг, ввод которого уже учтен в задержке
+   *
+   */
+  uint32_t latencyTick = 0;
+  unsigned long frames = 0;
+  TimeStats frameTimes{};
+  TimeStats latency{};
 
+  /**
+   * @brief Выполняет этап, замеряя время если просили
+   *
+   * @tparam F void()
+   * @param phase этап
+   * @param f действия
+   */
+  template <typename F>
+  void measure(Phase phase, F f);
+  /**
+   * @brief Параллельный цикл шага на пуле потоков, участку дается своя
+   * временная память
+   *
+   * Участки пишут только в свои элементы, результат как у цикла по порядку.
+   *
+   * @tparam F void(size_t begin, size_t end, Arena &arena)
+   * @param count количество элементов
+   * @param grain наименьший размер участка
+   * @param f функция участка
+   */
+  template <typename F>
+  void parallelFor(size_t count, size_t grain, F f);
+  /**
+   * @brief Обновляет и рисует текст профилировщика, если он включен
+   *
+   */
+  void drawOverlay();
   /**
    * @brief Create a Gamer object
    *
@@ -66,10 +364,38 @@ class Scene {
    */
   void processZombies(double time);
   /**
-   * @brief Обработка действий
+   * @brief Выполняет шаги за прошедшее время с постоянным шагом
    *
    */
   void process();
+  /**
+   * @brief Шаги в своем потоке, пока не остановят
+   *
+   */
+  void simulate();
+  /**
+   * @brief Заполняет и публикует снимок шага
+   *
+   */
+  void publish();
+  /**
+   * @brief Берет последний снимок, если он новый
+   *
+   */
+  void acquire();
+  /**
+   * @brief Рисует кадр по снимку
+   *
+   */
+  void render();
+  /**
+   * @brief Рисует спрайт между прошлой и текущей позицией
+   *
+   * @param shape фигура спрайта
+   * @param s положение спрайта
+   * @param view центр вида
+   */
+  void drawSprite(Objects &shape, const SpriteState &s, const Point &view);
 
   /**
    * @brief Обработка gamepad
@@ -81,10 +407,15 @@ class Scene {
   /**
    * @brief Construct a new Scene object
    *
-   * @param window окно
-   * @param cfg конфигурация
+   * @param clock часы
+   * @param input источник ввода
+   * @param renderer отрисовщик
+   * @param cfg конфигурация, должна жить не меньше сцены
+   * @param seed начальное значение генератора случайных чисел
    */
-  Scene(GLFWwindow *window, const std::vector<std::vector<Point>> &cfg);
+  Scene(Clock &clock, Input &input, Renderer &renderer, const Config &cfg,
+        unsigned seed);
+  ~Scene();
   /**
    * @brief возможные клавиши управления
    *
@@ -100,13 +431,97 @@ class Scene {
   /**
    * @brief Вызывается при клике мышкой
    *
-   * @param mx x
-   * @param my y
+   * @param pt точка в координатах игры
+   */
+  void onClick(const Point &pt);
+  /**
+   * @brief Вызывается перед событием ввода, для замера задержки до кадра
+   *
+   * @param time время прихода события в сек.
+   */
+  void onInput(double time);
+  /**
+   * @brief Требует перерисовать кадр, например после изменения окна
+   *
    */
-  void onClick(double mx, double my);
+  void invalidate();
   /**
-   * @brief Главный цикл игры
+   * @brief Один шаг игры: ввод и действия
+   *
+   */
+  void tick();
+  /**
+   * @brief Отрисовка кадра
+   *
+   */
+  void draw();
+  /**
+   * @brief Главный цикл игры, без своего потока шагов шаги идут в нем
    *
    */
   void loop();
+  /**
+   * @brief Запускает шаги в своем потоке или останавливает его
+   *
+   * Пока поток идет, шаги и их данные (счет, запись ввода) трогать нельзя.
+   *
+   * @param on запустить
+   */
+  void setThreaded(bool on);
+  /**
+   * @brief Текущий счет
+   *
+   * @return int
+   */
+  int getScore() const;
+  /**
+   * @brief Лучший счет
+   *
+   * @return int
+   */
+  int getBestScore() const;
+  /**
+   * @brief Имя этапа
+   *
+   * @param phase этап
+   * @return const char*
+   */
+  static const char *phaseName(Phase phase);
+  /**
+   * @brief Количество выполненных шагов
+   *
+   * @return uint32_t
+   */
+  uint32_t getTicks() const;
+  /**
+   * @brief Время между кадрами главного цикла
+   *
+   * @return const TimeStats&
+   */
+  const TimeStats &getFrameTimes() const;
+  /**
+   * @brief Задержка от прихода ввода до вывода первого кадра после шага,
+   * который его обработал
+   *
+   * @return const TimeStats&
+   */
+  const TimeStats &getLatency() const;
+  /**
+   * @brief Контрольная сумма состояния игры, для сравнения повторов
+   *
+   * @return uint64_t
+   */
+  uint64_t checksum() const;
+  /**
+   * @brief Задает запись ввода
+   *
+   * @param r запись или nullptr
+   */
+  void record(Recorder *r);
+  /**
+   * @brief Задает куда добавлять время и выделения памяти этапов
+   *
+   * @param stats замеры этапов или nullptr
+   */
+  void profile(PhaseStats *stats);
 };
\ No newline at end of file
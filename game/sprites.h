@@ -7,7 +7,9 @@
  */
 #pragma once
 
+#include "arena.h"
 #include "objects.h"
+#include "world.h"
 
 /**
  * @brief Обобщенный класс перемещаемого объекта
@@ -20,6 +22,11 @@ struct Sprite : public Objects {
    *
    */
   T sprite;
+  /**
+   * @brief позиция на прошлом шаге, рисуем между ней и текущей
+   *
+   */
+  Point from;
   /**
    * @brief дельта скорости
    *
@@ -47,10 +54,10 @@ struct Sprite : public Objects {
    */
   GLfloat speedLimit;
   /**
-   * @brief указатель на полигон
+   * @brief ссылка на полигон
    *
    */
-  ObjectPtr object;
+  ObjectHandle object;
   /**
    * @brief Construct a new Sprite object
    *
@@ -61,18 +68,22 @@ struct Sprite : public Objects {
    */
   Sprite(const T &sprite, const Color &color, GLfloat weight = 0.f,
          GLfloat speedLimit = 0.f)
-      : Objects(color), sprite(sprite), weight(weight), speedLimit(speedLimit) {
-    auto pts = g::points(sprite);
-    object = Objects::add({pts});
+      : Objects(color),
+        sprite(sprite),
+        from(sprite.first),
+        weight(weight),
+        speedLimit(speedLimit) {
+    object = Objects::add(g::points(sprite));
   }
   /**
    * @brief
    *
    * @param figures объекты в которых движение запрещено
+   * @param arena память для временных данных
    * @return true сместились
    * @return false нет
    */
-  bool move(const Objects &figures) {
+  bool move(const World &figures, Arena &arena) {
     // Прибавим дельту приращения смещения спрайта (условная скорость)
     // Прибавляем тем меньше чем больше условный вес спрайта
     speed = speed + force * (accelerateForce / weight);
@@ -87,7 +98,8 @@ struct Sprite : public Objects {
       auto obj = figures.intersect(sprite.first, pt);
       if (obj) {
         // Найдем грани фигуры, пересекающиеся с линией движения
-        auto v = g::intersect(obj->points, sprite.first, pt);
+        ArenaVector<std::array<Point, 3>> v(arena);
+        g::intersect(figures.getPoints(obj), sprite.first, pt, v);
         if (!v.empty()) {
           // Выберем ближайшую к старой точке грань
           auto t = v.front();
@@ -125,8 +137,10 @@ struct Sprite : public Objects {
       }
       // Обновим позицию и вертексы
       if (sprite.first != pt) {
-        sprite.first = g::ensureInScene(pt);
-        Objects::update(object, g::points(sprite));
+        sprite.first = figures.clamp(pt);
+        ArenaVector<Point> pts(arena);
+        g::points(sprite, pts);
+        Objects::update(object, pts);
         return true;
       }
     }
@@ -167,7 +181,7 @@ struct Prize : public Sprite<Rect> {
    * @return false не пересекается
    */
   bool intersect(std::shared_ptr<Gamer> gamer) {
-    return !!gamer->intersect(object);
+    return !!gamer->intersect(*this, object);
   }
 };
 
@@ -191,40 +205,60 @@ struct Zomby : public Sprite<Rect> {
    *
    */
   double contactTime = 0.;
+  /**
+   * @brief активен ли на этом шаге, задает touch
+   *
+   */
+  bool active = true;
   /**
    * @brief Construct a new Zomby object
    *
    * @param rc примитив
+   * @param seed начальное значение генератора случайных чисел
    */
-  Zomby(const Rect &rc)
+  Zomby(const Rect &rc, unsigned seed)
       : Sprite(rc, zombyActiveColor, zombyWeight, zombySpeedLimit),
-        rnd(zombyMemoryError) {}
+        rnd(zombyMemoryError, seed) {}
   /**
-   * @brief Обработчие действий зомби
+   * @brief Проверка контакта с игроком, обновляет цвет
    *
-   * @param figures препятствия
-   * @param gamer указатель на игрока
+   * Меняет только этого зомби, поэтому зомби проверяются параллельно.
+   *
+   * @param gamer игрок
    * @param time время игры
-   * @param score набранные очки
-   * @return true пересекаемся с игроком
-   * @return false не пересекаемся с игроком
+   * @return true пересекаемся с игроком, будучи активными
+   * @return false
    */
-  bool process(const Objects &figures, std::shared_ptr<Gamer> gamer,
-               double time, int score) {
+  bool touch(const Gamer &gamer, double time) {
     // Определим мы сейчас активны или нет
-    bool active = contactTime + sombyInactiveTime < time;
+    active = contactTime + sombyInactiveTime < time;
     // Пересекаемся с игроком?
-    auto obj = gamer->intersect(object);
+    auto obj = gamer.intersect(*this, object);
     if (obj) contactTime = time;  // Обновим время контакта
     // Установим цвет
     setColor(active ? zombyActiveColor : zombyInactiveColor);
+    // Сообщим о пересечении с игроком
+    return active && obj;
+  }
+  /**
+   * @brief Погоня за игроком после touch
+   *
+   * Меняет только этого зомби, поэтому зомби двигаются параллельно.
+   *
+   * @param figures препятствия
+   * @param gamer игрок
+   * @param score очки после контактов предыдущих зомби
+   * @param arena память для временных данных
+   */
+  void chase(const World &figures, const Gamer &gamer, int score,
+             Arena &arena) {
     // Видим ли мы игрока?
     Point pt;
     if (!figures.intersect(sprite.first,
-                           gamer->sprite.first)) {  // Если видим запомним точку
-                                                    // и обновим лимит скорости
+                           gamer.sprite.first)) {  // Если видим запомним точку
+                                                   // и обновим лимит скорости
       if (!dest) dest = std::make_shared<Point>();
-      *dest = gamer->sprite.first;
+      *dest = gamer.sprite.first;
       pt = *dest;
       speedLimit =
           score ? zombySpeedLimit + score * zombySpeedFromScoreKoef : 0.f;
@@ -235,9 +269,7 @@ struct Zomby : public Sprite<Rect> {
     }
     if (dest) {  // Есть координаты игрока - идем туда
       force = g::vec(active ? pt - sprite.first : sprite.first - pt, 1.f);
-      move(figures);
+      move(figures, arena);
     }
-    // Сообщим о пересечении с игроком
-    return active && obj;
   }
 };
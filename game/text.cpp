@@ -7,6 +7,8 @@
  */
 #include "text.h"
 
+#include "glstats.h"
+
 // программа для вертексов символа
 static const char *vscode = R"(
     attribute vec2 pos;
@@ -19,7 +21,7 @@ static const char *vscode = R"(
 )";
 
 // программа для фрагментов символа
-static const char *fscode = R"(
+static const char *fscodeBitmap = R"(
     precision mediump float;
     uniform sampler2D tex;
     uniform vec4 color;
@@ -29,6 +31,21 @@ static const char *fscode = R"(
     }      
 )";
 
+// программа для фрагментов символа из поля расстояний, smoothing - половина
+// ширины перехода границы символа в единицах текстуры
+static const char *fscodeSdf = R"(
+    precision mediump float;
+    uniform sampler2D tex;
+    uniform vec4 color;
+    uniform float smoothing;
+    varying vec2 texpos;
+    void main() {
+      float dist = texture2D(tex, texpos).a;
+      float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, dist);
+      gl_FragColor = color * vec4(1.0, 1.0, 1.0, alpha);
+    }
+)";
+
 // проверка компиляции программы
 static void check(GLuint shader) {
   GLint isCompiled = 0;
@@ -43,7 +60,13 @@ static void check(GLuint shader) {
   }
 }
 
-Text::Program::Program() {
+Text::Program::Program(TextMode mode)
+    : mode(mode),
+      size(mode == TextMode::Sdf ? textSdfSize : textBitmapSize),
+      packer(textAtlasSize, textAtlasSize, 1, textAtlasShelf) {
+  // Шрифт готовим первым, так как при неудаче режим может смениться
+  createSymbols();
+  auto fscode = this->mode == TextMode::Sdf ? fscodeSdf : fscodeBitmap;
   auto vs = glCreateShader(GL_VERTEX_SHADER);
   glShaderSource(vs, 1, &vscode, NULL);
   glCompileShader(vs);
@@ -63,13 +86,22 @@ Text::Program::Program() {
   color = glGetUniformLocation(id, "color");
   pos = glGetAttribLocation(id, "pos");
   tex = glGetAttribLocation(id, "tex");
-  createSymbols();
+  smoothing = glGetUniformLocation(id, "smoothing");
 }
 
-Text::Program::~Program() { glDeleteProgram(id); }
+Text::Program::~Program() {
+  if (manager) FTC_Manager_Done(manager);
+  if (ft) FT_Done_FreeType(ft);
+  glDeleteTextures(1, &atlas);
+  glDeleteProgram(id);
+}
 
-Text::Program &Text::Program::get() {
-  static Program prog;
+Text::Program &Text::Program::get(TextMode mode) {
+  if (mode == TextMode::Sdf) {
+    static Program prog(TextMode::Sdf);
+    return prog;
+  }
+  static Program prog(TextMode::Bitmap);
   return prog;
 }
 
@@ -84,46 +116,232 @@ extern unsigned long font_ttf_len;
  *
  */
 extern unsigned char font_ttf_data[];
+/**
+ * @brief размер ресурса метрик заранее растеризованных символов
+ *
+ */
+extern unsigned long font_glyphs_len;
+/**
+ * @brief указатель на данные ресурса метрик символов
+ *
+ */
+extern unsigned char font_glyphs_data[];
+/**
+ * @brief размер ресурса заранее растеризованного атласа
+ *
+ */
+extern unsigned long font_atlas_len;
+/**
+ * @brief указатель на данные ресурса атласа
+ *
+ */
+extern unsigned char font_atlas_data[];
 };  // namespace res
 
+// загрузка шрифта из ресурса по запросу кэша
+static FT_Error requestFace(FTC_FaceID, FT_Library library, FT_Pointer,
+                            FT_Face *face) {
+  return FT_New_Memory_Face(library, (FT_Byte *)res::font_ttf_data,
+                            (FT_Long)res::font_ttf_len, 0, face);
+}
+
+// идентификатор единственного шрифта в кэше
+static const FTC_FaceID fontFaceID = (FTC_FaceID)res::font_ttf_data;
+
 void Text::Program::createSymbols() {
-  FT_Library ft;
-  if (!FT_Init_FreeType(&ft)) {
-    FT_Face face;
-    if (!FT_New_Memory_Face(ft, (FT_Byte *)res::font_ttf_data,
-                            (FT_Long)res::font_ttf_len, 0, &face)) {
-      FT_Set_Pixel_Sizes(face, 0, textBitmapSize);
-      glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-      for (unsigned char c = 0; c < 128; c++) {
-        if (FT_Load_Char(face, c, FT_LOAD_RENDER)) continue;
-        GLuint texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, face->glyph->bitmap.width,
-                     face->glyph->bitmap.rows, 0, GL_ALPHA, GL_UNSIGNED_BYTE,
-                     face->glyph->bitmap.buffer);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        chars.emplace(
-            c, Symbol{texture,
-                      {face->glyph->bitmap.width, face->glyph->bitmap.rows},
-                      {face->glyph->bitmap_left, face->glyph->bitmap_top},
-                      face->glyph->advance.x});
-      }
-      FT_Done_Face(face);
+  // Пустой атлас, символы будут дописываться в него
+  pixels.assign(textAtlasSize * textAtlasSize, 0);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glGenTextures(1, &atlas);
+  GLStats::bindTexture(GL_TEXTURE_2D, atlas);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, textAtlasSize, textAtlasSize, 0,
+               GL_ALPHA, GL_UNSIGNED_BYTE, pixels.data());
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  GLStats::bindTexture(GL_TEXTURE_2D, 0);
+
+  // С готовыми символами FreeType понадобится только для недостающих
+  baked = loadBaked();
+  if (!baked) initFreeType();
+}
+
+bool Text::Program::loadBaked() {
+  Glyphs::Header header;
+  if (res::font_glyphs_len < sizeof(header)) return false;
+  std::memcpy(&header, res::font_glyphs_data, sizeof(header));
+  auto sdf = mode == TextMode::Sdf;
+  if (header.magic != Glyphs::magic || header.version != Glyphs::version ||
+      header.mode != (sdf ? Glyphs::Sdf : Glyphs::Bitmap) ||
+      header.size != size || (sdf && header.spread != textSdfSpread) ||
+      header.width > textAtlasSize || header.height > textAtlasSize ||
+      res::font_glyphs_len <
+          sizeof(header) + header.count * sizeof(Glyphs::Glyph) ||
+      res::font_atlas_len != header.width * header.height)
+    return false;  // Собраны для другого режима или размера
+
+  auto shelf = packer.reserve(header.height);
+  if (shelf < 0) return false;
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  GLStats::bindTexture(GL_TEXTURE_2D, atlas);
+  GLStats::texSubImage2D(GL_TEXTURE_2D, 0, 0, 0, header.width,
+                         header.height, GL_ALPHA, GL_UNSIGNED_BYTE,
+                         res::font_atlas_data);
+  GLStats::bindTexture(GL_TEXTURE_2D, 0);
+
+  for (uint32_t i = 0; i < header.count; i++) {
+    Glyphs::Glyph g;
+    std::memcpy(&g,
+                res::font_glyphs_data + sizeof(header) + i * sizeof(g),
+                sizeof(g));
+    auto &s = g.code < chars.size() ? chars[g.code] : unicode[g.code];
+    s.rect = {GLfloat(g.x) / textAtlasSize, GLfloat(g.y) / textAtlasSize,
+              GLfloat(g.x + g.width) / textAtlasSize,
+              GLfloat(g.y + g.height) / textAtlasSize};
+    s.size = {g.width, g.height};
+    s.bearing = {g.left, g.top};
+    s.advance = g.advance;
+    s.state = Symbol::State::Resident;
+    s.shelf = g.width && g.height ? shelf : -1;
+  }
+  return true;
+}
+
+void Text::Program::initFreeType() {
+  if (ready) return;
+  ready = true;
+  if (FT_Init_FreeType(&ft)) {
+    ft = nullptr;
+    std::cout << "FreeType init failed!" << std::endl;
+    return;
+  }
+  if (mode == TextMode::Sdf) {
+    if (FT_Get_Module(ft, "sdf")) {
+      FT_Int spread = textSdfSpread;
+      FT_Property_Set(ft, "sdf", "spread", &spread);
+    } else if (baked) {
+      // Режим уже выбран готовым атласом, недостающих символов не будет
+      std::cout << "SDF glyphs unsupported, using baked glyphs only"
+                << std::endl;
+      return;
+    } else {
+      // Библиотека собрана без модуля sdf - используем обычные символы
+      std::cout << "SDF glyphs unsupported, using bitmap text" << std::endl;
+      mode = TextMode::Bitmap;
+      size = textBitmapSize;
     }
-    FT_Done_FreeType(ft);
   }
+  if (FTC_Manager_New(ft, 1, 1, textCacheBytes, requestFace, nullptr,
+                      &manager) ||
+      FTC_CMapCache_New(manager, &cmaps) ||
+      FTC_SBitCache_New(manager, &sbits)) {
+    std::cout << "Unable to create glyph cache!" << std::endl;
+  }
+}
+
+const Text::Program::Symbol *Text::Program::symbol(char32_t code) {
+  auto &s = code < chars.size() ? chars[code] : unicode[code];
+  if (s.state == Symbol::State::Unknown) rasterize(code, s);
+  if (s.state != Symbol::State::Resident) return nullptr;
+  if (s.shelf >= 0) packer.touch(s.shelf, stamp);
+  return &s;
+}
+
+void Text::Program::rasterize(char32_t code, Symbol &s) {
+  s.state = Symbol::State::Missing;
+  initFreeType();  // Символа нет среди готовых - нужен FreeType
+  if (!manager) return;
+
+  auto index = FTC_CMapCache_Lookup(cmaps, fontFaceID, -1, code);
+  if (!index) return;  // В шрифте нет такого символа
+
+  FTC_ImageTypeRec type;
+  type.face_id = fontFaceID;
+  type.width = 0;
+  type.height = size;
+  type.flags = mode == TextMode::Sdf ? FT_LOAD_TARGET_(FT_RENDER_MODE_SDF)
+                                     : FT_LOAD_DEFAULT;
+  FTC_SBit sbit;
+  if (FTC_SBitCache_Lookup(sbits, &type, index, &sbit, nullptr)) return;
+  if (!sbit->buffer && mode == TextMode::Sdf) {
+    // Поле расстояний не строится для символов без контура (пробел),
+    // возьмем их размеры из обычного растра
+    type.flags = FT_LOAD_DEFAULT;
+    if (FTC_SBitCache_Lookup(sbits, &type, index, &sbit, nullptr)) return;
+  }
+  if (!sbit->buffer) {  // Рисовать нечего, в атлас не кладем
+    s.size = {0, 0};
+    s.bearing = {0, 0};
+    s.advance = sbit->xadvance;
+    s.state = Symbol::State::Resident;
+    return;
+  }
+
+  // Найдем место в атласе, при нехватке освободим давно не использованную
+  // полку
+  Atlas::Pos pos;
+  int shelf;
+  if (!packer.insert(sbit->width, sbit->height, pos, shelf, stamp)) {
+    shelf = packer.evict(sbit->height, stamp);
+    if (shelf < 0) return;  // Атлас занят символами текущей строки
+    generation++;
+    for (auto &c : chars)
+      if (c.shelf == shelf) c = Symbol{};
+    for (auto &c : unicode)
+      if (c.second.shelf == shelf) c.second = Symbol{};
+    // Очистим полку, чтобы остатки старых символов не попадали в фильтрацию
+    auto rc = packer.rect(shelf);
+    std::fill_n(pixels.begin(), rc[2] * rc[3], 0);
+    GLStats::bindTexture(GL_TEXTURE_2D, atlas);
+    GLStats::texSubImage2D(GL_TEXTURE_2D, 0, rc[0], rc[1], rc[2], rc[3],
+                           GL_ALPHA, GL_UNSIGNED_BYTE, pixels.data());
+    // Символ шире атласа не влезет и в пустую полку
+    if (!packer.insert(sbit->width, sbit->height, pos, shelf, stamp)) return;
+  }
+
+  // Скопируем растр без учета шага строк и допишем в атлас
+  for (unsigned row = 0; row < sbit->height; row++) {
+    std::copy_n(sbit->buffer + row * sbit->pitch, sbit->width,
+                pixels.begin() + row * sbit->width);
+  }
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  GLStats::bindTexture(GL_TEXTURE_2D, atlas);
+  GLStats::texSubImage2D(GL_TEXTURE_2D, 0, pos[0], pos[1], sbit->width,
+                         sbit->height, GL_ALPHA, GL_UNSIGNED_BYTE,
+                         pixels.data());
+  GLStats::bindTexture(GL_TEXTURE_2D, 0);
+
+  s.rect = {GLfloat(pos[0]) / textAtlasSize, GLfloat(pos[1]) / textAtlasSize,
+            GLfloat(pos[0] + sbit->width) / textAtlasSize,
+            GLfloat(pos[1] + sbit->height) / textAtlasSize};
+  s.size = {sbit->width, sbit->height};
+  s.bearing = {sbit->left, sbit->top};
+  s.advance = sbit->xadvance;
+  s.state = Symbol::State::Resident;
+  s.shelf = shelf;
 }
 
-Text::Text() : prog(Program::get()) {
+// следующий код символа из строки UTF-8, некорректные байты пропускаем
+static char32_t nextCode(std::string::const_iterator &it,
+                         std::string::const_iterator end) {
+  auto c = static_cast<unsigned char>(*it++);
+  int extra = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+  char32_t code = extra ? c & (0x3F >> extra) : c;
+  for (; extra && it != end; extra--) {
+    auto d = static_cast<unsigned char>(*it);
+    if ((d & 0xC0) != 0x80) break;
+    code = (code << 6) | (d & 0x3F);
+    ++it;
+  }
+  return extra ? 0xFFFD : code;
+}
+
+Text::Text(TextMode mode) : prog(Program::get(mode)) {
   glGenVertexArrays(1, &vao);
   glGenBuffers(1, &vbo);
   glBindVertexArray(vao);
   glBindBuffer(GL_ARRAY_BUFFER, vbo);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
   glVertexAttribPointer(prog.pos, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat),
                         0);
   glEnableVertexAttribArray(prog.pos);
@@ -139,37 +357,102 @@ Text::~Text() {
   glDeleteVertexArrays(1, &vao);
 }
 
-void Text::draw(const std::string &text, const Color &color, const Point &pt,
-                GLfloat height) {
-  glUseProgram(prog.id);
+void Text::layout(const std::string &text, const Point &pt,
+                  GLfloat height) {
+  // Соберем все символы строки в один массив вертексов
+  vertices.clear();
+  scale = height / prog.size;
+  prog.stamp++;
+  auto x = pt[0];
+  for (auto it = text.begin(); it != text.end();) {
+    auto ch = prog.symbol(nextCode(it, text.end()));
+    if (!ch) continue;
+    auto xpos = x + ch->bearing[0] * scale;
+    auto ypos = pt[1] - (ch->size[1] - ch->bearing[1]) * scale;
+    auto w = ch->size[0] * scale;
+    auto h = ch->size[1] * scale;
+    auto &r = ch->rect;
+    GLfloat quad[6][4] = {
+        {xpos, ypos + h, r[0], r[1]}, {xpos, ypos, r[0], r[3]},
+        {xpos + w, ypos, r[2], r[3]}, {xpos, ypos + h, r[0], r[1]},
+        {xpos + w, ypos, r[2], r[3]}, {xpos + w, ypos + h, r[2], r[1]}};
+    vertices.insert(vertices.end(), &quad[0][0], &quad[0][0] + 6 * 4);
+    x += ch->advance * scale;
+  }
+  generation = prog.generation;
+  count = GLsizei(vertices.size() / 4);
+  if (!count) return;
+
+  glBindBuffer(GL_ARRAY_BUFFER, vbo);
+  if (size_t(count) > capacity) {  // Буфер мал - пересоздадим
+    capacity = count;
+    GLStats::bufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(GLfloat),
+                        vertices.data(), GL_DYNAMIC_DRAW);
+  } else {
+    GLStats::bufferSubData(GL_ARRAY_BUFFER, 0,
+                           vertices.size() * sizeof(GLfloat), vertices.data());
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+bool Text::outdated() const { return generation != prog.generation; }
+
+void Text::render(const Color &color) {
+  if (!count) return;
+
+  GLStats::useProgram(prog.id);
   glUniform4fv(prog.color, 1, color.data());
+  if (prog.mode == TextMode::Sdf) {
+    // Ширина перехода - пиксель экрана в единицах расстояния текстуры,
+    // один тексель атласа это .5 / spread
+    GLint vp[4];
+    glGetIntegerv(GL_VIEWPORT, vp);
+    auto texel = scale * vp[3] / 2.f;  // пикселей экрана на тексель
+    glUniform1f(prog.smoothing,
+                texel > 0.f ? .5f / textSdfSpread / texel : .5f);
+  }
   glActiveTexture(GL_TEXTURE0);
+  GLStats::bindTexture(GL_TEXTURE_2D, prog.atlas);
   glBindVertexArray(vao);
-
-  auto scale = height / textBitmapSize;
-  auto x = pt[0];
-  for (auto c : text) {
-    auto it = prog.chars.find(c);
-    if (it == prog.chars.end()) continue;
-    auto ch = it->second;
-    auto xpos = x + ch.bearing[0] * scale;
-    auto ypos = pt[1] - (ch.size[1] - ch.bearing[1]) * scale;
-    auto w = ch.size[0] * scale;
-    auto h = ch.size[1] * scale;
-    GLfloat vertices[6][4] = {
-        {xpos, ypos + h, 0.0f, 0.0f}, {xpos, ypos, 0.0f, 1.0f},
-        {xpos + w, ypos, 1.0f, 1.0f}, {xpos, ypos + h, 0.0f, 0.0f},
-        {xpos + w, ypos, 1.0f, 1.0f}, {xpos + w, ypos + h, 1.0f, 0.0f}};
-    glBindTexture(GL_TEXTURE_2D, ch.texture);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glDrawArrays(GL_TRIANGLES, 0, 6);
-    x += (ch.advance >> 6) *
-         scale;  // bitshift by 6 to get value in pixels (2^6 = 64)
-  }
-  glBindTexture(GL_TEXTURE_2D, 0);
+  GLStats::drawArrays(GL_TRIANGLES, 0, count);
+  GLStats::bindTexture(GL_TEXTURE_2D, 0);
 
   glBindVertexArray(0);
-  glUseProgram(0);
+  GLStats::useProgram(0);
+}
+
+void Text::draw(const std::string &text, const Color &color, const Point &pt,
+                GLfloat height) {
+  layout(text, pt, height);
+  render(color);
+}
+
+TextLabel::TextLabel(const Color &color, const Point &pt, GLfloat height,
+                     TextMode mode)
+    : Text(mode), color(color), pt(pt), height(height) {}
+
+void TextLabel::set(const char *str) {
+  if (text.compare(str)) {
+    text = str;  // Память строки переиспользуется
+    changed = true;
+  }
+}
+
+void TextLabel::setColor(const Color &clr) { color = clr; }
+
+void TextLabel::setPosition(const Point &point, GLfloat h) {
+  if (point != pt || h != height) {
+    pt = point;
+    height = h;
+    changed = true;
+  }
+}
+
+void TextLabel::draw() {
+  // Пересобираем только при изменениях строки или вытеснении из атласа
+  if (changed || outdated()) {
+    changed = false;
+    layout(text, pt, height);
+  }
+  render(color);
 }
@@ -7,7 +7,14 @@
  */
 #pragma once
 
+#include "atlas.h"
 #include "common.h"
+#include "glyphs.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_CACHE_H
+#include FT_MODULE_H
 
 /**
  * @brief класс для отрисовки текста
@@ -39,32 +46,70 @@ class Text {
      *
      */
     GLuint color;
+    /**
+     * @brief указатель на ширину сглаживания границы в программе (режим sdf)
+     *
+     */
+    GLint smoothing;
+    /**
+     * @brief режим растеризации символов
+     *
+     */
+    TextMode mode;
+    /**
+     * @brief размер символа в атласе
+     *
+     */
+    FT_UInt size;
     /**
      * @brief Construct a new Program object
      *
+     * @param mode режим растеризации символов
      */
-    Program();
+    Program(TextMode mode);
     /**
      * @brief Destroy the Program object
      *
      */
     ~Program();
     /**
-     * @brief возвращает ссылку на синглетон программы
+     * @brief возвращает ссылку на синглетон программы для режима
      *
+     * @param mode режим растеризации символов
      * @return Program&
      */
-    static Program &get();
+    static Program &get(TextMode mode);
     /**
      * @brief класс символа текста
      *
      */
     struct Symbol {
       /**
-       * @brief ид текстуры
+       * @brief состояние символа
+       *
+       */
+      enum class State {
+        /**
+         * @brief еще не запрашивали
+         *
+         */
+        Unknown,
+        /**
+         * @brief в шрифте нет или не удалось растеризовать
+         *
+         */
+        Missing,
+        /**
+         * @brief лежит в атласе
+         *
+         */
+        Resident
+      };
+      /**
+       * @brief координаты символа в атласе (u0, v0, u1, v1)
        *
        */
-      GLuint texture;
+      std::array<GLfloat, 4> rect;
       /**
        * @brief размер
        *
@@ -76,21 +121,120 @@ class Text {
        */
       std::array<FT_Int, 2> bearing;
       /**
-       * @brief смещение до следующего символа
+       * @brief смещение до следующего символа в пикселях
+       *
+       */
+      FT_Int advance;
+      /**
+       * @brief состояние
+       *
+       */
+      State state = State::Unknown;
+      /**
+       * @brief полка атласа, на которой лежит символ
        *
        */
-      FT_Pos advance;
+      int shelf = -1;
     };
     /**
-     * @brief список символов
+     * @brief библиотека FreeType
+     *
+     */
+    FT_Library ft = nullptr;
+    /**
+     * @brief менеджер кэша FreeType (шрифт, размеры, растры)
+     *
+     */
+    FTC_Manager manager = nullptr;
+    /**
+     * @brief кэш кодов символов в индексы глифов
+     *
+     */
+    FTC_CMapCache cmaps = nullptr;
+    /**
+     * @brief кэш растров глифов
+     *
+     */
+    FTC_SBitCache sbits = nullptr;
+    /**
+     * @brief ид текстуры атласа символов
+     *
+     */
+    GLuint atlas = 0;
+    /**
+     * @brief размещение символов в атласе
      *
      */
-    std::map<char, Symbol> chars;
+    Atlas packer;
     /**
-     * @brief Загружает шрифт и создает первые 128 символов
+     * @brief метка текущей раскладки строки, ее символы нельзя вытеснять
+     *
+     */
+    unsigned stamp = 0;
+    /**
+     * @brief счетчик вытеснений из атласа, при изменении строки надо
+     * раскладывать заново
+     *
+     */
+    unsigned generation = 0;
+    /**
+     * @brief символы ASCII, индекс - код символа
+     *
+     */
+    std::array<Symbol, 128> chars;
+    /**
+     * @brief остальные символы Unicode
+     *
+     */
+    std::unordered_map<char32_t, Symbol> unicode;
+    /**
+     * @brief буфер для переноса растра в атлас
+     *
+     */
+    std::vector<unsigned char> pixels;
+    /**
+     * @brief FreeType уже инициализировали (или пытались)
+     *
+     */
+    bool ready = false;
+    /**
+     * @brief в атлас загружены заранее растеризованные символы
+     *
+     */
+    bool baked = false;
+    /**
+     * @brief Создает атлас и загружает в него заранее растеризованные символы,
+     * если их нет - сразу инициализирует FreeType
      *
      */
     void createSymbols();
+    /**
+     * @brief Загружает заранее растеризованные при сборке символы
+     *
+     * @return true символы подходят к режиму и загружены
+     * @return false
+     */
+    bool loadBaked();
+    /**
+     * @brief Инициализирует FreeType и кэш растров
+     *
+     */
+    void initFreeType();
+    /**
+     * @brief Возвращает символ, при первом обращении растеризует его в атлас
+     *
+     * @param code код символа Unicode
+     * @return const Symbol* символ или nullptr если его нет
+     */
+    const Symbol *symbol(char32_t code);
+    /**
+     * @brief Растеризует символ и кладет в атлас, вытесняя старые при нехватке
+     * места
+     *
+     * @param code код символа
+     * @param s символ
+     */
+    void rasterize(char32_t code, Symbol &s);
   };
   /**
    * @brief ссылка на программу отрисовки
@@ -107,13 +251,64 @@ class Text {
    *
    */
   GLuint vao;
+  /**
+   * @brief размер буфера в вертексах
+   *
+   */
+  size_t capacity = 0;
+  /**
+   * @brief количество вертексов в буфере
+   *
+   */
+  GLsizei count = 0;
+  /**
+   * @brief масштаб атласа к высоте разложенной строки
+   *
+   */
+  GLfloat scale = 0.f;
+
+ protected:
+  /**
+   * @brief счетчик вытеснений атласа на момент раскладки строки
+   *
+   */
+  unsigned generation = 0;
+  /**
+   * @brief вертексы строки (x, y, u, v), храним чтобы не выделять память
+   * каждый кадр
+   *
+   */
+  std::vector<GLfloat> vertices;
+
+  /**
+   * @brief Атлас изменился после раскладки, вертексы могут быть неверны
+   *
+   * @return true
+   * @return false
+   */
+  bool outdated() const;
+  /**
+   * @brief Раскладывает строку в вертексы и загружает их в буфер
+   *
+   * @param text строка в UTF-8
+   * @param pt координаты
+   * @param height высота
+   */
+  void layout(const std::string &text, const Point &pt, GLfloat height);
+  /**
+   * @brief Рисует загруженные в буфер вертексы
+   *
+   * @param color цвет
+   */
+  void render(const Color &color);
 
  public:
   /**
    * @brief Construct a new Text object
    *
+   * @param mode режим растеризации символов
    */
-  Text();
+  Text(TextMode mode = textMode);
   /**
    * @brief Destroy the Text object
    *
@@ -122,7 +317,7 @@ class Text {
   /**
    * @brief рисует текст
    *
-   * @param text строка
+   * @param text строка в UTF-8
    * @param color цвет
    * @param pt координаты
    * @param height высота
@@ -130,3 +325,72 @@ class Text {
   void draw(const std::string &text, const Color &color, const Point &pt,
             GLfloat height);
 };
+
+/**
+ * @brief Текст, который хранит разложенные вертексы и пересобирает их только
+ * при изменении строки или параметров
+ *
+ */
+class TextLabel : public Text {
+  /**
+   * @brief строка
+   *
+   */
+  std::string text;
+  /**
+   * @brief цвет
+   *
+   */
+  Color color;
+  /**
+   * @brief координаты
+   *
+   */
+  Point pt;
+  /**
+   * @brief высота
+   *
+   */
+  GLfloat height;
+  /**
+   * @brief вертексы не соответствуют строке, надо пересобрать
+   *
+   */
+  bool changed = true;
+
+ public:
+  /**
+   * @brief Construct a new Text Label object
+   *
+   * @param color цвет
+   * @param pt координаты
+   * @param height высота
+   * @param mode режим растеризации символов
+   */
+  TextLabel(const Color &color, const Point &pt, GLfloat height,
+            TextMode mode = textMode);
+  /**
+   * @brief Устанавливает строку, если она изменилась
+   *
+   * @param str строка
+   */
+  void set(const char *str);
+  /**
+   * @brief Устанавливает цвет
+   *
+   * @param clr цвет
+   */
+  void setColor(const Color &clr);
+  /**
+   * @brief Устанавливает координаты и высоту
+   *
+   * @param point координаты
+   * @param h высота
+   */
+  void setPosition(const Point &point, GLfloat h);
+  /**
+   * @brief Рисует текст, раскладывая его только если что-то поменялось
+   *
+   */
+  void draw();
+};
@@ -22,11 +22,16 @@ class Random {
   * @brief Construct a new Random object
   * 
   * @param sz диапазон
+  * @param seed начальное значение, одинаковое дает одинаковую
+  * последовательность
   */
-  Random(GLfloat sz) : dt(-sz, sz) {
-    std::random_device dev;
-    rng.seed(dev());
-  }
+  Random(GLfloat sz, unsigned seed) : dt(-sz, sz) { rng.seed(seed); }
+  /**
+   * @brief Случайное начальное значение для другого генератора
+   *
+   * @return unsigned
+   */
+  unsigned seed() { return unsigned(rng()); }
   /**
    * @brief 
    * 
@@ -42,45 +47,232 @@ class Random {
 };
 
 /**
- * @brief Парсит строку конфига в набор полигонов
- * 
- * @param cfg строка
- * @return std::vector<std::vector<Point>> 
+ * @brief Хеш FNV-1a 64 бит
+ *
+ * @param data данные
+ * @param size размер данных
+ * @param hash хеш предыдущих данных, если считаем по частям
+ * @return uint64_t хеш
  */
-inline std::vector<std::vector<Point>> parseConfig(const std::string &cfg) {
-  std::vector<std::vector<Point>> res;
-  GLfloat min[AXES], max[AXES];
-  auto begin0 = cfg.begin();
-  std::regex r0(R"(\[(.+)\])");
-  std::match_results<std::string::const_iterator> m0;
-  while (std::regex_search(begin0, cfg.end(), m0, r0)) {
+inline uint64_t fnv1a(const void *data, size_t size,
+                      uint64_t hash = 0xcbf29ce484222325ull) {
+  auto p = static_cast<const unsigned char *>(data);
+  for (size_t i = 0; i < size; i++) {
+    hash ^= p[i];
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+/**
+ * @brief Читает файл целиком
+ *
+ * @param file Путь к файлу
+ * @return std::string содержимое файла
+ */
+inline std::string readFile(const char *file) {
+  std::ifstream fs(file, std::ios::binary);
+  return std::string((std::istreambuf_iterator<char>(fs)),
+                     std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Полигоны участка конфига до приведения к [-1, 1]
+ *
+ */
+struct ConfigChunk {
+  std::vector<std::vector<Point>> polygons;
+  /**
+   * @brief границы точек
+   *
+   */
+  Point min, max;
+  /**
+   * @brief количество точек
+   *
+   */
+  size_t count = 0;
+  /**
+   * @brief сообщение об ошибке, nullptr если ошибки нет
+   *
+   */
+  const char *error = nullptr;
+  /**
+   * @brief позиция ошибки
+   *
+   */
+  const char *at = nullptr;
+};
+
+/**
+ * @brief Парсит участок конфига за один проход
+ *
+ * Полигон - [(x, y), (x, y), ...], запятые между точками можно опустить,
+ * пробелы и переводы строк допустимы везде между элементами. Числа вида
+ * [+-]123.45. Участок должен начинаться на границе полигона, разбор
+ * останавливается на первой ошибке.
+ *
+ * @param first начало участка
+ * @param last конец участка
+ * @param chunk результат
+ */
+inline void parseConfigChunk(const char *first, const char *last,
+                             ConfigChunk &chunk) {
+  auto p = first;
+  auto error = [&](const char *what) {
+    chunk.error = what;
+    chunk.at = p;
+  };
+  auto skip = [&] {
+    while (p != last && std::isspace((unsigned char)*p)) p++;
+  };
+  auto expect = [&](char c) {
+    skip();
+    if (p == last || *p != c) return false;
+    p++;
+    return true;
+  };
+  // Число копируем в буфер на стеке, strtof округляет так же как std::stof
+  auto number = [&](GLfloat &v) {
+    skip();
+    char buf[64];
+    size_t n = 0;
+    auto put = [&] {
+      if (n < sizeof(buf) - 1) buf[n] = *p;
+      n++;
+      p++;
+    };
+    auto digits = [&] {
+      auto start = p;
+      while (p != last && *p >= '0' && *p <= '9') put();
+      return p != start;
+    };
+    auto start = p;
+    if (p != last && (*p == '+' || *p == '-')) put();
+    if (!digits()) {
+      p = start;
+      return false;
+    }
+    if (p != last && *p == '.') {
+      put();
+      digits();
+    }
+    if (n >= sizeof(buf)) {
+      p = start;
+      return false;
+    }
+    buf[n] = 0;
+    v = std::strtof(buf, nullptr);
+    return true;
+  };
+
+  auto &min = chunk.min, &max = chunk.max;
+  auto &count = chunk.count;
+  if (last - p >= 3 && !std::memcmp(p, "\xEF\xBB\xBF", 3)) p += 3;  // BOM
+  for (skip(); p != last; skip()) {
+    if (!expect('[')) return error("expected '['");
     std::vector<Point> pts;
-    std::regex r(R"(\(\s*([+-]?\d+\.?\d*)\s*,\s*([+-]?\d+\.?\d*)\s*\))");
-    auto begin = m0[1].first;
-    std::match_results<std::string::const_iterator> m;
-    while (std::regex_search(begin, m0[1].second, m, r)) {
+    while (!expect(']')) {
+      if (!expect('(')) return error("expected '(' or ']'");
       Point pt;
-      for (int i = 0; i < AXES; i++) {
-        pt[i] = std::stof(m[i + 1].str());
-        min[i] = res.empty() && pts.empty() ? pt[i] : std::min(pt[i], min[i]);
-        max[i] = res.empty() && pts.empty() ? pt[i] : std::max(pt[i], max[i]);
+      for (size_t i = 0; i < AXES; i++) {
+        if (i && !expect(',')) return error("expected ','");
+        if (!number(pt[i])) return error("expected number");
+        min[i] = count ? std::min(pt[i], min[i]) : pt[i];
+        max[i] = count ? std::max(pt[i], max[i]) : pt[i];
       }
+      if (!expect(')')) return error("expected ')'");
       pts.push_back(pt);
-      begin = m.suffix().first;
+      count++;
+      skip();
+      if (p != last && *p == ',') p++;
     }
-    res.push_back(pts);
-    begin0 = m0.suffix().first;
+    chunk.polygons.push_back(std::move(pts));
   }
-  for (int i = 0; i < AXES; i++) {
-    max[i] -= min[i];
-    if (max[i] < 1e-10f) return {};
+}
+
+/**
+ * @brief Выводит ошибку участка со строкой и позицией в тексте
+ *
+ * @param first начало всего текста
+ * @param chunk участок с ошибкой
+ */
+inline void printConfigError(const char *first, const ConfigChunk &chunk) {
+  size_t line = 1;
+  auto lineStart = first;
+  for (auto p = first; p != chunk.at; p++) {
+    if (*p == '\n') {
+      line++;
+      lineStart = p + 1;
+    }
   }
-  for (auto &pts : res) {
-    for (auto &pt : pts) {
-      for (int i = 0; i < AXES; i++) {
-        pt[i] = (pt[i] - min[i]) / max[i] * 2.f - 1.f;
-      }
+  std::cout << "Config error at line " << line << ", column "
+            << chunk.at - lineStart + 1 << ": " << chunk.error << std::endl;
+}
+
+/**
+ * @brief Размах точек конфига по осям
+ *
+ * @param chunk все точки конфига
+ * @param size размах
+ * @return true
+ * @return false точек нет или они на одной линии
+ */
+inline bool configSize(const ConfigChunk &chunk, Size &size) {
+  if (!chunk.count) return false;
+  for (size_t i = 0; i < AXES; i++) {
+    size[i] = chunk.max[i] - chunk.min[i];
+    if (size[i] < 1e-10f) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Приводит точки полигона к [-1, 1]
+ *
+ * @param pts точки
+ * @param min левый нижний угол всех точек
+ * @param size размах всех точек
+ */
+inline void normalizeConfig(std::vector<Point> &pts, const Point &min,
+                            const Size &size) {
+  for (auto &pt : pts) {
+    for (size_t i = 0; i < AXES; i++) {
+      pt[i] = (pt[i] - min[i]) / size[i] * 2.f - 1.f;
     }
   }
-  return res;
+}
+
+/**
+ * @brief Парсит конфиг в набор полигонов за один проход
+ *
+ * Формат как у parseConfigChunk. Координаты приводятся к [-1, 1] по границам
+ * всех точек. При ошибке выводит строку и позицию и возвращает пустой набор.
+ *
+ * @param first начало текста
+ * @param last конец текста
+ * @return std::vector<std::vector<Point>>
+ */
+inline std::vector<std::vector<Point>> parseConfig(const char *first,
+                                                   const char *last) {
+  ConfigChunk chunk;
+  parseConfigChunk(first, last, chunk);
+  if (chunk.error) {
+    printConfigError(first, chunk);
+    return {};
+  }
+  Size size;
+  if (!configSize(chunk, size)) return {};
+  for (auto &pts : chunk.polygons) normalizeConfig(pts, chunk.min, size);
+  return std::move(chunk.polygons);
+}
+
+/**
+ * @brief Парсит строку конфига в набор полигонов
+ * 
+ * @param cfg строка
+ * @return std::vector<std::vector<Point>> 
+ */
+inline std::vector<std::vector<Point>> parseConfig(const std::string &cfg) {
+  return parseConfig(cfg.data(), cfg.data() + cfg.size());
 }
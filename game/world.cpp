@@ -0,0 +1,148 @@
+/**
+ * @file world.cpp
+ * @author Alex Light (dev@3107.ru)
+ * @brief Реализация класса World
+ * @version 0.1
+ * @date 2026-10-19
+ */
+#include "world.h"
+
+#include <algorithm>
+
+World::World(const Config &cfg, const Color &color, VertexFormat format)
+    : cfg(cfg),
+      color(color),
+      format(format),
+      chunks(cfg.getHeader().chunks),
+      min{-gameSize, -gameSize},
+      max{gameSize, gameSize},
+      areaMin(min),
+      areaMax(max) {
+  if (!chunks) {
+    // Весь уровень на поле, один кусок без границ
+    loaded.push_back(Chunk{0, std::make_unique<Objects>(color, format), min,
+                           max});
+    cfg.load(*loaded.back().objects);
+    return;
+  }
+  // Сжатые точки только в пределах поля
+  this->format = VertexFormat::Float;
+  min = cfg.getHeader().min;
+  max = cfg.getHeader().max;
+  areaMin = areaMax = min;
+}
+
+bool World::overlaps(const Chunk &c, const Point &lo, const Point &hi) const {
+  if (!chunks) return true;
+  // Запас на погрешность проверок пересечения, как у сетки объектов
+  constexpr GLfloat margin = 1e-4f;
+  for (size_t j = 0; j < AXES; j++)
+    if (hi[j] + margin < c.min[j] || lo[j] - margin > c.max[j]) return false;
+  return true;
+}
+
+Point World::follow(const Point &pt) const {
+  Point c;
+  for (size_t j = 0; j < AXES; j++) {
+    auto lo = min[j] + gameSize, hi = max[j] - gameSize;
+    c[j] = lo < hi ? std::max(std::min(pt[j], hi), lo) : (lo + hi) / 2.f;
+  }
+  return c;
+}
+
+void World::stream(const Point &camera) {
+  if (!chunks) return;
+  auto &h = cfg.getHeader();
+  // Ячейки кусков в области вида с запасом dist
+  auto range = [&](GLfloat dist, size_t j, size_t &first, size_t &last) {
+    auto cell = [&](GLfloat v) {
+      auto k = std::floor((v - h.min[j]) / h.chunk[j]);
+      return size_t(std::max(std::min(k, GLfloat(chunks - 1)), 0.f));
+    };
+    first = cell(camera[j] - gameSize - dist);
+    last = cell(camera[j] + gameSize + dist);
+  };
+  size_t keep[AXES][2], load[AXES][2];
+  for (size_t j = 0; j < AXES; j++) {
+    range(streamDistance * 2.f, j, keep[j][0], keep[j][1]);
+    range(streamDistance, j, load[j][0], load[j][1]);
+  }
+  auto within = [&](size_t index, size_t (&r)[AXES][2]) {
+    auto x = index % chunks, y = index / chunks;
+    return x >= r[0][0] && x <= r[0][1] && y >= r[1][0] && y <= r[1][1];
+  };
+
+  // Выгрузим дальние, объекты пойдут под следующие куски
+  size_t n = 0;
+  for (size_t i = 0; i < loaded.size(); i++) {
+    auto &c = loaded[i];
+    if (within(c.index, keep)) {
+      if (i != n) loaded[n] = std::move(c);
+      n++;
+    } else {
+      c.objects->clear();
+      spare.push_back(std::move(c.objects));
+    }
+  }
+  loaded.erase(loaded.begin() + n, loaded.end());
+  // Загрузим недостающие, порядок номеров сохраняем
+  bool added = false;
+  for (auto y = load[1][0]; y <= load[1][1]; y++) {
+    for (auto x = load[0][0]; x <= load[0][1]; x++) {
+      auto index = y * chunks + x;
+      auto it = std::find_if(loaded.begin(), loaded.end(),
+                             [&](const Chunk &c) { return c.index == index; });
+      if (it != loaded.end()) continue;
+      std::unique_ptr<Objects> objects;
+      if (spare.empty()) {
+        objects = std::make_unique<Objects>(color, format);
+      } else {
+        objects = std::move(spare.back());
+        spare.pop_back();
+      }
+      cfg.loadChunk(index, *objects);
+      auto &r = cfg.getChunk(index);
+      loaded.push_back(Chunk{index, std::move(objects), r.min, r.max});
+      added = true;
+    }
+  }
+  if (added)
+    std::sort(loaded.begin(), loaded.end(),
+              [](const Chunk &a, const Chunk &b) { return a.index < b.index; });
+  // Загружена область куда могут зайти спрайты, без запаса на выгрузку
+  for (size_t j = 0; j < AXES; j++) {
+    areaMin[j] = h.min[j] + h.chunk[j] * GLfloat(load[j][0]);
+    areaMax[j] = h.min[j] + h.chunk[j] * GLfloat(load[j][1] + 1);
+  }
+}
+
+Point World::clamp(const Point &pt) const {
+  if (!chunks) return g::ensureInScene(pt);
+  return Point{std::max(std::min(pt[0], max[0]), min[0]),
+               std::max(std::min(pt[1], max[1]), min[1])};
+}
+
+bool World::active(const Point &pt) const {
+  if (!chunks) return true;
+  return pt[0] >= areaMin[0] && pt[0] <= areaMax[0] && pt[1] >= areaMin[1] &&
+         pt[1] <= areaMax[1];
+}
+
+WorldHandle World::inside(const Point &pt) const {
+  return find(pt, pt, [&](const Objects &o) { return o.inside(pt); });
+}
+
+WorldHandle World::intersect(const Point &pt1, const Point &pt2) const {
+  Point lo{std::min(pt1[0], pt2[0]), std::min(pt1[1], pt2[1])};
+  Point hi{std::max(pt1[0], pt2[0]), std::max(pt1[1], pt2[1])};
+  return find(lo, hi,
+              [&](const Objects &o) { return o.intersect(pt1, pt2); });
+}
+
+PointView World::getPoints(WorldHandle o) const {
+  return o.chunk->getPoints(o.object);
+}
+
+size_t World::size() const { return loaded.size(); }
+
+bool World::streamed() const { return chunks; }
@@ -0,0 +1,226 @@
+/**
+ * @file world.h
+ * @author Alex Light (dev@3107.ru)
+ * @brief Препятствия уровня, загружаемые кусками вокруг камеры
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Уровень в пределах поля - один кусок, загруженный всегда, камера стоит в
+ * центре. Уровень больше поля (levelc с размером мира) делится на куски,
+ * загружены только куски рядом с камерой, остальные остаются в файле.
+ * Проверки пересечений проходят загруженные куски по порядку номеров.
+ */
+#pragma once
+
+#include "level.h"
+
+/**
+ * @brief Ссылка на объект мира
+ *
+ */
+struct WorldHandle {
+  /**
+   * @brief кусок объекта
+   *
+   */
+  const Objects *chunk = nullptr;
+  /**
+   * @brief объект в куске
+   *
+   */
+  ObjectHandle object;
+  explicit operator bool() const { return chunk && object; }
+};
+
+/**
+ * @brief Препятствия уровня
+ *
+ */
+class World {
+  /**
+   * @brief загруженный кусок
+   *
+   */
+  struct Chunk {
+    /**
+     * @brief номер куска, y * chunks + x
+     *
+     */
+    size_t index;
+    std::unique_ptr<Objects> objects;
+    /**
+     * @brief границы точек объектов
+     *
+     */
+    Point min, max;
+  };
+  /**
+   * @brief конфигурация, куски берутся из нее
+   *
+   */
+  const Config &cfg;
+  Color color;
+  VertexFormat format;
+  /**
+   * @brief кусков по каждой оси, 0 - уровень целиком в одном куске
+   *
+   */
+  size_t chunks;
+  /**
+   * @brief границы мира
+   *
+   */
+  Point min, max;
+  /**
+   * @brief загруженные куски по возрастанию номера
+   *
+   */
+  std::vector<Chunk> loaded;
+  /**
+   * @brief выгруженные объекты для следующих кусков
+   *
+   */
+  std::vector<std::unique_ptr<Objects>> spare;
+  /**
+   * @brief загруженная область
+   *
+   */
+  Point areaMin, areaMax;
+
+  /**
+   * @brief Пересекаются ли область запроса и кусок
+   *
+   * @param c кусок
+   * @param lo левый нижний угол запроса
+   * @param hi правый верхний угол запроса
+   * @return true
+   * @return false
+   */
+  bool overlaps(const Chunk &c, const Point &lo, const Point &hi) const;
+  /**
+   * @brief Ищет первый объект по загруженным кускам
+   *
+   * @tparam F ObjectHandle(const Objects &)
+   * @param lo левый нижний угол запроса
+   * @param hi правый верхний угол запроса
+   * @param f проверка куска
+   * @return WorldHandle
+   */
+  template <typename F>
+  WorldHandle find(const Point &lo, const Point &hi, F f) const;
+
+ public:
+  /**
+   * @brief Construct a new World object
+   *
+   * @param cfg конфигурация, должна жить не меньше мира
+   * @param color цвет препятствий
+   * @param format формат точек, мир больше поля хранится как Point
+   */
+  World(const Config &cfg, const Color &color, VertexFormat format);
+  /**
+   * @brief Центр камеры, которая следит за точкой, вид не выходит за мир
+   *
+   * @param pt точка
+   * @return Point
+   */
+  Point follow(const Point &pt) const;
+  /**
+   * @brief Загружает куски рядом с видом и выгружает дальние
+   *
+   * @param camera центр вида
+   */
+  void stream(const Point &camera);
+  /**
+   * @brief Ограничивает точку миром
+   *
+   * @param pt точка
+   * @return Point
+   */
+  Point clamp(const Point &pt) const;
+  /**
+   * @brief Есть ли вокруг точки загруженные препятствия
+   *
+   * @param pt точка
+   * @return true
+   * @return false за загруженной областью столкновения не проверить
+   */
+  bool active(const Point &pt) const;
+  /**
+   * @brief Объект, внутри которого точка
+   *
+   * @param pt точка
+   * @return WorldHandle
+   */
+  WorldHandle inside(const Point &pt) const;
+  /**
+   * @brief Объект, который пересекает отрезок
+   *
+   * @param pt1 1ая точка отрезка
+   * @param pt2 2ая точка отрезка
+   * @return WorldHandle
+   */
+  WorldHandle intersect(const Point &pt1, const Point &pt2) const;
+  /**
+   * @brief Объект, который пересекает полигон
+   *
+   * @param pts точки полигона
+   * @return WorldHandle
+   */
+  template <typename C>
+  WorldHandle intersect(const C &pts) const;
+  /**
+   * @brief Точки объекта
+   *
+   * @param o ссылка
+   * @return PointView
+   */
+  PointView getPoints(WorldHandle o) const;
+  /**
+   * @brief Вызывает f для загруженных кусков в области по порядку
+   *
+   * @tparam F void(const Objects &)
+   * @param lo левый нижний угол области
+   * @param hi правый верхний угол области
+   * @param f функция
+   */
+  template <typename F>
+  void visit(const Point &lo, const Point &hi, F f) const {
+    for (auto const &c : loaded)
+      if (overlaps(c, lo, hi)) f(*c.objects);
+  }
+  /**
+   * @brief Количество загруженных кусков
+   *
+   * @return size_t
+   */
+  size_t size() const;
+  /**
+   * @brief Загружается ли мир кусками
+   *
+   * @return true
+   * @return false уровень целиком в одном куске и не меняется
+   */
+  bool streamed() const;
+};
+
+template <typename F>
+WorldHandle World::find(const Point &lo, const Point &hi, F f) const {
+  for (auto const &c : loaded) {
+    if (!overlaps(c, lo, hi)) continue;
+    if (auto o = f(*c.objects)) return WorldHandle{c.objects.get(), o};
+  }
+  return WorldHandle();
+}
+
+template <typename C>
+WorldHandle World::intersect(const C &pts) const {
+  Point lo{0.f, 0.f}, hi{0.f, 0.f};
+  for (size_t i = 0; i < pts.size(); i++) {
+    for (size_t j = 0; j < AXES; j++) {
+      lo[j] = i ? std::min(lo[j], pts[i][j]) : pts[i][j];
+      hi[j] = i ? std::max(hi[j], pts[i][j]) : pts[i][j];
+    }
+  }
+  return find(lo, hi, [&](const Objects &o) { return o.intersect(pts); });
+}
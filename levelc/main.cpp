@@ -0,0 +1,43 @@
+#include "level.h"
+
+int main(int argc, char **argv) {
+  std::cout << "levelc - compile level config to binary level" << std::endl;
+
+  if (argc != 3 && argc != 4) {
+    std::cout << "Usage: levelc in.cfg out.lvl [worldSize]" << std::endl
+              << "  worldSize - half side of the world in fields, a world "
+                 "larger than 1 is split into chunks streamed around the "
+                 "camera"
+              << std::endl;
+    return 1;
+  }
+  auto worldSize = argc == 4 ? std::stof(argv[3]) : gameSize;
+  if (!(worldSize >= gameSize)) {
+    std::cout << "Error worldSize must be at least 1" << std::endl;
+    return 1;
+  }
+
+  auto text = readFile(argv[1]);
+  auto cfg = parseConfig(text);
+  if (cfg.empty()) {
+    std::cout << "Error no polygons in " << argv[1] << std::endl;
+    return 1;
+  }
+  if (!Level::compile(cfg, argv[2], worldSize)) return 1;
+
+  // Прочитаем обратно, заодно проверим файл
+  Config level;
+  if (!level.open(argv[2]) || !level.isBinary()) return 1;
+  Objects objects(Color{});
+  level.load(objects);
+  size_t points = 0, triangles = 0;
+  for (size_t i = 0; i < objects.size(); i++) {
+    points += objects.getPoints(i).size();
+    triangles += objects.getIndexes(i).size();
+  }
+  std::cout << "Objects: " << objects.size() << " of " << cfg.size()
+            << ", points: " << points << ", triangles: " << triangles
+            << ", chunks: " << level.getHeader().chunks << "x"
+            << level.getHeader().chunks << std::endl;
+  return 0;
+}
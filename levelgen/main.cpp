@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "geometry.h"
+
+// Размер клетки поля, в каждой клетке не больше одного препятствия
+constexpr float cell = 10.f;
+
+// Многоугольник с центром в 0 радиуса r, вершины идут по кругу
+std::vector<Point> polygon(std::mt19937 &rnd, int n, bool concave, float r) {
+  std::uniform_real_distribution<float> jitter(-.4f, .4f), outer(.8f, 1.f),
+      inner(.3f, .6f);
+  auto step = 2.f * PI / n;
+  std::vector<Point> pts;
+  for (int i = 0; i < n; i++) {
+    auto phi = step * (i + jitter(rnd));
+    // Невыпуклый - звезда, каждая вторая вершина ближе к центру
+    auto rr = r * (concave ? (i % 2 ? inner(rnd) : outer(rnd)) : 1.f);
+    pts.push_back(Point{rr * std::cos(phi), rr * std::sin(phi)});
+  }
+  return pts;
+}
+
+int main(int argc, char **argv) {
+  std::cout << "levelgen - generate stress level config" << std::endl;
+
+  if (argc != 8) {
+    std::cout << "Usage: levelgen out.cfg count minVertices maxVertices "
+                 "concave density seed"
+              << std::endl
+              << "  concave - share of concave polygons 0..1" << std::endl
+              << "  density - share of the field covered by polygons 0..1"
+              << std::endl;
+    return 1;
+  }
+
+  auto count = std::stoi(argv[2]);
+  auto minVertices = std::max(3, std::stoi(argv[3]));
+  auto maxVertices = std::max(minVertices, std::stoi(argv[4]));
+  auto concave = std::stof(argv[5]);
+  auto density = std::stof(argv[6]);
+  std::mt19937 rnd(std::stoul(argv[7]));
+  if (count < 1 || density <= 0.f) {
+    std::cout << "Error count and density must be positive" << std::endl;
+    return 1;
+  }
+
+  // Поле из клеток, в которые влезают все многоугольники, радиус такой,
+  // чтобы многоугольники закрывали заданную долю поля
+  auto side = int(std::ceil(std::sqrt(float(count))));
+  auto r = std::min(std::sqrt(density / PI), .45f) * cell;
+  std::vector<int> cells(side * side);
+  for (size_t i = 0; i < cells.size(); i++) cells[i] = int(i);
+  std::shuffle(cells.begin(), cells.end(), rnd);
+
+  std::ofstream ofs(argv[1]);
+  std::uniform_int_distribution<int> vertices(minVertices, maxVertices);
+  std::uniform_real_distribution<float> share(0.f, 1.f);
+  std::uniform_real_distribution<float> shift(-(cell * .5f - r),
+                                              cell * .5f - r);
+  char str[64];
+  for (int i = 0; i < count; i++) {
+    Point center{(cells[i] % side + .5f) * cell + shift(rnd),
+                 (cells[i] / side + .5f) * cell + shift(rnd)};
+    auto n = vertices(rnd);
+    auto star = n > 3 && share(rnd) < concave;
+    // Игра отбрасывает то, что не триангулируется, так что проверим сами
+    std::vector<Point> pts;
+    std::vector<Triangle> triangles;
+    do {
+      pts = polygon(rnd, n, star, r);
+      for (auto &pt : pts) {
+        for (size_t a = 0; a < AXES; a++) {
+          std::snprintf(str, sizeof(str), "%.2f", pt[a] + center[a]);
+          pt[a] = std::stof(str);
+        }
+      }
+      triangles.clear();
+    } while (!g::triangulate2d(pts, triangles));
+    for (size_t j = 0; j < pts.size(); j++) {
+      std::snprintf(str, sizeof(str), "%s(%.2f, %.2f)", j ? "," : "[",
+                    pts[j][0], pts[j][1]);
+      ofs << str;
+    }
+    ofs << "]\n";
+  }
+
+  if (!ofs) {
+    std::cout << "Error writing file: " << argv[1] << std::endl;
+    return 1;
+  }
+  std::cout << count << " polygons on " << side << "x" << side << " cells"
+            << std::endl;
+  return 0;
+}